@@ -64,6 +64,10 @@ layout(location = 3) in vec3 inWorldTangent;
 layout(location = 4) in vec3 inWorldBinormal;
 #endif //BUMP_TEXTURE_ENABLE
 
+#ifdef INSTANCING_ENABLE
+layout(location = 5) flat in uint inKey;
+#endif //INSTANCING_ENABLE
+
 //-------------------------------------------------------------------------------------------------
 // output
 //-------------------------------------------------------------------------------------------------
@@ -221,7 +225,11 @@ void main()
 	/* Select */
 	/**********/
 	
+#ifdef INSTANCING_ENABLE
+	outSelect = unpackUnorm4x8(inKey);
+#else //INSTANCING_ENABLE
 	outSelect = unpackUnorm4x8(mesh.key);
+#endif //INSTANCING_ENABLE
 }
 
 #endif //TRANSPARENCY_ENABLE
\ No newline at end of file
@@ -19,8 +19,36 @@ layout(std140, set = 0, binding = 0) uniform Mesh
 	mat4 worldMatrix;
 #endif //SKELETAL_ENABLE
 	uint key;
+#ifdef PACKED_VERTEX_ENABLE
+	vec4 positionScale;
+	vec4 positionOffset;
+#endif //PACKED_VERTEX_ENABLE
 }mesh;
 
+#ifdef INSTANCING_ENABLE
+struct Instance
+{
+	mat4 worldMatrix;
+	uvec4 key; // x : key
+};
+
+layout(std140, set = 2, binding = 0) uniform Instancing
+{
+	Instance instances[INSTANCE_COUNT];
+}instancing;
+#endif //INSTANCING_ENABLE
+
+#ifdef PACKED_VERTEX_ENABLE
+layout(location = 0) in vec4 inPackedPos; // xyz : position, w : binormal sign
+#ifdef TEXTURE_ENABLE
+layout(location = 1) in vec2 inUV;
+#endif //TEXTURE_ENABLE
+layout(location = 2) in vec4 inPackedTangentFrame; // xy : normal, zw : tangent
+#ifdef SKELETAL_ENABLE
+layout(location = 5) in uvec4 inIndices;
+layout(location = 6) in vec4 inWeights;
+#endif //SKELETAL_ENABLE
+#else //PACKED_VERTEX_ENABLE
 layout(location = 0) in vec3 inPos;
 #ifdef TEXTURE_ENABLE
 layout(location = 1) in vec2 inUV;
@@ -34,6 +62,7 @@ layout(location = 4) in vec3 inBinormal;
 layout(location = 5) in ivec4 inIndices;
 layout(location = 6) in vec4 inWeights;
 #endif //SKELETAL_ENABLE
+#endif //PACKED_VERTEX_ENABLE
 
 //-------------------------------------------------------------------------------------------------
 // output
@@ -52,6 +81,9 @@ layout(location = 2) out vec3 outWorldNormal;
 layout(location = 3) out vec3 outWorldTangent;
 layout(location = 4) out vec3 outWorldBinormal;
 #endif //BUMP_TEXTURE_ENABLE
+#ifdef INSTANCING_ENABLE
+layout(location = 5) flat out uint outKey;
+#endif //INSTANCING_ENABLE
 
 out gl_PerVertex 
 {
@@ -62,6 +94,28 @@ out gl_PerVertex
 // functions
 //-------------------------------------------------------------------------------------------------
 
+#ifdef PACKED_VERTEX_ENABLE
+
+// Decode position ( unorm16 -> local )
+vec3 DecodePosition(vec4 packedPos)
+{
+	return mesh.positionOffset.xyz + (packedPos.xyz * mesh.positionScale.xyz);
+}
+
+// Decode octahedral unit vector
+vec3 DecodeOctahedron(vec2 e)
+{
+	vec3 v = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+	if (v.z < 0.0)
+	{
+		v.xy = (1.0 - abs(v.yx)) * vec2((v.x >= 0.0) ? 1.0 : -1.0, (v.y >= 0.0) ? 1.0 : -1.0);
+	}
+
+	return normalize(v);
+}
+
+#endif //PACKED_VERTEX_ENABLE
+
 #ifdef SKELETAL_ENABLE
 
 // World transform position
@@ -94,6 +148,31 @@ vec3 BoneTransformNormal(vec3 normal)
 
 void main()
 {
+#ifdef PACKED_VERTEX_ENABLE
+	vec3 pos = DecodePosition(inPackedPos);
+	vec3 normal = DecodeOctahedron(inPackedTangentFrame.xy);
+#ifdef BUMP_TEXTURE_ENABLE
+	vec3 tangent = DecodeOctahedron(inPackedTangentFrame.zw);
+	vec3 binormal = cross(normal, tangent) * ((inPackedPos.w * 2.0) - 1.0);
+#endif //BUMP_TEXTURE_ENABLE
+#else //PACKED_VERTEX_ENABLE
+	vec3 pos = inPos;
+	vec3 normal = inNormal;
+#ifdef BUMP_TEXTURE_ENABLE
+	vec3 tangent = inTangent;
+	vec3 binormal = inBinormal;
+#endif //BUMP_TEXTURE_ENABLE
+#endif //PACKED_VERTEX_ENABLE
+
+#ifndef SKELETAL_ENABLE
+#ifdef INSTANCING_ENABLE
+	mat4 worldMatrix = instancing.instances[gl_InstanceIndex].worldMatrix;
+	outKey = instancing.instances[gl_InstanceIndex].key.x;
+#else //INSTANCING_ENABLE
+	mat4 worldMatrix = mesh.worldMatrix;
+#endif //INSTANCING_ENABLE
+#endif //SKELETAL_ENABLE
+
 	/******/
 	/* UV */
 	/******/
@@ -107,10 +186,10 @@ void main()
 	/************/
 
 #ifdef SKELETAL_ENABLE
-	vec4 worldPos = BoneTransformPosition(vec4(inPos, 1.0));
+	vec4 worldPos = BoneTransformPosition(vec4(pos, 1.0));
 	gl_Position = scene.viewProjMatrix * worldPos;
 #else //SKELETAL_ENABLE
-	vec4 worldPos = mesh.worldMatrix * vec4(inPos, 1.0);
+	vec4 worldPos = worldMatrix * vec4(pos, 1.0);
 	gl_Position = scene.viewProjMatrix * worldPos;
 #endif //SKELETAL_ENABLE
 
@@ -125,9 +204,9 @@ void main()
 	/****************/
 
 #ifdef SKELETAL_ENABLE
-	outWorldNormal = BoneTransformNormal(inNormal);
+	outWorldNormal = BoneTransformNormal(normal);
 #else //SKELETAL_ENABLE
-	outWorldNormal = mat3(mesh.worldMatrix) * inNormal;
+	outWorldNormal = mat3(worldMatrix) * normal;
 #endif //SKELETAL_ENABLE
 
 	/*****************/
@@ -136,11 +215,11 @@ void main()
 
 #ifdef BUMP_TEXTURE_ENABLE
 #ifdef SKELETAL_ENABLE
-	outWorldTangent = BoneTransformNormal(inTangent);
-	outWorldBinormal = BoneTransformNormal(inBinormal);
+	outWorldTangent = BoneTransformNormal(tangent);
+	outWorldBinormal = BoneTransformNormal(binormal);
 #else //SKELETAL_ENABLE
-	outWorldTangent = mat3(mesh.worldMatrix) * inTangent;
-	outWorldBinormal = mat3(mesh.worldMatrix) * inBinormal;
+	outWorldTangent = mat3(worldMatrix) * tangent;
+	outWorldBinormal = mat3(worldMatrix) * binormal;
 #endif //SKELETAL_ENABLE
 #endif //BUMP_TEXTURE_ENABLE
 }
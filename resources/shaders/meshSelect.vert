@@ -19,11 +19,23 @@ layout(std140, set = 0, binding = 0) uniform Mesh
 	mat4 worldMatrix;
 #endif //SKELETAL_ENABLE
 	uint key;
+#ifdef PACKED_VERTEX_ENABLE
+	vec4 positionScale;
+	vec4 positionOffset;
+#endif //PACKED_VERTEX_ENABLE
 }mesh;
 
+#ifdef PACKED_VERTEX_ENABLE
+layout(location = 0) in vec4 inPackedPos;
+#else //PACKED_VERTEX_ENABLE
 layout(location = 0) in vec3 inPos;
+#endif //PACKED_VERTEX_ENABLE
 #ifdef SKELETAL_ENABLE
+#ifdef PACKED_VERTEX_ENABLE
+layout(location = 5) in uvec4 inIndices;
+#else //PACKED_VERTEX_ENABLE
 layout(location = 5) in ivec4 inIndices;
+#endif //PACKED_VERTEX_ENABLE
 layout(location = 6) in vec4 inWeights;
 #endif //SKELETAL_ENABLE
 
@@ -40,6 +52,16 @@ out gl_PerVertex
 // functions
 //-------------------------------------------------------------------------------------------------
 
+#ifdef PACKED_VERTEX_ENABLE
+
+// Decode position ( unorm16 -> local )
+vec3 DecodePosition(vec4 packedPos)
+{
+	return mesh.positionOffset.xyz + (packedPos.xyz * mesh.positionScale.xyz);
+}
+
+#endif //PACKED_VERTEX_ENABLE
+
 #ifdef SKELETAL_ENABLE
 
 // World transform position
@@ -72,15 +94,21 @@ vec3 BoneTransformNormal(vec3 normal)
 
 void main()
 {
+#ifdef PACKED_VERTEX_ENABLE
+	vec3 pos = DecodePosition(inPackedPos);
+#else //PACKED_VERTEX_ENABLE
+	vec3 pos = inPos;
+#endif //PACKED_VERTEX_ENABLE
+
 	/************/
 	/* Position */
 	/************/
 
 #ifdef SKELETAL_ENABLE
-	vec4 worldPos = BoneTransformPosition(vec4(inPos, 1.0));
+	vec4 worldPos = BoneTransformPosition(vec4(pos, 1.0));
 	gl_Position = scene.viewProjMatrix * worldPos;
 #else //SKELETAL_ENABLE
-	vec4 worldPos = mesh.worldMatrix * vec4(inPos, 1.0);
+	vec4 worldPos = mesh.worldMatrix * vec4(pos, 1.0);
 	gl_Position = scene.viewProjMatrix * worldPos;
 #endif //SKELETAL_ENABLE
 }
\ No newline at end of file
@@ -17,4 +17,15 @@ namespace ve {
 		AABB& UpdateCenterAndPoints();
 	};
 
+	// center  extent ( e̒̔ ) 𐬕Ƃɕׂ AABB ̔z ( ContainsBatch Ŕ肷 )
+	struct AABBArray
+	{
+		const float* pCenterX;
+		const float* pCenterY;
+		const float* pCenterZ;
+		const float* pExtentX;
+		const float* pExtentY;
+		const float* pExtentZ;
+	};
+
 }
@@ -10,10 +10,13 @@
 #include "Material.h"
 #include "Texture.h"
 #include "FbxModelSource.h"
+#include "ObjModelSource.h"
+#include "GltfModelSource.h"
 #include "SkeletalModel.h"
 #include "Node.h"
 #include "Gui.h"
 #include "Project.h"
+#include "FrustumBenchmark.h"
 
 namespace ve {
 
@@ -313,6 +316,10 @@ namespace ve {
 		m_LogDialog.SetDevice(m_Device);
 		m_LogDialog.SetLogger(m_Logger);
 
+#ifdef VE_BENCHMARK_FRUSTUM
+		FrustumBenchmark::Run(m_Logger);
+#endif //VE_BENCHMARK_FRUSTUM
+
 		// ----------------------------------------------------------------------------------------------------
 
 		return true;
@@ -387,7 +394,8 @@ namespace ve {
 					m_OpenFileBrowser.ShowModal();
 				}
 
-				if (m_Project != nullptr)
+				// ǂݍݒ̃f̃m[h͑Ȃ߁A܂ŕۑłȂ
+				if ((m_Project != nullptr) && (m_Project->IsLoading() == false))
 				{
 					if (ImGui::MenuItem("Save###MainMenu_File_Save", nullptr, nullptr) == true)
 					{
@@ -514,10 +522,26 @@ namespace ve {
 			SkeletalModelPtr model = SkeletalModel::Create(m_DeviceContext);
 			m_LoadingModel = model;
 
+			ModelSourcePtr source;
+			const wchar_t* pExtension = PathFindExtensionW(data.sourceFilePath.c_str());
+
+			if (_wcsicmp(pExtension, L".obj") == 0)
+			{
+				source = ObjModelSource::Create();
+			}
+			else if ((_wcsicmp(pExtension, L".gltf") == 0) || (_wcsicmp(pExtension, L".glb") == 0))
+			{
+				source = GltfModelSource::Create();
+			}
+			else
+			{
+				source = FbxModelSource::Create();
+			}
+
 			BackgroundJobHandlePtr handle = m_BackgroundQueue->AddImportJob(
 				m_BackgroundJobDialog.GetLogger(),
 				m_DeviceContext,
-				data.sourceFilePath.c_str(), data.sourceConfig, FbxModelSource::Create(),
+				data.sourceFilePath.c_str(), data.sourceConfig, source,
 				data.rednererConfig, model);
 
 			m_BackgroundJobDialog.ShowModel(handle);
@@ -533,10 +557,12 @@ namespace ve {
 
 			m_Project = Project::Create();
 
-			if (m_Project->Open(m_Logger, m_DeviceContext, m_Scene, filePath.c_str()) == true)
+			if (m_Project->Open(m_Logger, m_DeviceContext, m_Scene, m_BackgroundQueue, filePath.c_str()) == true)
 			{
 				m_OutlinerDialog.SetNode(m_Scene->GetRootNode());
 				m_InspectorDialog.SetNode(m_Scene->GetRootNode());
+
+				m_LoadingDialog.Show();
 			}
 			else
 			{
@@ -548,6 +574,18 @@ namespace ve {
 			}
 		}
 
+		// Project
+		if (m_Project != nullptr)
+		{
+			// ǂݍ݂fV[ɒǉ
+			m_Project->Update(m_Logger, m_Scene);
+
+			if (m_Project->IsLoading() == true)
+			{
+				m_LoadingDialog.Render(m_DeviceContext->GetScreenSize(), m_Project->GetLoadingHandle());
+			}
+		}
+
 		// Display - Fps
 		m_FpsDialog.Render(m_DeviceContext->GetScreenSize(), static_cast<float>(m_AverageFpsPerSec), static_cast<float>(m_DeltaTime));
 
@@ -583,6 +621,11 @@ namespace ve {
 
 			m_LoadingModel = nullptr;
 		}
+		else if (bjResult != 0)
+		{
+			// sA܂̓LZꂽ
+			m_LoadingModel = nullptr;
+		}
 
 		// Message Dialog
 		int32_t mdResult = m_MessageDialog.Render();
@@ -4,6 +4,7 @@
 
 #include "MessageDialog.h"
 #include "BackgroundJobDialog.h"
+#include "LoadingDialog.h"
 #include "FileBrowser.h"
 #include "ImportDialog.h"
 #include "FpsDialog.h"
@@ -72,6 +73,7 @@ namespace ve {
 
 		MessageDialog m_MessageDialog;
 		BackgroundJobDialog m_BackgroundJobDialog;
+		LoadingDialog m_LoadingDialog;
 		ImportDialog m_ImportDialog;
 		FileBrowser m_OpenFileBrowser;
 		FpsDialog m_FpsDialog;
@@ -1,6 +1,5 @@
 #include "BackgroundJobDialog.h"
 #include "Logger.h"
-#include "BackgroundQueue.h"
 
 namespace ve {
 
@@ -48,12 +47,14 @@ namespace ve {
 		m_Control.Render(m_Logger);
 
 		// ----------------------------------------------------------------------------------------------------
-		// Close
+		// Close, Cancel
 		// ----------------------------------------------------------------------------------------------------
 
 		SetResult(0);
 
-		if (m_Handle->IsFinished() == true)
+		bool finished = m_Handle->IsFinished();
+
+		if (finished == true)
 		{
 			if (ImGui::Button("Close###BackgroundJob_Close") == true)
 			{
@@ -69,7 +70,98 @@ namespace ve {
 			ImGui::PopStyleVar();
 		}
 
+		ImGui::SameLine();
+
+		if ((finished == false) && (m_Handle->IsCancelRequested() == false))
+		{
+			if (ImGui::Button("Cancel###BackgroundJob_Cancel") == true)
+			{
+				m_Handle->Cancel();
+			}
+		}
+		else
+		{
+			ImGui::PushStyleVar(ImGuiStyleVar_Alpha, 0.5f);
+			ImGui::Button("Cancel###BackgroundJob_Cancel");
+			ImGui::PopStyleVar();
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// Progress
+		// ----------------------------------------------------------------------------------------------------
+
+		ImGui::SameLine();
+
+		char overlay[128];
+		float fraction;
+
+		if (finished == true)
+		{
+			switch (m_Handle->GetState())
+			{
+			case BACKGROUND_JOB_COMPLETED:
+				strcpy_s(overlay, "Completed");
+				fraction = 1.0f;
+				break;
+			case BACKGROUND_JOB_CANCELED:
+				strcpy_s(overlay, "Canceled");
+				fraction = 0.0f;
+				break;
+			default:
+				strcpy_s(overlay, "Failed");
+				fraction = 0.0f;
+			}
+		}
+		else
+		{
+			uint64_t doneCount;
+			uint64_t totalCount;
+			m_Handle->GetProgress(doneCount, totalCount);
+
+			// A͓ƗčXV邽߁A𒴂邱Ƃ
+			doneCount = std::min(doneCount, totalCount);
+
+			if (totalCount > 0)
+			{
+				sprintf_s(overlay, "%s (%llu/%llu)", GetStageName(m_Handle->GetStage()), doneCount, totalCount);
+				fraction = static_cast<float>(static_cast<double>(doneCount) / static_cast<double>(totalCount));
+			}
+			else
+			{
+				sprintf_s(overlay, "%s", GetStageName(m_Handle->GetStage()));
+				fraction = 0.0f;
+			}
+
+			if (m_Handle->IsCancelRequested() == true)
+			{
+				strcat_s(overlay, " - Canceling");
+			}
+		}
+
+		ImGui::ProgressBar(fraction, ImVec2(-1.0f, 0.0f), overlay);
+
 		return false;
 	}
 
+	const char* BackgroundJobDialog::GetStageName(BACKGROUND_JOB_STAGE stage)
+	{
+		switch (stage)
+		{
+		case BACKGROUND_JOB_STAGE_READ_FILE:
+			return "Read file";
+		case BACKGROUND_JOB_STAGE_LOAD_SOURCE:
+			return "Load source";
+		case BACKGROUND_JOB_STAGE_LOAD_TEXTURE:
+			return "Load texture";
+		case BACKGROUND_JOB_STAGE_BUILD_MESH:
+			return "Build mesh";
+		case BACKGROUND_JOB_STAGE_WRITE_CACHE:
+			return "Write cache";
+		case BACKGROUND_JOB_STAGE_LOAD_MODEL:
+			return "Load model";
+		}
+
+		return "Waiting";
+	}
+
 }
\ No newline at end of file
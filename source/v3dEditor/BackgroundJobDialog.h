@@ -2,6 +2,7 @@
 
 #include "GuiPopup.h"
 #include "LogControl.h"
+#include "BackgroundQueue.h"
 
 namespace ve {
 
@@ -29,6 +30,8 @@ namespace ve {
 		BackgroundJobHandlePtr m_Handle;
 
 		bool OnRender() override;
+
+		static const char* GetStageName(BACKGROUND_JOB_STAGE stage);
 	};
 
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "BackgroundQueue.h"
 #include "SkeletalModel.h"
+#include "Logger.h"
+#include "ImportCache.h"
 #include <chrono>
 
 namespace ve {
@@ -9,7 +11,13 @@ namespace ve {
 	/*****************************/
 
 	BackgroundJobHandle::BackgroundJobHandle() :
-		m_State(BACKGROUND_JOB_PENDING)
+		m_State(BACKGROUND_JOB_PENDING),
+		m_Stage(BACKGROUND_JOB_STAGE_NONE),
+		m_DoneCount(0),
+		m_TotalCount(0),
+		m_CancelRequested(false),
+		m_JobCount(0),
+		m_FailedState(BACKGROUND_JOB_PENDING)
 	{
 	}
 
@@ -27,84 +35,187 @@ namespace ve {
 		return m_State >= BACKGROUND_JOB_COMPLETED;
 	}
 
-	/***********************/
-	/* private - class Job */
-	/***********************/
+	void BackgroundJobHandle::BeginStage(BACKGROUND_JOB_STAGE stage, uint64_t totalCount)
+	{
+		m_DoneCount.store(0, std::memory_order_relaxed);
+		m_TotalCount.store(totalCount, std::memory_order_relaxed);
+		m_Stage.store(stage, std::memory_order_relaxed);
+	}
 
-	BackgroundQueue::Job::Job(BackgroundJobHandlePtr handle) :
-		m_Handle(handle)
+	void BackgroundJobHandle::AddProgress(uint64_t count)
 	{
+		m_DoneCount.fetch_add(count, std::memory_order_relaxed);
 	}
 
-	BackgroundQueue::Job::~Job()
+	BACKGROUND_JOB_STAGE BackgroundJobHandle::GetStage() const
 	{
+		return m_Stage.load(std::memory_order_relaxed);
 	}
 
-	void BackgroundQueue::Job::Execute()
+	void BackgroundJobHandle::GetProgress(uint64_t& doneCount, uint64_t& totalCount) const
 	{
-		BACKGROUND_JOB_STATE currentState = BACKGROUND_JOB_PENDING;
+		doneCount = m_DoneCount.load(std::memory_order_relaxed);
+		totalCount = m_TotalCount.load(std::memory_order_relaxed);
+	}
 
-		if (m_Handle->m_State.compare_exchange_weak(currentState, BACKGROUND_JOB_RUNNING) == true)
-		{
-			currentState = BACKGROUND_JOB_RUNNING;
+	void BackgroundJobHandle::Cancel()
+	{
+		m_CancelRequested.store(true, std::memory_order_relaxed);
+	}
 
-			BACKGROUND_JOB_STATE nextState = OnExecute();
-			if (m_Handle->m_State.compare_exchange_weak(currentState, nextState) == false)
-			{
-				m_Handle->m_State.compare_exchange_strong(currentState, BACKGROUND_JOB_INTERNAL_ERROR);
-			}
-		}
-		else
-		{
-			m_Handle->m_State.compare_exchange_strong(currentState, BACKGROUND_JOB_INTERNAL_ERROR);
-		}
+	bool BackgroundJobHandle::IsCancelRequested() const
+	{
+		return m_CancelRequested.load(std::memory_order_relaxed);
 	}
 
-	/*****************************/
-	/* private - class ImportJob */
-	/*****************************/
+	/**********************/
+	/* public - class Job */
+	/**********************/
+
+	BackgroundQueue::Job::Job(BackgroundJobHandlePtr handle, BACKGROUND_JOB_PRIORITY priority, JobFunction function) :
+		m_Handle(handle),
+		m_Priority(priority),
+		m_Function(function),
+		m_WaitCount(1),
+		m_DependencyFailed(false),
+		m_Finished(false),
+		m_Succeeded(false)
+	{
+		m_Handle->m_JobCount.fetch_add(1);
+	}
 
-	class BackgroundQueue::ImportJob final : public BackgroundQueue::Job
+	BackgroundQueue::Job::~Job()
+	{
+	}
+
+	/******************************/
+	/* private - class ImportTask */
+	/******************************/
+
+	// WuԂŋLC|[g̏
+	class BackgroundQueue::ImportTask final
 	{
 	public:
-		ImportJob(
+		ImportTask(
 			BackgroundJobHandlePtr handle,
 			LoggerPtr logger,
 			DeviceContextPtr deviceContext,
 			const wchar_t* pSourceFilePath, const ModelSourceConfig& sourceConfig, ModelSourcePtr source,
-			const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer) : Job(handle),
+			const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer) :
+			m_Handle(handle),
 			m_Logger(logger),
 			m_DeviceContext(deviceContext),
 			m_SourceFilePath(pSourceFilePath),
 			m_SourceConfig(sourceConfig),
 			m_Source(source),
 			m_RendererConfig(rendererConfig),
-			m_Renderer(renderer)
+			m_Renderer(renderer),
+			m_CacheEnable(false),
+			m_CacheLoaded(false)
 		{
 		}
 
-		~ImportJob()
+		~ImportTask()
 		{
 		}
 
-		BACKGROUND_JOB_STATE OnExecute() override
+		BACKGROUND_JOB_STATE LoadCache()
 		{
-			if (m_Source->Load(m_Logger, m_DeviceContext, m_SourceFilePath.c_str(), m_SourceConfig) == false)
+			collection::Vector<StringW> dependentFilePathes;
+			m_Source->GetDependentFilePathes(m_SourceFilePath.c_str(), dependentFilePathes);
+
+			m_CacheEnable = ImportCache::GetFilePath(m_SourceFilePath.c_str(), dependentFilePathes, m_SourceConfig, m_RendererConfig, m_CacheFilePath);
+
+			if (m_CacheEnable == true)
 			{
-				return BACKGROUND_JOB_ERROR;
+				if (m_Renderer->LoadCache(m_Logger, m_CacheFilePath.c_str(), m_SourceFilePath.c_str()) == true)
+				{
+					m_Logger->PrintW(Logger::TYPE_INFO, L"Loaded from the import cache : %s", m_CacheFilePath.c_str());
+
+					// LbVǂݍ߂ꍇAȍ~̃Wu͉Ȃ
+					m_Source = nullptr;
+					m_CacheLoaded = true;
+
+					SkeletalModel::Finish(m_Logger, m_Renderer);
+				}
+			}
+			else
+			{
+				m_Logger->PrintA(Logger::TYPE_WARNING, "The import cache is not available");
+			}
+
+			return BACKGROUND_JOB_COMPLETED;
+		}
+
+		BACKGROUND_JOB_STATE LoadSource()
+		{
+			if (m_CacheLoaded == true)
+			{
+				return BACKGROUND_JOB_COMPLETED;
 			}
 
-			if (m_Renderer->Load(m_Logger, m_Source, m_RendererConfig) == false)
+			if (m_Source->Load(m_Logger, m_DeviceContext, m_SourceFilePath.c_str(), m_SourceConfig, m_Handle) == false)
 			{
+				m_Source = nullptr;
 				return BACKGROUND_JOB_ERROR;
 			}
 
+			return BACKGROUND_JOB_COMPLETED;
+		}
+
+		BACKGROUND_JOB_STATE LoadRenderer()
+		{
+			if (m_CacheLoaded == true)
+			{
+				return BACKGROUND_JOB_COMPLETED;
+			}
+
+			// bV͍쐬Î珇ɃAbv[hAׂč쐬I_Ń\[X̒_A|S͉
+			bool result = m_Renderer->Load(m_Logger, m_Source, m_RendererConfig, m_Handle);
+
+			// c̃m[hA}eAsvȂ̂ŁALbVɏޑOɉ
+			m_Source = nullptr;
+
+			return (result == true) ? BACKGROUND_JOB_COMPLETED : BACKGROUND_JOB_ERROR;
+		}
+
+		// C|[g̊҂ɓǂݍނ߁AeNX`̃Wu̓C|[gƂ͕ʂ̃nh
+		BACKGROUND_JOB_STATE LoadTextures(BackgroundJobHandlePtr handle)
+		{
+			return (m_Renderer->LoadTextures(m_Logger, handle) == true) ? BACKGROUND_JOB_COMPLETED : BACKGROUND_JOB_ERROR;
+		}
+
+		BACKGROUND_JOB_STATE WriteCache()
+		{
+			if (m_CacheLoaded == true)
+			{
+				return BACKGROUND_JOB_COMPLETED;
+			}
+
+			// ݂ɎsĂC|[g͐Ă邽߁AxɂƂǂ߂
+
+			if (m_CacheEnable == true)
+			{
+				m_Handle->BeginStage(BACKGROUND_JOB_STAGE_WRITE_CACHE, 0);
+
+				StringW temporaryFilePath;
+				ImportCache::GetTemporaryFilePath(m_CacheFilePath.c_str(), temporaryFilePath);
+
+				if ((m_Renderer->SaveCache(m_Logger, temporaryFilePath.c_str()) == false) ||
+					(ImportCache::Commit(temporaryFilePath.c_str(), m_CacheFilePath.c_str()) == false))
+				{
+					DeleteFileW(temporaryFilePath.c_str());
+					m_Logger->PrintW(Logger::TYPE_WARNING, L"Failed to write the import cache : %s", m_CacheFilePath.c_str());
+				}
+			}
+
 			SkeletalModel::Finish(m_Logger, m_Renderer);
 
 			return BACKGROUND_JOB_COMPLETED;
 		}
 
 	private:
+		BackgroundJobHandlePtr m_Handle;
 		LoggerPtr m_Logger;
 		DeviceContextPtr m_DeviceContext;
 
@@ -114,6 +225,10 @@ namespace ve {
 
 		ModelRendererConfig m_RendererConfig;
 		SkeletalModelPtr m_Renderer;
+
+		StringW m_CacheFilePath;
+		bool m_CacheEnable;
+		bool m_CacheLoaded;
 	};
 
 	/****************************/
@@ -132,7 +247,11 @@ namespace ve {
 		return std::move(backgroundQueue);
 	}
 
-	BackgroundQueue::BackgroundQueue()
+	BackgroundQueue::BackgroundQueue() :
+		m_NextWorker(0),
+		m_QueuedCount(0),
+		m_JobCount(0),
+		m_Terminate(false)
 	{
 	}
 
@@ -143,40 +262,102 @@ namespace ve {
 	void BackgroundQueue::Terminate()
 	{
 		// ----------------------------------------------------------------------------------------------------
-		// XbhIʒm
+		// XbhIʒm ( 쐬ς݂̃WuׂďIĂI )
 		// ----------------------------------------------------------------------------------------------------
 
 		{
 			std::unique_lock<std::mutex> lock(m_Mutex);
-			m_Jobs.push_back(nullptr);
-			m_Condition.notify_one();
+			m_Terminate = true;
+			m_Condition.notify_all();
 		}
 
 		// ----------------------------------------------------------------------------------------------------
 		// XbhIҋ@
 		// ----------------------------------------------------------------------------------------------------
 
-		m_Thread.join();
+		auto it_begin = m_Workers.begin();
+		auto it_end = m_Workers.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			(*it)->thread.join();
+		}
+
+		m_Workers.clear();
+	}
+
+	BackgroundQueue::JobPtr BackgroundQueue::CreateJob(BackgroundJobHandlePtr handle, BACKGROUND_JOB_PRIORITY priority, JobFunction function)
+	{
+		VE_ASSERT(priority < BACKGROUND_JOB_PRIORITY_COUNT);
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobCount++;
+		}
+
+		return std::make_shared<BackgroundQueue::Job>(handle, priority, function);
+	}
+
+	void BackgroundQueue::AddDependency(JobPtr job, JobPtr dependency)
+	{
+		VE_ASSERT(job != dependency);
+
+		std::unique_lock<std::mutex> lock(dependency->m_Mutex);
+
+		if (dependency->m_Finished == false)
+		{
+			job->m_WaitCount.fetch_add(1);
+			dependency->m_Dependents.push_back(job);
+		}
+		else if (dependency->m_Succeeded == false)
+		{
+			job->m_DependencyFailed = true;
+		}
+	}
+
+	void BackgroundQueue::Submit(JobPtr job)
+	{
+		Release(BackgroundQueue::NO_WORKER, job);
 	}
 
 	BackgroundJobHandlePtr BackgroundQueue::AddImportJob(
 		LoggerPtr logger,
 		DeviceContextPtr deviceContext,
 		const wchar_t* pSourceFilePath, const ModelSourceConfig& sourceConfig, ModelSourcePtr source,
-		const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer)
+		const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer,
+		BACKGROUND_JOB_PRIORITY priority)
 	{
 		BackgroundJobHandlePtr handle = std::make_shared<BackgroundJobHandle>();
 
-		std::shared_ptr<BackgroundQueue::ImportJob> job = std::make_shared<BackgroundQueue::ImportJob>(
+		std::shared_ptr<BackgroundQueue::ImportTask> task = std::make_shared<BackgroundQueue::ImportTask>(
 			handle,
 			logger,
 			deviceContext,
 			pSourceFilePath, sourceConfig, source,
 			rendererConfig, renderer);
 
-		std::unique_lock<std::mutex> lock(m_Mutex);
-		m_Jobs.push_back(job);
-		m_Condition.notify_one();
+		// LbV݂̏̓C|[ǧʂɉeȂ߁ADx
+		BACKGROUND_JOB_PRIORITY writePriority = (priority > BACKGROUND_JOB_PRIORITY_LOW) ? static_cast<BACKGROUND_JOB_PRIORITY>(priority - 1) : priority;
+
+		JobPtr cacheJob = CreateJob(handle, priority, [task]() { return task->LoadCache(); });
+		JobPtr sourceJob = CreateJob(handle, priority, [task]() { return task->LoadSource(); });
+		JobPtr rendererJob = CreateJob(handle, priority, [task]() { return task->LoadRenderer(); });
+		JobPtr writeJob = CreateJob(handle, writePriority, [task]() { return task->WriteCache(); });
+
+		// }eA̓v[Xz_[ݒ肵Ԃō쐬邽߁AeNX`̓C|[gĂǂݍ܂
+		BackgroundJobHandlePtr textureHandle = std::make_shared<BackgroundJobHandle>();
+		JobPtr textureJob = CreateJob(textureHandle, priority, [task, textureHandle]() { return task->LoadTextures(textureHandle); });
+
+		AddDependency(sourceJob, cacheJob);
+		AddDependency(rendererJob, sourceJob);
+		AddDependency(writeJob, rendererJob);
+		AddDependency(textureJob, rendererJob);
+
+		Submit(textureJob);
+		Submit(writeJob);
+		Submit(rendererJob);
+		Submit(sourceJob);
+		Submit(cacheJob);
 
 		return handle;
 	}
@@ -187,42 +368,229 @@ namespace ve {
 
 	bool BackgroundQueue::Initialize()
 	{
-		m_Thread = std::thread(BackgroundQueue::ThreadEntry, this);
+		uint32_t workerCount = std::thread::hardware_concurrency() / 2;
+		if (workerCount == 0)
+		{
+			workerCount = 1;
+		}
+		else if (workerCount > BackgroundQueue::MAX_WORKER_COUNT)
+		{
+			workerCount = BackgroundQueue::MAX_WORKER_COUNT;
+		}
+
+		m_Workers.reserve(workerCount);
+
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			m_Workers.push_back(std::make_unique<BackgroundQueue::Worker>());
+		}
+
+		// ׂẴ[J[쐬ĂXbhJn ( Xbh͑̃[J[̃L[QƂ邽 )
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			m_Workers[i]->thread = std::thread(&BackgroundQueue::Process, this, i);
+		}
 
 		return true;
 	}
 
-	void BackgroundQueue::Process()
+	void BackgroundQueue::Process(uint32_t workerIndex)
 	{
 		bool continueLoop = true;
 
 		do
 		{
-			std::shared_ptr<BackgroundQueue::Job> job;
-
-			{
-				std::unique_lock<std::mutex> lock(m_Mutex);
-				m_Condition.wait(lock, [this]() {return m_Jobs.empty() == false; });
-
-				job = m_Jobs.front();
-				m_Jobs.pop_front();
-			}
+			JobPtr job = Pop(workerIndex);
 
 			if (job != nullptr)
 			{
-				job->Execute();
+				Execute(workerIndex, job);
 			}
 			else
 			{
-				continueLoop = false;
+				std::unique_lock<std::mutex> lock(m_Mutex);
+
+				// L[ɓĂWu̐̓L[ɒǉĂ瑝AoĂ猸邽߁AꎞIɎoȂƂ
+				m_Condition.wait(lock, [this]() { return (m_QueuedCount.load() > 0) || ((m_Terminate == true) && (m_JobCount == 0)); });
+
+				if (m_QueuedCount.load() == 0)
+				{
+					continueLoop = false;
+				}
 			}
 
 		} while (continueLoop == true);
 	}
 
-	void BackgroundQueue::ThreadEntry(void* pData)
+	BackgroundQueue::JobPtr BackgroundQueue::Pop(uint32_t workerIndex)
+	{
+		uint32_t workerCount = static_cast<uint32_t>(m_Workers.size());
+
+		// Dx̍̂ÃL[̐擪Ã[J[Xbh̃L[̖̏ɒT
+
+		for (int32_t priority = BACKGROUND_JOB_PRIORITY_COUNT - 1; priority >= 0; priority--)
+		{
+			for (uint32_t i = 0; i < workerCount; i++)
+			{
+				BackgroundQueue::Worker* pWorker = m_Workers[(workerIndex + i) % workerCount].get();
+				JobPtr job;
+
+				{
+					std::unique_lock<std::mutex> lock(pWorker->mutex);
+
+					auto& jobs = pWorker->jobs[priority];
+					if (jobs.empty() == false)
+					{
+						if (i == 0)
+						{
+							job = jobs.front();
+							jobs.pop_front();
+						}
+						else
+						{
+							job = jobs.back();
+							jobs.pop_back();
+						}
+					}
+				}
+
+				if (job != nullptr)
+				{
+					m_QueuedCount.fetch_sub(1);
+					return job;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	void BackgroundQueue::Push(uint32_t workerIndex, JobPtr job)
+	{
+		// [J[XbhȊOǉꂽWu͏ԂɐU蕪
+		if (workerIndex == BackgroundQueue::NO_WORKER)
+		{
+			workerIndex = m_NextWorker.fetch_add(1) % static_cast<uint32_t>(m_Workers.size());
+		}
+
+		BackgroundQueue::Worker* pWorker = m_Workers[workerIndex].get();
+
+		{
+			std::unique_lock<std::mutex> lock(pWorker->mutex);
+			pWorker->jobs[job->m_Priority].push_back(job);
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_QueuedCount.fetch_add(1);
+			m_Condition.notify_one();
+		}
+	}
+
+	void BackgroundQueue::Release(uint32_t workerIndex, JobPtr job)
+	{
+		if (job->m_WaitCount.fetch_sub(1) == 1)
+		{
+			Push(workerIndex, job);
+		}
+	}
+
+	void BackgroundQueue::Execute(uint32_t workerIndex, JobPtr job)
 	{
-		static_cast<BackgroundQueue*>(pData)->Process();
+		BackgroundJobHandlePtr handle = job->m_Handle;
+
+		// ----------------------------------------------------------------------------------------------------
+		// s
+		// ----------------------------------------------------------------------------------------------------
+
+		BACKGROUND_JOB_STATE currentState = BACKGROUND_JOB_PENDING;
+		handle->m_State.compare_exchange_strong(currentState, BACKGROUND_JOB_RUNNING);
+
+		BACKGROUND_JOB_STATE nextState;
+
+		if (job->m_DependencyFailed == true)
+		{
+			// nh̃WȕꍇAnhɂ͈ˑWu̎sL^Ă
+			nextState = (handle->IsCancelRequested() == false) ? BACKGROUND_JOB_ERROR : BACKGROUND_JOB_CANCELED;
+		}
+		else if (handle->IsCancelRequested() == true)
+		{
+			// JnOɃLZĂꍇ͎sȂ
+			nextState = BACKGROUND_JOB_CANCELED;
+		}
+		else
+		{
+			nextState = job->m_Function();
+
+			// LZɂ钆f͎sƂĕԂĂ
+			if ((nextState == BACKGROUND_JOB_ERROR) && (handle->IsCancelRequested() == true))
+			{
+				nextState = BACKGROUND_JOB_CANCELED;
+			}
+		}
+
+		// ֐Lv`Ă̂
+		job->m_Function = nullptr;
+
+		// ----------------------------------------------------------------------------------------------------
+		// nhXV
+		// ----------------------------------------------------------------------------------------------------
+
+		// ŏɎsWȕԂL^ĂAnh̃WuׂďI_Ńnh̏Ԃɂ
+		// ( ̃WusA܂͑ҋ@̂ɃnhI悤ɌȂ悤ɂ )
+
+		if (nextState != BACKGROUND_JOB_COMPLETED)
+		{
+			BACKGROUND_JOB_STATE failedState = BACKGROUND_JOB_PENDING;
+			handle->m_FailedState.compare_exchange_strong(failedState, nextState);
+		}
+
+		if (handle->m_JobCount.fetch_sub(1) == 1)
+		{
+			BACKGROUND_JOB_STATE failedState = handle->m_FailedState.load();
+			handle->m_State.store((failedState != BACKGROUND_JOB_PENDING) ? failedState : BACKGROUND_JOB_COMPLETED);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ˑĂWu
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<JobPtr> dependents;
+
+		{
+			std::unique_lock<std::mutex> lock(job->m_Mutex);
+			job->m_Finished = true;
+			job->m_Succeeded = (nextState == BACKGROUND_JOB_COMPLETED);
+			dependents.swap(job->m_Dependents);
+		}
+
+		auto it_begin = dependents.begin();
+		auto it_end = dependents.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			if (job->m_Succeeded == false)
+			{
+				(*it)->m_DependencyFailed = true;
+			}
+
+			// ꂽWu͂̃[J[Xbh̃L[ɓ
+			Release(workerIndex, (*it));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// IĂȂWu̐XV
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobCount--;
+
+			if ((m_Terminate == true) && (m_JobCount == 0))
+			{
+				m_Condition.notify_all();
+			}
+		}
 	}
 
-}
\ No newline at end of file
+}
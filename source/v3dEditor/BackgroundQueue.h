@@ -3,6 +3,7 @@
 #include <condition_variable>
 #include <thread>
 #include <atomic>
+#include <functional>
 #include "IModelSource.h"
 
 namespace ve {
@@ -17,6 +18,19 @@ namespace ve {
 
 		BACKGROUND_JOB_ERROR = 3,
 		BACKGROUND_JOB_INTERNAL_ERROR = 4,
+		BACKGROUND_JOB_CANCELED = 5,
+	};
+
+	// A̒Pʂ̓Xe[WA\[XɂĈقȂ ( \ɂ͊gp )
+	enum BACKGROUND_JOB_STAGE
+	{
+		BACKGROUND_JOB_STAGE_NONE = 0,
+		BACKGROUND_JOB_STAGE_READ_FILE = 1, // % A`N
+		BACKGROUND_JOB_STAGE_LOAD_SOURCE = 2, // m[hAZOgAv~eBu
+		BACKGROUND_JOB_STAGE_LOAD_TEXTURE = 3, // eNX`
+		BACKGROUND_JOB_STAGE_BUILD_MESH = 4, // |S
+		BACKGROUND_JOB_STAGE_WRITE_CACHE = 5,
+		BACKGROUND_JOB_STAGE_LOAD_MODEL = 6, // f
 	};
 
 	// ----------------------------------------------------------------------------------------------------
@@ -30,17 +44,50 @@ namespace ve {
 		BACKGROUND_JOB_STATE GetState();
 		bool IsFinished();
 
+		// i ( \Ɏgp邾Ȃ̂ŁAXe[WAA͂ꂼƗčXV )
+		void BeginStage(BACKGROUND_JOB_STAGE stage, uint64_t totalCount);
+		void AddProgress(uint64_t count);
+		BACKGROUND_JOB_STAGE GetStage() const;
+		void GetProgress(uint64_t& doneCount, uint64_t& totalCount) const;
+
+		// LZ ( Wu͏̋؂ IsCancelRequested 𒲂ׁAsƂĒf )
+		void Cancel();
+		bool IsCancelRequested() const;
+
 	private:
 		std::atomic<BACKGROUND_JOB_STATE> m_State;
+		std::atomic<BACKGROUND_JOB_STAGE> m_Stage;
+		std::atomic<uint64_t> m_DoneCount;
+		std::atomic<uint64_t> m_TotalCount;
+		std::atomic<bool> m_CancelRequested;
+		std::atomic<uint32_t> m_JobCount; // IĂȂWu̐
+		std::atomic<BACKGROUND_JOB_STATE> m_FailedState; // ŏɎsWȕ ( sĂȂꍇ BACKGROUND_JOB_PENDING )
 
 		friend class BackgroundQueue;
 	};
 
 	// ----------------------------------------------------------------------------------------------------
 
+	enum BACKGROUND_JOB_PRIORITY
+	{
+		BACKGROUND_JOB_PRIORITY_LOW = 0,
+		BACKGROUND_JOB_PRIORITY_NORMAL = 1,
+		BACKGROUND_JOB_PRIORITY_HIGH = 2,
+
+		BACKGROUND_JOB_PRIORITY_COUNT = 3,
+	};
+
+	// ----------------------------------------------------------------------------------------------------
+
+	// [J[XbhƂɃL[ÃL[̏ꍇ͑̃[J[Xbh̃L[瓐
+	// Wu CreateJob ō쐬AAddDependency ňˑWuݒ肵Ă Submit Œǉ
 	class BackgroundQueue final
 	{
 	public:
+		class Job;
+		typedef std::shared_ptr<Job> JobPtr;
+		typedef std::function<BACKGROUND_JOB_STATE()> JobFunction;
+
 		static BackgroundQueuePtr Create();
 
 		BackgroundQueue();
@@ -48,40 +95,75 @@ namespace ve {
 
 		void Terminate();
 
+		// nh̓Wu쐬ĂAׂďI_ŊɂȂ ( nh̃Wu͂܂Ƃ߂č쐬Ăǉ邱 )
+		JobPtr CreateJob(BackgroundJobHandlePtr handle, BACKGROUND_JOB_PRIORITY priority, JobFunction function);
+		// ˑWusꍇAWu͎sꂸɎs
+		void AddDependency(JobPtr job, JobPtr dependency);
+		void Submit(JobPtr job);
+
+		// \[X̓ǂݍ݁AbV̍쐬ALbV݂̏ˑWuƂĒǉ ( eNX`͊ǂݍ܂ )
 		BackgroundJobHandlePtr AddImportJob(
 			LoggerPtr logger,
 			DeviceContextPtr deviceContext,
 			const wchar_t* pSourceFilePath, const ModelSourceConfig& sourceConfig, ModelSourcePtr source,
-			const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer);
+			const ModelRendererConfig& rendererConfig, SkeletalModelPtr renderer,
+			BACKGROUND_JOB_PRIORITY priority = BACKGROUND_JOB_PRIORITY_NORMAL);
 
 		VE_DECLARE_ALLOCATOR
 
-	private:
-		class Job
+		class Job final
 		{
 		public:
-			Job(BackgroundJobHandlePtr handle);
-			virtual ~Job();
-
-			void Execute();
+			Job(BackgroundJobHandlePtr handle, BACKGROUND_JOB_PRIORITY priority, JobFunction function);
+			~Job();
 
-		protected:
+		private:
 			BackgroundJobHandlePtr m_Handle;
+			BACKGROUND_JOB_PRIORITY m_Priority;
+			JobFunction m_Function;
+
+			// ĂȂˑWu̐ + 1 ( Submit ܂ )
+			std::atomic<uint32_t> m_WaitCount;
+			std::atomic<bool> m_DependencyFailed;
+
+			std::mutex m_Mutex;
+			bool m_Finished;
+			bool m_Succeeded;
+			collection::Vector<JobPtr> m_Dependents;
+
+			friend class BackgroundQueue;
+		};
+
+	private:
+		// [J[Xbh̍ő吔 ( Wu̓łXbhgp邽߁A_RA̐̔A̐ɂƂǂ߂ )
+		static constexpr uint32_t MAX_WORKER_COUNT = 4;
+		static constexpr uint32_t NO_WORKER = ~0U;
 
-			virtual BACKGROUND_JOB_STATE OnExecute() = 0;
+		struct Worker
+		{
+			std::thread thread;
+			std::mutex mutex;
+			collection::Array1<collection::List<JobPtr>, BACKGROUND_JOB_PRIORITY_COUNT> jobs;
 		};
 
-		class ImportJob;
+		class ImportTask;
+
+		collection::Vector<std::unique_ptr<BackgroundQueue::Worker>> m_Workers;
+		std::atomic<uint32_t> m_NextWorker;
 
-		std::thread m_Thread;
+		// L[ɓĂWu̐A쐬ďIĂȂWu̐
 		std::mutex m_Mutex;
 		std::condition_variable m_Condition;
-		collection::List<std::shared_ptr<Job>> m_Jobs;
+		std::atomic<uint64_t> m_QueuedCount;
+		uint64_t m_JobCount;
+		bool m_Terminate;
 
 		bool Initialize();
-		void Process();
-
-		static void ThreadEntry(void* pData);
+		void Process(uint32_t workerIndex);
+		JobPtr Pop(uint32_t workerIndex);
+		void Push(uint32_t workerIndex, JobPtr job);
+		void Release(uint32_t workerIndex, JobPtr job);
+		void Execute(uint32_t workerIndex, JobPtr job);
 	};
 
 }
\ No newline at end of file
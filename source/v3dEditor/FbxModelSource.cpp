@@ -1,6 +1,9 @@
 #include "FbxModelSource.h"
 #include "DeviceContext.h"
 #include "Logger.h"
+#include "BackgroundQueue.h"
+#include "ParallelTask.h"
+#include <atomic>
 
 namespace ve {
 
@@ -18,9 +21,10 @@ namespace ve {
 	{
 	}
 
-	bool FbxModelSource::Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config)
+	bool FbxModelSource::Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle)
 	{
 		m_FilePath = pFilePath;
+		m_Handle = handle;
 
 		FbxManager* pSdkManager = FbxManager::Create();
 		if (pSdkManager == nullptr)
@@ -59,6 +63,10 @@ namespace ve {
 			return false;
 		}
 
+		// C|[g̐iʒmALZꂽ璆f
+		m_Handle->BeginStage(BACKGROUND_JOB_STAGE_READ_FILE, 100);
+		pImporter->SetProgressCallback(FbxModelSource::ImportProgressCallback, m_Handle.get());
+
 		FbxScene* pScene = FbxScene::Create(pSdkManager, "");
 		if (pScene == nullptr)
 		{
@@ -94,6 +102,11 @@ namespace ve {
 		return true;
 	}
 
+	void FbxModelSource::GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes)
+	{
+		// WIgׂ͂ FBX t@CɊ܂܂Ă
+	}
+
 	const wchar_t* FbxModelSource::GetFilePath() const
 	{
 		return m_FilePath.c_str();
@@ -104,6 +117,11 @@ namespace ve {
 		return m_Materials;
 	}
 
+	const collection::Vector<IModelSource::Vertex>& FbxModelSource::GetVertices() const
+	{
+		return m_Vertices;
+	}
+
 	const collection::Vector<IModelSource::Polygon>& FbxModelSource::GetPolygons() const
 	{
 		return m_Polygons;
@@ -124,6 +142,12 @@ namespace ve {
 		return m_MeshNodeCount;
 	}
 
+	void FbxModelSource::ReleaseGeometry()
+	{
+		collection::Vector<IModelSource::Vertex>().swap(m_Vertices);
+		collection::Vector<IModelSource::Polygon>().swap(m_Polygons);
+	}
+
 	bool FbxModelSource::Load(LoggerPtr logger, FbxScene* pFbxScene, const ModelSourceConfig& config)
 	{
 		FbxNode* pFbxRootNode = pFbxScene->GetRootNode();
@@ -136,11 +160,48 @@ namespace ve {
 		// m[h[h
 		// ----------------------------------------------------------------------------------------------------
 
+		m_Handle->BeginStage(BACKGROUND_JOB_STAGE_LOAD_SOURCE, static_cast<uint64_t>(pFbxScene->GetNodeCount()));
+
 		if (LoadNodes(logger, pFbxRootNode, -1, config) == false)
 		{
 			return false;
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// {[̃{bNXɍ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		if (m_Shapes.empty() == false)
+		{
+			std::atomic<size_t> nextShape(0);
+
+			auto createFunc = [this, &nextShape]()
+			{
+				size_t shapeIndex;
+
+				while ((shapeIndex = nextShape.fetch_add(1)) < m_Shapes.size())
+				{
+					FbxModelSource::Shape& shape = m_Shapes[shapeIndex];
+					IModelSource::Box& box = m_Nodes[shape.nodeIndex].boxes[shape.boxIndex];
+
+					FbxModelSource::CreateOBB(shape.points, box.center, box.axis[0], box.axis[1], box.axis[2], box.halfExtent);
+
+					// 쐬I_͕svɂȂ
+					collection::Vector<glm::vec3>().swap(shape.points);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(1U)), m_Shapes.size(), createFunc);
+
+			// ĂяõXbh쐬ɉ
+			createFunc();
+
+			task.Wait();
+
+			collection::Vector<FbxModelSource::Shape>().swap(m_Shapes);
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// gXtH[
 		// ----------------------------------------------------------------------------------------------------
@@ -166,10 +227,8 @@ namespace ve {
 
 				for (auto it_bone = it_bone_begin; it_bone != it_bone_end; ++it_bone)
 				{
-					auto it_bone_node = std::find_if(it_node_begin, it_node_end, [it_bone](const IModelSource::Node& node) { return (node.name.compare(it_bone->nodeName) == 0); });
-					VE_ASSERT(it_bone_node != m_Nodes.end());
-
-					it_bone->nodeIndex = static_cast<int32_t>(std::distance(it_node_begin, it_bone_node));
+					it_bone->nodeIndex = FindNodeIndex(it_bone->nodeName.c_str());
+					VE_ASSERT(it_bone->nodeIndex >= 0);
 				}
 			}
 		}
@@ -261,6 +320,11 @@ namespace ve {
 
 	bool FbxModelSource::LoadNodes(LoggerPtr logger, FbxNode* pFbxNode, int32_t parentNodeIndex, const ModelSourceConfig& config)
 	{
+		if (m_Handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
 		const char* pName = pFbxNode->GetName();
 
 		const FbxDouble3& localTranslation = pFbxNode->LclTranslation;
@@ -310,6 +374,8 @@ namespace ve {
 		node.localScaling.x = static_cast<float>(localScaling.mData[0]);
 		node.localScaling.y = static_cast<float>(localScaling.mData[1]);
 		node.localScaling.z = static_cast<float>(localScaling.mData[2]);
+		node.firstVertexIndex = 0;
+		node.vertexCount = 0;
 		node.firstPolygonIndex = 0;
 		node.polygonCount = 0;
 		node.hasUV = false;
@@ -345,6 +411,11 @@ namespace ve {
 				{
 					m_MeshNodeCount++;
 				}
+				else if (m_Handle->IsCancelRequested() == true)
+				{
+					logger->PopIndent();
+					return false;
+				}
 				else
 				{
 					m_Polygons.resize(prePolygonCount);
@@ -362,6 +433,12 @@ namespace ve {
 		}
 
 		m_Nodes.push_back(node);
+		m_Handle->AddProgress(1);
+
+		// Õm[hꍇ͐Ɍ̂D悷
+		FbxModelSource::NodeNameKey nodeNameKey;
+		nodeNameKey.name = node.name;
+		m_NodeIndexMap.insert(std::make_pair(nodeNameKey, nodeIndex));
 
 		logger->PopIndent();
 
@@ -378,6 +455,20 @@ namespace ve {
 		return true;
 	}
 
+	int32_t FbxModelSource::FindNodeIndex(const wchar_t* pName) const
+	{
+		FbxModelSource::NodeNameKey key;
+		key.name = pName;
+
+		auto it = m_NodeIndexMap.find(key);
+		if (it == m_NodeIndexMap.end())
+		{
+			return -1;
+		}
+
+		return it->second;
+	}
+
 	bool FbxModelSource::LoadNodeMaterial(FbxNode* pFbxNode, FbxModelSource::Node& node, const ModelSourceConfig& config)
 	{
 		int32_t fbxMaterialCount = pFbxNode->GetMaterialCount();
@@ -533,8 +624,8 @@ namespace ve {
 		// {[XgA_̃EFCgXg쐬
 		// ----------------------------------------------------------------------------------------------------
 
-		collection::Vector<collection::Vector<FbxModelSource::BoneWeight>> vertexBoneWeights;
-		vertexBoneWeights.resize(controlPointCount);
+		collection::Vector<FbxModelSource::VertexWeight> vertexWeights;
+		vertexWeights.resize(controlPointCount, FbxModelSource::VertexWeight{});
 
 		int32_t deformerCount = pFbxMesh->GetDeformerCount();
 
@@ -592,12 +683,7 @@ namespace ve {
 
 				for (int32_t k = 0; k < indicesCount; k++)
 				{
-					FbxModelSource::BoneWeight weight;
-
-					weight.index = boneIndex;
-					weight.value = static_cast<float>(pWeights[k]);
-
-					vertexBoneWeights[pIndices[k]].push_back(weight);
+					FbxModelSource::InsertBoneWeight(vertexWeights[pIndices[k]], boneIndex, static_cast<float>(pWeights[k]));
 				}
 			}
 		}
@@ -607,28 +693,15 @@ namespace ve {
 		// ----------------------------------------------------------------------------------------------------
 
 		{
-			auto it_begin = vertexBoneWeights.begin();
-			auto it_end = vertexBoneWeights.end();
+			auto it_begin = vertexWeights.begin();
+			auto it_end = vertexWeights.end();
 
 			for (auto it = it_begin; it != it_end; ++it)
 			{
-				auto& weights = *it;
+				auto& weights = it->weights;
 
-				if (weights.empty() == false)
+				if (it->count > 0)
 				{
-					size_t weightCount = weights.size();
-					if (weightCount < 4)
-					{
-						size_t addCount = 4 - weightCount;
-						for (size_t i = 0; i < addCount; i++)
-						{
-							weights.push_back(FbxModelSource::BoneWeight{});
-						}
-					}
-
-					std::sort(weights.begin(), weights.end(), [](const FbxModelSource::BoneWeight& lhs, const FbxModelSource::BoneWeight& rhs) { return (lhs.value > rhs.value); });
-					weights.resize(4);
-
 					auto it_w_begin = weights.begin();
 					auto it_w_end = weights.end();
 
@@ -648,8 +721,6 @@ namespace ve {
 				}
 				else
 				{
-					weights.resize(4);
-
 					weights[0].index = 0;
 					weights[1].index = 0;
 					weights[2].index = 0;
@@ -702,12 +773,12 @@ namespace ve {
 
 			bonePoints.resize(boneCount);
 
-			size_t pointCount = vertexBoneWeights.size();
+			size_t pointCount = vertexWeights.size();
 
 			for (size_t i = 0; i < pointCount; i++)
 			{
 				auto& point = controlPoints[i];
-				auto& weights = vertexBoneWeights[i];
+				auto& weights = vertexWeights[i].weights;
 
 				for (size_t j = 0; (j < 4) && (VE_FLOAT_IS_ZERO(weights[j].value) == false); j++)
 				{
@@ -770,12 +841,12 @@ namespace ve {
 
 			if (node.bones.size() != boneCount)
 			{
-				auto it_begin = vertexBoneWeights.begin();
-				auto it_end = vertexBoneWeights.end();
+				auto it_begin = vertexWeights.begin();
+				auto it_end = vertexWeights.end();
 
 				for (auto it = it_begin; it != it_end; ++it)
 				{
-					auto& weights = *it;
+					auto& weights = it->weights;
 
 					auto it_w_begin = weights.begin();
 					auto it_w_end = weights.end();
@@ -811,8 +882,13 @@ namespace ve {
 		// {bNX쐬
 		// ----------------------------------------------------------------------------------------------------
 
+		// {[̃{bNX̓{[̐ƎԂ邽߁AbV[hIĂɍ쐬
+		collection::Vector<FbxModelSource::Shape> shapes;
+
 		if (node.bones.empty() == false)
 		{
+			shapes.reserve(bonePoints.size());
+
 			auto it_begin = bonePoints.begin();
 			auto it_end = bonePoints.end();
 
@@ -820,9 +896,13 @@ namespace ve {
 			{
 				VE_ASSERT(it->empty() == false);
 
-				IModelSource::Box box;
-				FbxModelSource::CreateOBB(*it, box.center, box.axis[0], box.axis[1], box.axis[2], box.halfExtent);
-				node.boxes.push_back(box);
+				FbxModelSource::Shape shape;
+				shape.nodeIndex = nodeIndex;
+				shape.boxIndex = static_cast<uint32_t>(node.boxes.size());
+				shape.points.swap(*it);
+				shapes.push_back(std::move(shape));
+
+				node.boxes.push_back(IModelSource::Box{});
 			}
 		}
 		else
@@ -854,28 +934,34 @@ namespace ve {
 		// |SXg쐬
 		// ----------------------------------------------------------------------------------------------------
 
-		FbxModelSource::PolygonVertexRefVector polygonVertexRefs;
-		polygonVertexRefs.resize(controlPointCount);
+		if (m_Handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// UVA@̓|S̒_Ƃɐݒ肳邽߁A|S̒_ƂɓWJĂAŋLł钸_܂Ƃ߂
 
 		size_t firstPolygonIndex = m_Polygons.size();
-		bool vertexWeightEnable = (vertexBoneWeights.empty() == false);
+		bool vertexWeightEnable = (vertexWeights.empty() == false);
+
+		collection::Vector<IModelSource::Vertex> polygonVertices;
+		polygonVertices.resize(static_cast<size_t>(polygonCount) * 3, IModelSource::Vertex{});
 
-		uint32_t totalVertexCount = 0;
+		collection::Vector<int32_t> polygonControlPoints;
+		polygonControlPoints.resize(static_cast<size_t>(polygonCount) * 3, 0);
 
 		for (int32_t i = 0; i < polygonCount; i++)
 		{
 			IModelSource::Polygon polygon{};
 			polygon.materialIndex = -1;
 
-			auto& vertices = polygon.vertices;
-
 			int32_t vertexCount = pFbxMesh->GetPolygonSize(i);
 			VE_ASSERT(vertexCount == 3);
 
 			for (int32_t j = 0; j < vertexCount; j++)
 			{
 				int32_t controlPointIndex = pFbxMesh->GetPolygonVertex(i, j);
-				Vertex* pVertex = &vertices[j];
+				Vertex* pVertex = &polygonVertices[i * 3 + j];
 
 				pVertex->pos = controlPoints[controlPointIndex];
 				pVertex->uv = glm::vec2(0.0f);
@@ -885,8 +971,7 @@ namespace ve {
 
 				if (vertexWeightEnable == true)
 				{
-					const auto& weights = vertexBoneWeights[controlPointIndex];
-					VE_ASSERT(weights.size() == 4);
+					const auto& weights = vertexWeights[controlPointIndex].weights;
 
 					for (uint32_t k = 0; k < 4; k++)
 					{
@@ -895,47 +980,98 @@ namespace ve {
 					}
 				}
 
-				std::array<int32_t, 2> ref = { i, j };
-				polygonVertexRefs[controlPointIndex].push_back(ref);
+				polygonControlPoints[i * 3 + j] = controlPointIndex;
 			}
 
-			totalVertexCount += vertexCount;
-
 			m_Polygons.push_back(polygon);
 		}
 
 		// ----------------------------------------------------------------------------------------------------
-		// UV |Sɐݒ
+		// Rg[|Cg̃|S̒_̎QƂ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		FbxModelSource::PolygonVertexRefVector polygonVertexRefs;
+
+		{
+			/********************************************/
+			/* Rg[|Cg̎QƂ̐𐔂 */
+			/********************************************/
+
+			polygonVertexRefs.offsets.resize(controlPointCount + 1, 0);
+
+			for (int32_t i = 0; i < polygonCount; i++)
+			{
+				int32_t vertexCount = pFbxMesh->GetPolygonSize(i);
+
+				for (int32_t j = 0; j < vertexCount; j++)
+				{
+					polygonVertexRefs.offsets[pFbxMesh->GetPolygonVertex(i, j) + 1]++;
+				}
+			}
+
+			for (int32_t i = 0; i < controlPointCount; i++)
+			{
+				polygonVertexRefs.offsets[i + 1] += polygonVertexRefs.offsets[i];
+			}
+
+			/**************/
+			/* QƂi[ */
+			/**************/
+
+			collection::Vector<uint32_t> cursors(polygonVertexRefs.offsets.begin(), polygonVertexRefs.offsets.end() - 1);
+
+			polygonVertexRefs.refs.resize(polygonVertexRefs.offsets.back());
+
+			for (int32_t i = 0; i < polygonCount; i++)
+			{
+				int32_t vertexCount = pFbxMesh->GetPolygonSize(i);
+
+				for (int32_t j = 0; j < vertexCount; j++)
+				{
+					uint32_t& cursor = cursors[pFbxMesh->GetPolygonVertex(i, j)];
+
+					polygonVertexRefs.refs[cursor][0] = i;
+					polygonVertexRefs.refs[cursor][1] = j;
+					cursor++;
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// UV |S̒_ɐݒ
 		// ----------------------------------------------------------------------------------------------------
 
+		if (m_Handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
 		if (pFbxUVs != nullptr)
 		{
-			if (LoadMeshUV(pFbxUVs, firstPolygonIndex, polygonCount, polygonVertexRefs) == false)
+			if (LoadMeshUV(pFbxUVs, polygonVertices.data(), polygonCount, polygonVertexRefs) == false)
 			{
 				return false;
 			}
 		}
 
 		// ----------------------------------------------------------------------------------------------------
-		// @|Sɐݒ
+		// @|S̒_ɐݒ
 		// ----------------------------------------------------------------------------------------------------
 
 		if (pFbxNormals != nullptr)
 		{
-			if (LoadMeshNormal(pFbxNormals, firstPolygonIndex, polygonCount, polygonVertexRefs) == false)
+			if (LoadMeshNormal(pFbxNormals, polygonVertices.data(), polygonCount, polygonVertexRefs) == false)
 			{
 				return false;
 			}
 		}
 		else
 		{
-			IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-			IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+			IModelSource::Vertex* pVertices = polygonVertices.data();
+			IModelSource::Vertex* pVerticesEnd = pVertices + polygonVertices.size();
 
-			while (pPolygon != pPolygonEnd)
+			while (pVertices != pVerticesEnd)
 			{
-				IModelSource::Vertex* pVertices = &pPolygon->vertices[0];
-
 				glm::vec3 ab;
 				glm::vec3 bc;
 
@@ -956,98 +1092,81 @@ namespace ve {
 				pVertices[1].normal = normal;
 				pVertices[2].normal = normal;
 
-				pPolygon++;
+				pVertices += 3;
 			}
 		}
 
 		// ----------------------------------------------------------------------------------------------------
-		// ڐԂ߂
+		// Rg[|CgAUVA@|S̒_܂Ƃ߂
 		// ----------------------------------------------------------------------------------------------------
 
-		if(pFbxUVs != nullptr)
+		size_t firstVertexIndex = m_Vertices.size();
+
 		{
+			collection::HashMap<FbxModelSource::VertexKey, uint32_t> vertexMap;
+			vertexMap.reserve(controlPointCount);
+
 			IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-			IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+			size_t polygonVertexCount = polygonVertices.size();
 
-			while (pPolygon != pPolygonEnd)
+			for (size_t i = 0; i < polygonVertexCount; i++)
 			{
-				IModelSource::Vertex* pVertices[3] =
+				if (((i % FbxModelSource::CANCEL_CHECK_INTERVAL) == 0) && (m_Handle->IsCancelRequested() == true))
 				{
-					&(pPolygon->vertices[0]),
-					&(pPolygon->vertices[1]),
-					&(pPolygon->vertices[2]),
-				};
+					return false;
+				}
 
-				glm::vec3 p0 = pVertices[0]->pos;
-				glm::vec3 p1 = pVertices[1]->pos;
-				glm::vec3 p2 = pVertices[2]->pos;
+				const IModelSource::Vertex& polygonVertex = polygonVertices[i];
 
-				glm::vec2 t0 = pVertices[0]->uv;
-				glm::vec2 t1 = pVertices[1]->uv;
-				glm::vec2 t2 = pVertices[2]->uv;
+				FbxModelSource::VertexKey key;
+				key.controlPoint = polygonControlPoints[i];
+				key.uv = polygonVertex.uv;
+				key.normal = polygonVertex.normal;
 
-				glm::vec3 cp0[3] =
+				auto ret = vertexMap.emplace(key, static_cast<uint32_t>(m_Vertices.size()));
+				if (ret.second == true)
 				{
-					glm::vec3(p0.x, t0.x, t0.y),
-					glm::vec3(p0.y, t0.x, t0.y),
-					glm::vec3(p0.z, t0.x, t0.y),
-				};
+					m_Vertices.push_back(polygonVertex);
+				}
 
-				glm::vec3 cp1[3] =
-				{
-					glm::vec3(p1.x, t1.x, t1.y),
-					glm::vec3(p1.y, t1.x, t1.y),
-					glm::vec3(p1.z, t1.x, t1.y),
-				};
+				pPolygon[i / 3].indices[i % 3] = ret.first->second;
+			}
 
-				glm::vec3 cp2[3] =
-				{
-					glm::vec3(p2.x, t2.x, t2.y),
-					glm::vec3(p2.y, t2.x, t2.y),
-					glm::vec3(p2.z, t2.x, t2.y),
-				};
+			if (m_Vertices.size() > UINT32_MAX)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Mesh(%s) : Too many vertices", pFbxMesh->GetName());
+				return false;
+			}
+		}
 
-				glm::vec3 v1;
-				glm::vec3 v2;
-				glm::vec3 abc;
+		// WJ_͂gpȂ
+		collection::Vector<IModelSource::Vertex>().swap(polygonVertices);
+		collection::Vector<int32_t>().swap(polygonControlPoints);
 
-				float u[3];
-				float v[3];
+		size_t vertexCount = m_Vertices.size() - firstVertexIndex;
 
-				for (uint32_t i = 0; i < 3; i++)
-				{
-					v1 = cp1[i] - cp0[i];
-					v2 = cp2[i] - cp1[i];
+		// ----------------------------------------------------------------------------------------------------
+		// ڐԂ߂
+		// ----------------------------------------------------------------------------------------------------
 
-					abc = glm::cross(v1, v2);
+		if (pFbxUVs != nullptr)
+		{
+			IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
+			IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
 
-					if ((-VE_FLOAT_EPSILON <= abc.x) && (VE_FLOAT_EPSILON >= abc.x))
-					{
-						//kނĂ|S
-						u[i] = 1.0f;
-						v[i] = 1.0f;
-					}
-					else
-					{
-						u[i] = (abc.y / abc.x);
-						v[i] = (abc.z / abc.x);
-					}
-				}
+			while (pPolygon != pPolygonEnd)
+			{
+				FbxModelSource::ComputeTangentSpace(m_Vertices.data(), *pPolygon);
+				pPolygon++;
+			}
 
-				for (uint32_t i = 0; i < 3; i++)
-				{
-					pVertices[i]->tangent.x += u[0];
-					pVertices[i]->tangent.y += u[1];
-					pVertices[i]->tangent.z += u[2];
-					pVertices[i]->tangent = glm::normalize(pVertices[i]->tangent);
-
-					pVertices[i]->binormal.x += v[0];
-					pVertices[i]->binormal.y += v[1];
-					pVertices[i]->binormal.z += v[2];
-					pVertices[i]->binormal = glm::normalize(pVertices[i]->binormal);
-				}
+			IModelSource::Vertex* pVertex = m_Vertices.data() + firstVertexIndex;
+			IModelSource::Vertex* pVertexEnd = pVertex + vertexCount;
 
-				pPolygon++;
+			while (pVertex != pVertexEnd)
+			{
+				FbxModelSource::NormalizeTangentSpace(*pVertex);
+				pVertex++;
 			}
 		}
 
@@ -1074,35 +1193,30 @@ namespace ve {
 
 			while (pPolygon != pPolygonEnd)
 			{
-				IModelSource::Vertex* vertices = &pPolygon->vertices[0];
+				uint32_t temp = pPolygon->indices[0];
+				pPolygon->indices[0] = pPolygon->indices[2];
+				pPolygon->indices[2] = temp;
+
+				pPolygon++;
+			}
 
-				IModelSource::Vertex temp = vertices[0];
-				vertices[0] = vertices[2];
-				vertices[2] = temp;
+			// _͋LĂ邽߁AUV ͒_ƂɈx]
+			IModelSource::Vertex* pVertex = m_Vertices.data() + firstVertexIndex;
+			IModelSource::Vertex* pVertexEnd = pVertex + vertexCount;
 
+			while (pVertex != pVertexEnd)
+			{
 				if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_U)
 				{
-					IModelSource::Vertex* pVertex = &vertices[0];
-					IModelSource::Vertex* pVertexEnd = pVertex + 3;
-					while (pVertex != pVertexEnd)
-					{
-						pVertex->uv.x = 1.0f - pVertex->uv.x;
-						pVertex++;
-					}
+					pVertex->uv.x = 1.0f - pVertex->uv.x;
 				}
 
 				if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_V)
 				{
-					IModelSource::Vertex* pVertex = &vertices[0];
-					IModelSource::Vertex* pVertexEnd = pVertex + 3;
-					while (pVertex != pVertexEnd)
-					{
-						pVertex->uv.y = 1.0f - pVertex->uv.y;
-						pVertex++;
-					}
+					pVertex->uv.y = 1.0f - pVertex->uv.y;
 				}
 
-				pPolygon++;
+				pVertex++;
 			}
 		}
 
@@ -1110,16 +1224,20 @@ namespace ve {
 		// m[h̐ݒ
 		// ----------------------------------------------------------------------------------------------------
 
+		node.firstVertexIndex = static_cast<uint32_t>(firstVertexIndex);
+		node.vertexCount = static_cast<uint32_t>(vertexCount);
 		node.firstPolygonIndex = static_cast<uint32_t>(firstPolygonIndex);
 		node.polygonCount = polygonCount;
 		node.hasUV = (pFbxUVs != nullptr);
 
+		m_Shapes.insert(m_Shapes.end(), std::make_move_iterator(shapes.begin()), std::make_move_iterator(shapes.end()));
+
 		// ----------------------------------------------------------------------------------------------------
 
 		return true;
 	}
 
-	bool FbxModelSource::LoadMeshUV(FbxLayerElementUV* pFbxUVs, size_t firstPolygonIndex, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs)
+	bool FbxModelSource::LoadMeshUV(FbxLayerElementUV* pFbxUVs, IModelSource::Vertex* pPolygonVertices, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs)
 	{
 		FbxLayerElement::EMappingMode fbxMappingMode = pFbxUVs->GetMappingMode();
 		FbxLayerElement::EReferenceMode fbxReferenceMode = pFbxUVs->GetReferenceMode();
@@ -1129,14 +1247,14 @@ namespace ve {
 			if (fbxReferenceMode == FbxLayerElement::eDirect)
 			{
 				auto& directArray = pFbxUVs->GetDirectArray();
-				VE_ASSERT(directArray.GetCount() == polygonVertexRefs.size());
+				VE_ASSERT(directArray.GetCount() == polygonVertexRefs.GetControlPointCount());
 				return false;
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
 			{
 				auto& directArray = pFbxUVs->GetDirectArray();
 				auto& indexArray = pFbxUVs->GetIndexArray();
-				VE_ASSERT(indexArray.GetCount() == polygonVertexRefs.size());
+				VE_ASSERT(indexArray.GetCount() == polygonVertexRefs.GetControlPointCount());
 				return false;
 			}
 			else
@@ -1151,14 +1269,14 @@ namespace ve {
 				auto& directArray = pFbxUVs->GetDirectArray();
 				VE_ASSERT(directArray.GetCount() == polygonCount * 3);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1171,7 +1289,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
@@ -1180,14 +1298,14 @@ namespace ve {
 				auto& indexArray = pFbxUVs->GetIndexArray();
 				VE_ASSERT(indexArray.GetCount() == polygonCount * 3);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1200,7 +1318,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else
@@ -1215,16 +1333,16 @@ namespace ve {
 				auto& directArray = pFbxUVs->GetDirectArray();
 				VE_ASSERT(directArray.GetCount() == polygonCount);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
 					const FbxVector2& data = directArray[index++];
 
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1235,7 +1353,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
@@ -1244,16 +1362,16 @@ namespace ve {
 				auto& indexArray = pFbxUVs->GetIndexArray();
 				VE_ASSERT(indexArray.GetCount() == polygonCount);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
 					const FbxVector2& data = directArray[indexArray[index++]];
 
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1264,7 +1382,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else
@@ -1280,7 +1398,7 @@ namespace ve {
 		return true;
 	}
 
-	bool FbxModelSource::LoadMeshNormal(FbxLayerElementNormal* pFbxNormals, size_t firstPolygonIndex, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs)
+	bool FbxModelSource::LoadMeshNormal(FbxLayerElementNormal* pFbxNormals, IModelSource::Vertex* pPolygonVertices, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs)
 	{
 		FbxLayerElement::EMappingMode fbxMappingMode = pFbxNormals->GetMappingMode();
 		FbxLayerElement::EReferenceMode fbxReferenceMode = pFbxNormals->GetReferenceMode();
@@ -1290,14 +1408,14 @@ namespace ve {
 			if (fbxReferenceMode == FbxLayerElement::eDirect)
 			{
 				auto& directArray = pFbxNormals->GetDirectArray();
-				VE_ASSERT(directArray.GetCount() == polygonVertexRefs.size());
+				VE_ASSERT(directArray.GetCount() == polygonVertexRefs.GetControlPointCount());
 				return false;
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
 			{
 				auto& directArray = pFbxNormals->GetDirectArray();
 				auto& indexArray = pFbxNormals->GetIndexArray();
-				VE_ASSERT(indexArray.GetCount() == polygonVertexRefs.size());
+				VE_ASSERT(indexArray.GetCount() == polygonVertexRefs.GetControlPointCount());
 				return false;
 			}
 			else
@@ -1312,14 +1430,14 @@ namespace ve {
 				auto& directArray = pFbxNormals->GetDirectArray();
 				VE_ASSERT(directArray.GetCount() == polygonCount * 3);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1342,7 +1460,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
@@ -1351,14 +1469,14 @@ namespace ve {
 				auto& indexArray = pFbxNormals->GetIndexArray();
 				VE_ASSERT(indexArray.GetCount() == polygonCount * 3);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1381,7 +1499,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else
@@ -1396,16 +1514,16 @@ namespace ve {
 				auto& directArray = pFbxNormals->GetDirectArray();
 				VE_ASSERT(directArray.GetCount() == polygonCount);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
 					const FbxVector4& data = directArray[index++];
 
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1426,7 +1544,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else if (fbxReferenceMode == FbxLayerElement::eIndexToDirect)
@@ -1435,16 +1553,16 @@ namespace ve {
 				auto& indexArray = pFbxNormals->GetIndexArray();
 				VE_ASSERT(indexArray.GetCount() == polygonCount);
 
-				IModelSource::Polygon* pPolygon = m_Polygons.data() + firstPolygonIndex;
-				IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+				IModelSource::Vertex* pPolygonVertex = pPolygonVertices;
+				IModelSource::Vertex* pPolygonVertexEnd = pPolygonVertex + polygonCount * 3;
 
 				int32_t index = 0;
 
-				while (pPolygon != pPolygonEnd)
+				while (pPolygonVertex != pPolygonVertexEnd)
 				{
 					const FbxVector4& data = directArray[index++];
 
-					IModelSource::Vertex* pVertex = &pPolygon->vertices[0];
+					IModelSource::Vertex* pVertex = pPolygonVertex;
 					IModelSource::Vertex* pVertexEnd = pVertex + 3;
 
 					while (pVertex != pVertexEnd)
@@ -1465,7 +1583,7 @@ namespace ve {
 						pVertex++;
 					}
 
-					pPolygon++;
+					pPolygonVertex += 3;
 				}
 			}
 			else
@@ -1540,158 +1658,164 @@ namespace ve {
 		return true;
 	}
 
-	void FbxModelSource::CreateOBB(
-		collection::Vector<glm::vec3>& points,
-		glm::vec3& center, glm::vec3& xAxis, glm::vec3& yAxis, glm::vec3& zAxis, glm::vec3& halfExtent)
+	bool FbxModelSource::ImportProgressCallback(void* pArgs, float percentage, const char* pStatus)
 	{
-		const glm::vec3* pPointBegin = &(points[0]);
-		const glm::vec3* pPointEnd = pPointBegin + points.size();
-		const glm::vec3* pPoint;
+		BackgroundJobHandle* pHandle = static_cast<BackgroundJobHandle*>(pArgs);
 
-		// ----------------------------------------------------------------------------------------------------
-		// SWѕUUs߂
-		// ----------------------------------------------------------------------------------------------------
-
-		center = glm::vec3(0.0f);
+		uint64_t doneCount;
+		uint64_t totalCount;
+		pHandle->GetProgress(doneCount, totalCount);
 
-		pPoint = pPointBegin;
-		while (pPoint != pPointEnd)
+		uint64_t nextDoneCount = static_cast<uint64_t>(std::min(std::max(percentage, 0.0f), 100.0f));
+		if (doneCount < nextDoneCount)
 		{
-			center += *pPoint++;
+			pHandle->AddProgress(nextDoneCount - doneCount);
 		}
 
-		center /= static_cast<float>(points.size());
-
-		// ----------------------------------------------------------------------------------------------------
-		// UUs߂
-		// ----------------------------------------------------------------------------------------------------
+		// false ԂƃC|[gf
+		return (pHandle->IsCancelRequested() == false);
+	}
 
-		const float& cx = center.x;
-		const float& cy = center.y;
-		const float& cz = center.z;
+	void FbxModelSource::InsertBoneWeight(FbxModelSource::VertexWeight& vertexWeight, uint8_t index, float value)
+	{
+		vertexWeight.count++;
 
-		float c00 = 0.0f;
-		float c11 = 0.0f;
-		float c22 = 0.0f;
-		float c01 = 0.0f;
-		float c02 = 0.0f;
-		float c12 = 0.0f;
+		// l̑傫ɕł 4 ɑ} ( 4 Ԗڂ菬ꍇ͎̂Ă )
+		auto& weights = vertexWeight.weights;
 
-		pPoint = pPointBegin;
-		while (pPoint != pPointEnd)
+		if (value <= weights[3].value)
 		{
-			c00 += (pPoint->x - cx) * (pPoint->x - cx);
-			c11 += (pPoint->y - cy) * (pPoint->y - cy);
-			c22 += (pPoint->z - cz) * (pPoint->z - cz);
-			c01 += (pPoint->x - cx) * (pPoint->y - cy);
-			c02 += (pPoint->x - cx) * (pPoint->z - cz);
-			c12 += (pPoint->y - cy) * (pPoint->z - cz);
+			return;
+		}
 
-			pPoint++;
+		size_t i = 3;
+
+		while ((i > 0) && (weights[i - 1].value < value))
+		{
+			weights[i] = weights[i - 1];
+			i--;
 		}
 
-		float invSizeF = 1.0f / static_cast<float>(points.size());
-		float vcMat[3][3];
+		weights[i].index = index;
+		weights[i].value = value;
+	}
 
-		c00 *= invSizeF;
-		c11 *= invSizeF;
-		c22 *= invSizeF;
-		c01 *= invSizeF;
-		c02 *= invSizeF;
-		c12 *= invSizeF;
+	void FbxModelSource::ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon)
+	{
+		const IModelSource::Vertex& v0 = pVertices[polygon.indices[0]];
+		const IModelSource::Vertex& v1 = pVertices[polygon.indices[1]];
+		const IModelSource::Vertex& v2 = pVertices[polygon.indices[2]];
 
-		vcMat[0][0] = c00;
-		vcMat[0][1] = c01;
-		vcMat[0][2] = c02;
-		vcMat[1][0] = c01;
-		vcMat[1][1] = c11;
-		vcMat[1][2] = c12;
-		vcMat[2][0] = c02;
-		vcMat[2][1] = c12;
-		vcMat[2][2] = c22;
+		glm::vec3 p0 = v0.pos;
+		glm::vec3 p1 = v1.pos;
+		glm::vec3 p2 = v2.pos;
 
-		// ----------------------------------------------------------------------------------------------------
-		// ŗLs߂
-		// ----------------------------------------------------------------------------------------------------
+		glm::vec2 t0 = v0.uv;
+		glm::vec2 t1 = v1.uv;
+		glm::vec2 t2 = v2.uv;
 
-		int32_t loop = 0;
-		int32_t i;
-		int32_t p;
-		int32_t q;
-		float jmax;
-		float app, apq, aqq;
-		float alpha, beta, gamma;
-		float ab2;
-		float s, c;
-		float temp;
-		float eigenMat[3][3]{};
+		glm::vec3 cp0[3] =
+		{
+			glm::vec3(p0.x, t0.x, t0.y),
+			glm::vec3(p0.y, t0.x, t0.y),
+			glm::vec3(p0.z, t0.x, t0.y),
+		};
 
-		eigenMat[0][0] = 1.0f;
-		eigenMat[1][1] = 1.0f;
-		eigenMat[2][2] = 1.0f;
+		glm::vec3 cp1[3] =
+		{
+			glm::vec3(p1.x, t1.x, t1.y),
+			glm::vec3(p1.y, t1.x, t1.y),
+			glm::vec3(p1.z, t1.x, t1.y),
+		};
 
-		do
+		glm::vec3 cp2[3] =
 		{
-			jmax = Jacobi_GetMax(vcMat, p, q);
+			glm::vec3(p2.x, t2.x, t2.y),
+			glm::vec3(p2.y, t2.x, t2.y),
+			glm::vec3(p2.z, t2.x, t2.y),
+		};
+
+		float u[3];
+		float v[3];
 
-			app = vcMat[p][p];
-			apq = vcMat[p][q];
-			aqq = vcMat[q][q];
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			glm::vec3 v1 = cp1[i] - cp0[i];
+			glm::vec3 v2 = cp2[i] - cp1[i];
 
-			alpha = (app - aqq) / 2.0f;
-			beta = -apq;
+			glm::vec3 abc = glm::cross(v1, v2);
 
-			ab2 = alpha * alpha + beta * beta;
-			if (VE_FLOAT_IS_ZERO(ab2) == false)
+			if ((-VE_FLOAT_EPSILON <= abc.x) && (VE_FLOAT_EPSILON >= abc.x))
 			{
-				gamma = ::fabs(alpha) / ::sqrtf(alpha * alpha + beta * beta);
+				//kނĂ|S
+				u[i] = 1.0f;
+				v[i] = 1.0f;
 			}
 			else
 			{
-				gamma = 0.0f;
+				u[i] = (abc.y / abc.x);
+				v[i] = (abc.z / abc.x);
 			}
+		}
 
-			s = ::sqrtf((1.0f - gamma) / 2.0f);
-			c = ::sqrtf((1.0f + gamma) / 2.0f);
-			if ((alpha * beta) < 0.0f)
-			{
-				s = -s;
-			}
+		glm::vec3 tangent = glm::normalize(glm::vec3(u[0], u[1], u[2]));
+		glm::vec3 binormal = glm::normalize(glm::vec3(v[0], v[1], v[2]));
 
-			for (i = 0; i < 3; i++)
-			{
-				temp = c * vcMat[p][i] - s * vcMat[q][i];
-				vcMat[q][i] = s * vcMat[p][i] + c * vcMat[q][i];
-				vcMat[p][i] = temp;
-			}
+		// _LgCAO̐ڐԂ𑫂킹ĂAŌ NormalizeTangentSpace ŐK
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			IModelSource::Vertex& vertex = pVertices[polygon.indices[i]];
+			vertex.tangent += tangent;
+			vertex.binormal += binormal;
+		}
+	}
 
-			for (i = 0; i < 3; i++)
-			{
-				vcMat[i][p] = vcMat[p][i];
-				vcMat[i][q] = vcMat[q][i];
-			}
+	void FbxModelSource::NormalizeTangentSpace(IModelSource::Vertex& vertex)
+	{
+		float tangentLength = glm::length(vertex.tangent);
+		float binormalLength = glm::length(vertex.binormal);
 
-			vcMat[p][p] = (c * c * app) + (s * s * aqq) - (2.0f * s * c * apq);
-			vcMat[p][q] = (s * c * (app - aqq)) + ((c * c - s*s) * apq);
-			vcMat[q][p] = (s * c * (app - aqq)) + ((c * c - s * s) * apq);
-			vcMat[q][q] = (s * s * app) + (c * c * aqq) + (2.0f * s * c * apq);
+		if ((tangentLength > VE_FLOAT_EPSILON) && (binormalLength > VE_FLOAT_EPSILON))
+		{
+			vertex.tangent /= tangentLength;
+			vertex.binormal /= binormalLength;
+		}
+		else
+		{
+			// 킹ڐԂłĂꍇ́A@쐬
+			glm::vec3 axis = (::fabs(vertex.normal.x) < 0.9f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
 
-			for (i = 0; i < 3; i++)
-			{
-				temp = (c * eigenMat[i][p]) - (s * eigenMat[i][q]);
-				eigenMat[i][q] = (s * eigenMat[i][p]) + (c * eigenMat[i][q]);
-				eigenMat[i][p] = temp;
-			}
+			vertex.tangent = glm::normalize(glm::cross(axis, vertex.normal));
+			vertex.binormal = glm::cross(vertex.normal, vertex.tangent);
+		}
+	}
 
-		} while ((jmax > FLT_EPSILON) && (++loop < 100));
+	void FbxModelSource::CreateOBB(
+		const collection::Vector<glm::vec3>& points,
+		glm::vec3& center, glm::vec3& xAxis, glm::vec3& yAxis, glm::vec3& zAxis, glm::vec3& halfExtent)
+	{
+		const glm::vec3* pPointBegin = points.data();
+		const glm::vec3* pPointEnd = pPointBegin + points.size();
+		const glm::vec3* pPoint;
 
 		// ----------------------------------------------------------------------------------------------------
-		// OBB ߂
+		// UUs߂
 		// ----------------------------------------------------------------------------------------------------
 
-		xAxis = glm::vec3(eigenMat[0][0], eigenMat[1][0], eigenMat[2][0]);
-		yAxis = glm::vec3(eigenMat[0][1], eigenMat[1][1], eigenMat[2][1]);
-		zAxis = glm::vec3(eigenMat[0][2], eigenMat[1][2], eigenMat[2][2]);
+		glm::vec3 mean;
+		float covariance[6];
+
+		FbxModelSource::ComputeCovariance(pPointBegin, points.size(), mean, covariance);
+
+		// ----------------------------------------------------------------------------------------------------
+		// ŗLxNg߂
+		// ----------------------------------------------------------------------------------------------------
+
+		FbxModelSource::ComputeEigenVectors(covariance, xAxis, yAxis, zAxis);
+
+		// ----------------------------------------------------------------------------------------------------
+		// OBB ߂
+		// ----------------------------------------------------------------------------------------------------
 
 		glm::vec3 minimum(+VE_FLOAT_MAX);
 		glm::vec3 maximum(-VE_FLOAT_MAX);
@@ -1723,33 +1847,275 @@ namespace ve {
 		// ----------------------------------------------------------------------------------------------------
 	}
 
-	float FbxModelSource::Jacobi_GetMax(const float mat[3][3], int32_t& p, int32_t& q)
+	void FbxModelSource::ComputeCovariance(const glm::vec3* pPoints, size_t pointCount, glm::vec3& mean, float covariance[6])
 	{
-		int i;
-		int j;
-		float ret;
-		float temp;
+		VE_ASSERT(pointCount > 0);
 
-		ret = ::fabs(mat[0][1]);
-		p = 0;
-		q = 1;
+		// }邽߁Aŏ̓_̍ 1 pXŏWv
+		// sums  x y z xx yy zz xy xz yz ̏
+		const glm::vec3 origin = pPoints[0];
+		float sums[9]{};
+		size_t pointIndex = 0;
 
-		for (i = 0; i < 3; i++)
+#ifdef VE_SIMD_SSE
+		/*********************************/
+		/* 4 _ SoA ɕבւďWv */
+		/*********************************/
+
+		if (pointCount >= 4)
 		{
-			for (j = (i + 1); j < 3; j++)
+			const __m128 ox = _mm_set1_ps(origin.x);
+			const __m128 oy = _mm_set1_ps(origin.y);
+			const __m128 oz = _mm_set1_ps(origin.z);
+
+			__m128 sx = _mm_setzero_ps();
+			__m128 sy = _mm_setzero_ps();
+			__m128 sz = _mm_setzero_ps();
+			__m128 sxx = _mm_setzero_ps();
+			__m128 syy = _mm_setzero_ps();
+			__m128 szz = _mm_setzero_ps();
+			__m128 sxy = _mm_setzero_ps();
+			__m128 sxz = _mm_setzero_ps();
+			__m128 syz = _mm_setzero_ps();
+
+			size_t simdPointCount = pointCount & ~static_cast<size_t>(3);
+
+			for (; pointIndex < simdPointCount; pointIndex += 4)
 			{
-				temp = ::fabs(mat[i][j]);
+				// a = x0 y0 z0 x1 / b = y1 z1 x2 y2 / c = z2 x3 y3 z3
+				const float* pValues = &pPoints[pointIndex].x;
+				__m128 a = _mm_loadu_ps(pValues + 0);
+				__m128 b = _mm_loadu_ps(pValues + 4);
+				__m128 c = _mm_loadu_ps(pValues + 8);
 
-				if (temp > ret)
-				{
-					ret = temp;
-					p = i;
-					q = j;
-				}
+				__m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+				__m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+				__m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+				x = _mm_sub_ps(x, ox);
+				y = _mm_sub_ps(y, oy);
+				z = _mm_sub_ps(z, oz);
+
+				sx = _mm_add_ps(sx, x);
+				sy = _mm_add_ps(sy, y);
+				sz = _mm_add_ps(sz, z);
+				sxx = _mm_add_ps(sxx, _mm_mul_ps(x, x));
+				syy = _mm_add_ps(syy, _mm_mul_ps(y, y));
+				szz = _mm_add_ps(szz, _mm_mul_ps(z, z));
+				sxy = _mm_add_ps(sxy, _mm_mul_ps(x, y));
+				sxz = _mm_add_ps(sxz, _mm_mul_ps(x, z));
+				syz = _mm_add_ps(syz, _mm_mul_ps(y, z));
+			}
+
+			const __m128 lanes[9] = { sx, sy, sz, sxx, syy, szz, sxy, sxz, syz };
+
+			for (size_t i = 0; i < 9; i++)
+			{
+				float values[4];
+				_mm_storeu_ps(values, lanes[i]);
+				sums[i] = (values[0] + values[1]) + (values[2] + values[3]);
 			}
 		}
+#endif //VE_SIMD_SSE
+
+		/******************/
+		/* c̓_Wv */
+		/******************/
+
+		for (; pointIndex < pointCount; pointIndex++)
+		{
+			glm::vec3 d = pPoints[pointIndex] - origin;
+
+			sums[0] += d.x;
+			sums[1] += d.y;
+			sums[2] += d.z;
+			sums[3] += d.x * d.x;
+			sums[4] += d.y * d.y;
+			sums[5] += d.z * d.z;
+			sums[6] += d.x * d.y;
+			sums[7] += d.x * d.z;
+			sums[8] += d.y * d.z;
+		}
+
+		/****************/
+		/* ρAU */
+		/****************/
+
+		float invCount = 1.0f / static_cast<float>(pointCount);
+		glm::vec3 d(sums[0] * invCount, sums[1] * invCount, sums[2] * invCount);
+
+		mean = origin + d;
+
+		covariance[0] = sums[3] * invCount - d.x * d.x;
+		covariance[1] = sums[4] * invCount - d.y * d.y;
+		covariance[2] = sums[5] * invCount - d.z * d.z;
+		covariance[3] = sums[6] * invCount - d.x * d.y;
+		covariance[4] = sums[7] * invCount - d.x * d.z;
+		covariance[5] = sums[8] * invCount - d.y * d.z;
+	}
+
+	void FbxModelSource::ComputeEigenVectors(const float covariance[6], glm::vec3& xAxis, glm::vec3& yAxis, glm::vec3& zAxis)
+	{
+		xAxis = glm::vec3(1.0f, 0.0f, 0.0f);
+		yAxis = glm::vec3(0.0f, 1.0f, 0.0f);
+		zAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+
+		// ----------------------------------------------------------------------------------------------------
+		// 臒lɂ邽߁Aő̗vf 1 ɂȂ悤ɐK
+		// ----------------------------------------------------------------------------------------------------
+
+		float maxValue = 0.0f;
+		for (int32_t i = 0; i < 6; i++)
+		{
+			maxValue = std::max(maxValue, ::fabsf(covariance[i]));
+		}
+
+		if (VE_FLOAT_IS_ZERO(maxValue) == true)
+		{
+			// ׂĂ̓_ʒuɂ
+			return;
+		}
+
+		float invMaxValue = 1.0f / maxValue;
+
+		float a00 = covariance[0] * invMaxValue;
+		float a11 = covariance[1] * invMaxValue;
+		float a22 = covariance[2] * invMaxValue;
+		float a01 = covariance[3] * invMaxValue;
+		float a02 = covariance[4] * invMaxValue;
+		float a12 = covariance[5] * invMaxValue;
+
+		// ----------------------------------------------------------------------------------------------------
+		// ŗLl߂ ( Op֐ŉ )
+		// ----------------------------------------------------------------------------------------------------
+
+		float offDiagonal = (a01 * a01) + (a02 * a02) + (a12 * a12);
+		if (offDiagonal <= (FLT_EPSILON * FLT_EPSILON))
+		{
+			// ΊpsȂ̂ŁÂ܂܌ŗLxNgɂȂ
+			return;
+		}
+
+		float q = (a00 + a11 + a22) / 3.0f;
+		float b00 = a00 - q;
+		float b11 = a11 - q;
+		float b22 = a22 - q;
+		float p = ::sqrtf(((b00 * b00) + (b11 * b11) + (b22 * b22) + (2.0f * offDiagonal)) / 6.0f);
+		float invP = 1.0f / p;
+
+		// r = det((A - qI) / p) / 2
+		float r = ((b00 * ((b11 * b22) - (a12 * a12))) - (a01 * ((a01 * b22) - (a12 * a02))) + (a02 * ((a01 * a12) - (b11 * a02)))) * (invP * invP * invP) * 0.5f;
+		r = std::min(std::max(r, -1.0f), 1.0f);
+
+		float phi = ::acosf(r) / 3.0f;
+
+		float eigenValue0 = q + (2.0f * p * ::cosf(phi));
+		float eigenValue2 = q + (2.0f * p * ::cosf(phi + (2.0f * glm::pi<float>() / 3.0f)));
+		float eigenValue1 = (3.0f * q) - eigenValue0 - eigenValue2;
+
+		// ----------------------------------------------------------------------------------------------------
+		// ŗLxNg߂
+		// ----------------------------------------------------------------------------------------------------
+
+		// dɂȂĂŗLľŗLxNg͈ӂɌ܂Ȃ߁AĂ̌ŗLl狁߂
+
+		const glm::vec3 rows[3] =
+		{
+			glm::vec3(a00, a01, a02),
+			glm::vec3(a01, a11, a12),
+			glm::vec3(a02, a12, a22),
+		};
+
+		glm::vec3 v0;
+		glm::vec3 v2;
+
+		if ((eigenValue0 - eigenValue1) >= (eigenValue1 - eigenValue2))
+		{
+			if (FbxModelSource::ComputeEigenVector(rows, eigenValue0, v0) == false)
+			{
+				return;
+			}
+
+			if ((FbxModelSource::ComputeEigenVector(rows, eigenValue2, v2) == false) ||
+				(VE_FLOAT_IS_ZERO(glm::length(v2 - v0 * glm::dot(v2, v0))) == true))
+			{
+				v2 = FbxModelSource::GetPerpendicular(v0);
+			}
+			else
+			{
+				v2 = glm::normalize(v2 - v0 * glm::dot(v2, v0));
+			}
+		}
+		else
+		{
+			if (FbxModelSource::ComputeEigenVector(rows, eigenValue2, v2) == false)
+			{
+				return;
+			}
+
+			if ((FbxModelSource::ComputeEigenVector(rows, eigenValue0, v0) == false) ||
+				(VE_FLOAT_IS_ZERO(glm::length(v0 - v2 * glm::dot(v0, v2))) == true))
+			{
+				v0 = FbxModelSource::GetPerpendicular(v2);
+			}
+			else
+			{
+				v0 = glm::normalize(v0 - v2 * glm::dot(v0, v2));
+			}
+		}
+
+		xAxis = v0;
+		yAxis = glm::cross(v2, v0);
+		zAxis = v2;
+	}
+
+	bool FbxModelSource::ComputeEigenVector(const glm::vec3 rows[3], float eigenValue, glm::vec3& eigenVector)
+	{
+		// (A - I) ̍s͌ŗLxNgƒ邽߁Asm̊Oς̂ł̂ŗLxNgɂ
+
+		glm::vec3 r0 = rows[0] - glm::vec3(eigenValue, 0.0f, 0.0f);
+		glm::vec3 r1 = rows[1] - glm::vec3(0.0f, eigenValue, 0.0f);
+		glm::vec3 r2 = rows[2] - glm::vec3(0.0f, 0.0f, eigenValue);
+
+		glm::vec3 c01 = glm::cross(r0, r1);
+		glm::vec3 c02 = glm::cross(r0, r2);
+		glm::vec3 c12 = glm::cross(r1, r2);
+
+		float d01 = glm::dot(c01, c01);
+		float d02 = glm::dot(c02, c02);
+		float d12 = glm::dot(c12, c12);
+
+		float maxLengthSq = d01;
+		eigenVector = c01;
+
+		if (maxLengthSq < d02)
+		{
+			maxLengthSq = d02;
+			eigenVector = c02;
+		}
+
+		if (maxLengthSq < d12)
+		{
+			maxLengthSq = d12;
+			eigenVector = c12;
+		}
+
+		// s͐KĂ邽߁A臒l͈ł悢
+		if (maxLengthSq <= 1.0e-10f)
+		{
+			return false;
+		}
+
+		eigenVector /= ::sqrtf(maxLengthSq);
+
+		return true;
+	}
+
+	glm::vec3 FbxModelSource::GetPerpendicular(const glm::vec3& v)
+	{
+		glm::vec3 axis = (::fabs(v.x) < 0.9f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
 
-		return ret;
+		return glm::normalize(glm::cross(axis, v));
 	}
 
 	int32_t FbxModelSource::GetMaterialIndex(FbxNode* pFbxNode, int32_t fbxMaterialIndex, collection::Vector<IModelSource::Material>& materials)
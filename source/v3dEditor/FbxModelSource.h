@@ -13,45 +13,136 @@ namespace ve {
 		FbxModelSource();
 		virtual ~FbxModelSource();
 
-		bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config) override;
+		bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle) override;
+		void GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes) override;
 
 		const wchar_t* GetFilePath() const override;
 		const collection::Vector<IModelSource::Material>& GetMaterials() const override;
+		const collection::Vector<IModelSource::Vertex>& GetVertices() const override;
 		const collection::Vector<IModelSource::Polygon>& GetPolygons() const override;
 		const collection::Vector<IModelSource::Node>& GetNodes() const override;
 		size_t GetEmptyNodeCount() const override;
 		size_t GetMeshNodeCount() const override;
+		void ReleaseGeometry() override;
 
 		VE_DECLARE_ALLOCATOR
 
 	private:
+		// LZ𒲂ׂԊu ( |S̒_̐ )
+		static constexpr size_t CANCEL_CHECK_INTERVAL = 65536;
+
 		struct BoneWeight
 		{
 			uint8_t index;
 			float value;
 		};
 
-		typedef collection::Vector<collection::Vector<std::array<int32_t, 2>>> PolygonVertexRefVector;
+		// Rg[|Cg̃EFCg ( l̑傫ɏ 4  )
+		struct VertexWeight
+		{
+			std::array<FbxModelSource::BoneWeight, 4> weights;
+			uint32_t count; // e󂯂{[̐ (  4 ɍiO )
+		};
+
+		struct NodeNameKey
+		{
+			StringW name;
+
+			bool operator == (const FbxModelSource::NodeNameKey& rhs) const
+			{
+				return (name.compare(rhs.name) == 0);
+			}
+
+			size_t operator()(const FbxModelSource::NodeNameKey& key) const
+			{
+				return std::hash<StringW>()(key.name);
+			}
+		};
+
+		// Rg[|CgAUVA@|S̒_͋L
+		struct VertexKey
+		{
+			int32_t controlPoint;
+			glm::vec2 uv;
+			glm::vec3 normal;
+
+			bool operator == (const FbxModelSource::VertexKey& rhs) const
+			{
+				// nbVƈv邽߁ArbgŔr
+				return (memcmp(this, &rhs, sizeof(FbxModelSource::VertexKey)) == 0);
+			}
+
+			size_t operator()(const FbxModelSource::VertexKey& key) const
+			{
+				const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(&key);
+				uint64_t hash = 14695981039346656037ULL;
+
+				for (size_t i = 0; i < sizeof(FbxModelSource::VertexKey); i++)
+				{
+					hash ^= pBytes[i];
+					hash *= 1099511628211ULL;
+				}
+
+				return static_cast<size_t>(hash);
+			}
+		};
+
+		// Rg[|Cg̃|S̒_̎Q ( CSR )
+		// Rg[|Cg i ̎QƂ refs[offsets[i]]  refs[offsets[i + 1] - 1] ܂
+		struct PolygonVertexRefVector
+		{
+			collection::Vector<uint32_t> offsets; // Rg[|Cg̐ + 1
+			collection::Vector<std::array<int32_t, 2>> refs; // |S̃CfbNXA|S̒_̃CfbNX
+
+			size_t GetControlPointCount() const
+			{
+				return (offsets.empty() == false) ? (offsets.size() - 1) : 0;
+			}
+		};
+
+		// {[̃{bNX ( ׂẴm[h[hĂɍ쐬 )
+		struct Shape
+		{
+			int32_t nodeIndex;
+			uint32_t boxIndex;
+			collection::Vector<glm::vec3> points;
+		};
 
 		StringW m_FilePath;
 		collection::Vector<IModelSource::Material> m_Materials;
+		collection::Vector<IModelSource::Vertex> m_Vertices;
 		collection::Vector<IModelSource::Polygon> m_Polygons;
 		collection::Vector<IModelSource::Node> m_Nodes;
+		collection::HashMap<FbxModelSource::NodeNameKey, int32_t> m_NodeIndexMap;
 		size_t m_MeshNodeCount;
+		collection::Vector<FbxModelSource::Shape> m_Shapes;
+		BackgroundJobHandlePtr m_Handle;
 
 		bool Load(LoggerPtr logger, FbxScene* pFbxScene, const ModelSourceConfig& config);
 		bool LoadNodes(LoggerPtr logger, FbxNode* pFbxNode, int32_t parentNodeIndex, const ModelSourceConfig& config);
 		bool LoadNodeMaterial(FbxNode* pFbxNode, IModelSource::Node& node, const ModelSourceConfig& config);
 		bool LoadMesh(LoggerPtr logger, FbxNode* pFbxNode, FbxMesh* pFbxMesh, IModelSource::Node& node, int32_t nodeIndex, const ModelSourceConfig& config);
-		bool LoadMeshUV(FbxLayerElementUV* pFbxUVs, size_t firstPolygonIndex, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs);
-		bool LoadMeshNormal(FbxLayerElementNormal* pFbxNormals, size_t firstPolygonIndex, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs);
+		bool LoadMeshUV(FbxLayerElementUV* pFbxUVs, IModelSource::Vertex* pPolygonVertices, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs);
+		bool LoadMeshNormal(FbxLayerElementNormal* pFbxNormals, IModelSource::Vertex* pPolygonVertices, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs);
+		int32_t FindNodeIndex(const wchar_t* pName) const;
 		bool LoadMeshMaterial(FbxNode* pFbxNode, FbxLayerElementMaterial* pFbxMaterials, size_t firstPolygonIndex, size_t polygonCount, const FbxModelSource::PolygonVertexRefVector& polygonVertexRefs);
 
+		static bool ImportProgressCallback(void* pArgs, float percentage, const char* pStatus);
+		static void InsertBoneWeight(FbxModelSource::VertexWeight& vertexWeight, uint8_t index, float value);
+
+		static void ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon);
+		static void NormalizeTangentSpace(IModelSource::Vertex& vertex);
+
 		static void CreateOBB(
-			collection::Vector<glm::vec3>& points,
+			const collection::Vector<glm::vec3>& points,
 			glm::vec3& center, glm::vec3& xAxis, glm::vec3& yAxis, glm::vec3& zAxis, glm::vec3& halfExtent);
 
-		static float Jacobi_GetMax(const float mat[3][3], int32_t& p, int32_t& q);
+		// covariance  xx yy zz xy xz yz ̏
+		static void ComputeCovariance(const glm::vec3* pPoints, size_t pointCount, glm::vec3& mean, float covariance[6]);
+		// Ώ̍šŗLxNgŗLl̑傫ɋ߂ ( En̐KɂȂ )
+		static void ComputeEigenVectors(const float covariance[6], glm::vec3& xAxis, glm::vec3& yAxis, glm::vec3& zAxis);
+		static bool ComputeEigenVector(const glm::vec3 rows[3], float eigenValue, glm::vec3& eigenVector);
+		static glm::vec3 GetPerpendicular(const glm::vec3& v);
 
 		static int32_t GetMaterialIndex(FbxNode* pFbxNode, int32_t fbxMaterialIndex, collection::Vector<IModelSource::Material>& materials);
 		static void GetMaterialTexture(const FbxProperty& prop, MODEL_SOURCE_PATH_TYPE pathType, StringW& texture);
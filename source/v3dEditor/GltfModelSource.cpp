@@ -0,0 +1,2022 @@
+#include "GltfModelSource.h"
+#include "DeviceContext.h"
+#include "Logger.h"
+#include "JsonUtility.h"
+#include "BackgroundQueue.h"
+#include "ParallelTask.h"
+#include <atomic>
+
+namespace ve {
+
+	ModelSourcePtr GltfModelSource::Create()
+	{
+		return std::move(std::make_shared<GltfModelSource>());
+	}
+
+	GltfModelSource::GltfModelSource() :
+		m_MeshNodeCount(0)
+	{
+	}
+
+	GltfModelSource::~GltfModelSource()
+	{
+		UnmapFiles();
+	}
+
+	bool GltfModelSource::Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle)
+	{
+		m_FilePath = pFilePath;
+
+		// ----------------------------------------------------------------------------------------------------
+		// t@CɃ}bv
+		// ----------------------------------------------------------------------------------------------------
+
+		GltfModelSource::MappedFile file{};
+		if (MapFile(logger, pFilePath, file) == false)
+		{
+			return false;
+		}
+
+		m_MappedFiles.push_back(file);
+
+		// ----------------------------------------------------------------------------------------------------
+		// GLB ̏ꍇ̓`Nɕ
+		// ----------------------------------------------------------------------------------------------------
+
+		const char* pJsonData = nullptr;
+		uint64_t jsonSize = 0;
+
+		const uint8_t* pBinData = nullptr;
+		uint64_t binSize = 0;
+
+		uint32_t header[3] = { 0, 0, 0 };
+
+		if (file.size >= sizeof(header))
+		{
+			memcpy(header, file.pData, sizeof(header));
+		}
+
+		if (header[0] == GltfModelSource::GLB_MAGIC)
+		{
+			if (header[1] != GltfModelSource::GLB_VERSION)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "The GLB version is not supported : Version[%u]", header[1]);
+				UnmapFiles();
+				return false;
+			}
+
+			uint64_t length = std::min(static_cast<uint64_t>(header[2]), file.size);
+			uint64_t offset = sizeof(header);
+
+			while (offset + 8 <= length)
+			{
+				uint32_t chunkHeader[2];
+				memcpy(chunkHeader, file.pData + offset, sizeof(chunkHeader));
+
+				uint64_t chunkOffset = offset + sizeof(chunkHeader);
+				uint64_t chunkLength = chunkHeader[0];
+
+				if (chunkOffset + chunkLength > length)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "The GLB chunk is out of range");
+					UnmapFiles();
+					return false;
+				}
+
+				if ((chunkHeader[1] == GltfModelSource::GLB_CHUNK_TYPE_JSON) && (pJsonData == nullptr))
+				{
+					pJsonData = reinterpret_cast<const char*>(file.pData + chunkOffset);
+					jsonSize = chunkLength;
+				}
+				else if ((chunkHeader[1] == GltfModelSource::GLB_CHUNK_TYPE_BIN) && (pBinData == nullptr))
+				{
+					pBinData = file.pData + chunkOffset;
+					binSize = chunkLength;
+				}
+
+				// `N 4 oCgEɑĂ
+				offset = chunkOffset + ((chunkLength + 3) & ~3ULL);
+			}
+
+			if (pJsonData == nullptr)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "The GLB has no JSON chunk");
+				UnmapFiles();
+				return false;
+			}
+		}
+		else
+		{
+			pJsonData = reinterpret_cast<const char*>(file.pData);
+			jsonSize = file.size;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// [h
+		// ----------------------------------------------------------------------------------------------------
+
+		json::Value* pRoot = json::Load(pJsonData, static_cast<size_t>(jsonSize));
+		if (pRoot == nullptr)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to parse the JSON : %s", pFilePath);
+			UnmapFiles();
+			return false;
+		}
+
+		bool result = Load(logger, pRoot, pBinData, binSize, config, handle);
+
+		pRoot->Destroy();
+
+		// obt@̓}bvt@CQƂĂ邽߁Aꏏɉ
+		m_Buffers.clear();
+		UnmapFiles();
+
+		return result;
+	}
+
+	void GltfModelSource::GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes)
+	{
+		// Õt@CQƂĂobt@ ( buffers[].uri ) 𒲂ׂ ( G[ Load ŏo͂ )
+		// 摜̓eNX`Ƃĕʂɓǂݍ܂邽ߊ܂߂Ȃ
+
+		HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if ((GetFileSizeEx(fileHandle, &fileSize) == FALSE) || (fileSize.QuadPart == 0))
+		{
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr)
+		{
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		const uint8_t* pData = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (pData == nullptr)
+		{
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		uint64_t size = static_cast<uint64_t>(fileSize.QuadPart);
+
+		const char* pJsonData = nullptr;
+		uint64_t jsonSize = 0;
+
+		uint32_t header[3] = { 0, 0, 0 };
+
+		if (size >= sizeof(header))
+		{
+			memcpy(header, pData, sizeof(header));
+		}
+
+		if (header[0] == GltfModelSource::GLB_MAGIC)
+		{
+			// JSON `N͕K擪ɂ
+			uint32_t chunkHeader[2] = { 0, 0 };
+
+			if (size >= sizeof(header) + sizeof(chunkHeader))
+			{
+				memcpy(chunkHeader, pData + sizeof(header), sizeof(chunkHeader));
+			}
+
+			uint64_t chunkOffset = sizeof(header) + sizeof(chunkHeader);
+
+			if ((chunkHeader[1] == GltfModelSource::GLB_CHUNK_TYPE_JSON) && (chunkOffset + chunkHeader[0] <= size))
+			{
+				pJsonData = reinterpret_cast<const char*>(pData + chunkOffset);
+				jsonSize = chunkHeader[0];
+			}
+		}
+		else
+		{
+			pJsonData = reinterpret_cast<const char*>(pData);
+			jsonSize = size;
+		}
+
+		json::Value* pRoot = (pJsonData != nullptr) ? json::Load(pJsonData, static_cast<size_t>(jsonSize)) : nullptr;
+		if (pRoot != nullptr)
+		{
+			StringW dirPath;
+			GetDirectoryPath(pFilePath, dirPath);
+
+			const json::Value* pBuffers = json::FindArray(pRoot, "buffers");
+			size_t bufferCount = json::GetElementCount(pBuffers);
+
+			for (size_t i = 0; i < bufferCount; i++)
+			{
+				const char* pUri = json::GetString(pBuffers->elements[i], "uri", nullptr);
+
+				if ((pUri == nullptr) || (strncmp(pUri, "data:", 5) == 0))
+				{
+					continue;
+				}
+
+				StringW path;
+				GltfModelSource::DecodeUri(pUri, path);
+
+				StringW filePath;
+
+				if (IsRelativePath(path.c_str()) == true)
+				{
+					filePath = dirPath;
+					filePath += path;
+				}
+				else
+				{
+					filePath = path;
+				}
+
+				if (std::find(filePathes.begin(), filePathes.end(), filePath) == filePathes.end())
+				{
+					filePathes.push_back(filePath);
+				}
+			}
+
+			pRoot->Destroy();
+		}
+
+		UnmapViewOfFile(pData);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+	}
+
+	const wchar_t* GltfModelSource::GetFilePath() const
+	{
+		return m_FilePath.c_str();
+	}
+
+	const collection::Vector<IModelSource::Material>& GltfModelSource::GetMaterials() const
+	{
+		return m_Materials;
+	}
+
+	const collection::Vector<IModelSource::Vertex>& GltfModelSource::GetVertices() const
+	{
+		return m_Vertices;
+	}
+
+	const collection::Vector<IModelSource::Polygon>& GltfModelSource::GetPolygons() const
+	{
+		return m_Polygons;
+	}
+
+	const collection::Vector<IModelSource::Node>& GltfModelSource::GetNodes() const
+	{
+		return m_Nodes;
+	}
+
+	size_t GltfModelSource::GetEmptyNodeCount() const
+	{
+		return m_Nodes.size() - m_MeshNodeCount;
+	}
+
+	size_t GltfModelSource::GetMeshNodeCount() const
+	{
+		return m_MeshNodeCount;
+	}
+
+	void GltfModelSource::ReleaseGeometry()
+	{
+		collection::Vector<IModelSource::Vertex>().swap(m_Vertices);
+		collection::Vector<IModelSource::Polygon>().swap(m_Polygons);
+	}
+
+	bool GltfModelSource::Load(LoggerPtr logger, const json::Value* pRoot, const uint8_t* pBinData, uint64_t binSize, const ModelSourceConfig& config, BackgroundJobHandlePtr handle)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// o[WAgmF
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			const char* pVersion = json::GetString(json::FindObject(pRoot, "asset"), "version", "");
+			if (pVersion[0] != '2')
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "The glTF version is not supported : Version[%s]", pVersion);
+				return false;
+			}
+
+			// KHR_mesh_quantization ́AׂẴR|[lǧ^ǂݍ߂邽ߑΉĂ
+			const json::Value* pExtensions = json::FindArray(pRoot, "extensionsRequired");
+			size_t extensionCount = json::GetElementCount(pExtensions);
+
+			for (size_t i = 0; i < extensionCount; i++)
+			{
+				const json::Value* pExtension = pExtensions->elements[i];
+
+				if ((pExtension->type == json::VALUE_TYPE_STRING) && (pExtension->string != "KHR_mesh_quantization"))
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "The required extension is not supported : Extension[%s]", pExtension->string.c_str());
+					return false;
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// obt@A}eAǂݍ
+		// ----------------------------------------------------------------------------------------------------
+
+		if (LoadBuffers(logger, pRoot, pBinData, binSize) == false)
+		{
+			return false;
+		}
+
+		LoadMaterials(logger, pRoot, config);
+
+		// ----------------------------------------------------------------------------------------------------
+		// [gm[h쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			IModelSource::Node rootNode;
+			rootNode.name = L"RootNode";
+			rootNode.parentIndex = -1;
+			rootNode.localTranslation = glm::vec3(0.0f);
+			rootNode.localRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			rootNode.localScaling = glm::vec3(1.0f);
+			rootNode.firstVertexIndex = 0;
+			rootNode.vertexCount = 0;
+			rootNode.firstPolygonIndex = 0;
+			rootNode.polygonCount = 0;
+			rootNode.hasUV = false;
+
+			if (config.flags & MODEL_SOURCE_TRANSFORM)
+			{
+				rootNode.localScaling *= config.scale;
+				rootNode.localRotation *= glm::quat(config.rotation);
+			}
+
+			m_Nodes.push_back(rootNode);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// V[̃m[hǂݍ
+		// ----------------------------------------------------------------------------------------------------
+
+		// eqɕԂ悤ɁA[g[Dłǂ
+
+		const json::Value* pNodes = json::FindArray(pRoot, "nodes");
+		size_t gltfNodeCount = json::GetElementCount(pNodes);
+
+		collection::Vector<int32_t> nodeIndexMap;
+		nodeIndexMap.resize(gltfNodeCount, -1);
+
+		{
+			const json::Value* pScene = json::GetElement(json::FindArray(pRoot, "scenes"), json::GetInteger(pRoot, "scene", 0));
+
+			if (pScene != nullptr)
+			{
+				const json::Value* pSceneNodes = json::FindArray(pScene, "nodes");
+				size_t sceneNodeCount = json::GetElementCount(pSceneNodes);
+
+				for (size_t i = 0; i < sceneNodeCount; i++)
+				{
+					const json::Value* pSceneNode = pSceneNodes->elements[i];
+					int64_t gltfNodeIndex = (pSceneNode->type == json::VALUE_TYPE_NUMBER) ? static_cast<int64_t>(pSceneNode->number) : -1;
+
+					if (LoadNode(logger, pRoot, gltfNodeIndex, 0, nodeIndexMap) == false)
+					{
+						return false;
+					}
+				}
+			}
+			else
+			{
+				// V[ꍇ́AeȂm[h[gƂ
+				collection::Vector<uint8_t> hasParents;
+				hasParents.resize(gltfNodeCount, 0);
+
+				for (size_t i = 0; i < gltfNodeCount; i++)
+				{
+					const json::Value* pChildren = json::FindArray(pNodes->elements[i], "children");
+					size_t childCount = json::GetElementCount(pChildren);
+
+					for (size_t j = 0; j < childCount; j++)
+					{
+						const json::Value* pChild = pChildren->elements[j];
+
+						if ((pChild->type == json::VALUE_TYPE_NUMBER) && (pChild->number >= 0.0) && (pChild->number < static_cast<double>(gltfNodeCount)))
+						{
+							hasParents[static_cast<size_t>(pChild->number)] = 1;
+						}
+					}
+				}
+
+				for (size_t i = 0; i < gltfNodeCount; i++)
+				{
+					if ((hasParents[i] == 0) && (LoadNode(logger, pRoot, static_cast<int64_t>(i), 0, nodeIndexMap) == false))
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// bVm[h̃v~eBuׂ
+		// ----------------------------------------------------------------------------------------------------
+
+		// bV𕡐̃m[hQƂĂꍇ́Am[hƂɃ|S쐬
+		// m[hƂɃ|SA悤ɁAm[h̏Ԃŏݐ߂
+
+		collection::Vector<GltfModelSource::Primitive> primitives;
+
+		{
+			collection::Vector<int64_t> gltfNodeIndices;
+			gltfNodeIndices.resize(m_Nodes.size(), -1);
+
+			for (size_t i = 0; i < gltfNodeCount; i++)
+			{
+				if (nodeIndexMap[i] >= 0)
+				{
+					gltfNodeIndices[nodeIndexMap[i]] = static_cast<int64_t>(i);
+				}
+			}
+
+			const json::Value* pMeshes = json::FindArray(pRoot, "meshes");
+			const json::Value* pSkins = json::FindArray(pRoot, "skins");
+
+			int32_t gltfMaterialCount = static_cast<int32_t>(m_Materials.size());
+			int32_t defaultMaterialIndex = -1;
+
+			uint64_t polygonCount = 0;
+
+			int32_t nodeCount = static_cast<int32_t>(m_Nodes.size());
+
+			for (int32_t nodeIndex = 1; nodeIndex < nodeCount; nodeIndex++)
+			{
+				const json::Value* pNode = json::GetElement(pNodes, gltfNodeIndices[nodeIndex]);
+
+				const json::Value* pMesh = json::GetElement(pMeshes, json::GetInteger(pNode, "mesh", -1));
+				if (pMesh == nullptr)
+				{
+					continue;
+				}
+
+				IModelSource::Node& node = m_Nodes[nodeIndex];
+				node.firstPolygonIndex = static_cast<uint32_t>(polygonCount);
+
+				/**********/
+				/* XL */
+				/**********/
+
+				uint32_t jointCount = 0;
+
+				const json::Value* pSkin = json::GetElement(pSkins, json::GetInteger(pNode, "skin", -1));
+				if (pSkin != nullptr)
+				{
+					const json::Value* pJoints = json::FindArray(pSkin, "joints");
+					size_t skinJointCount = json::GetElementCount(pJoints);
+
+					// _̃{[̃CfbNX 8 rbg
+					if ((skinJointCount == 0) || (skinJointCount > 256))
+					{
+						logger->PrintW(Logger::TYPE_ERROR, L"The number of joints is not supported : Node[%s] Joint[%u]", node.name.c_str(), static_cast<uint32_t>(skinJointCount));
+						return false;
+					}
+
+					GltfModelSource::Accessor inverseBindMatrices{};
+
+					if (json::Find(pSkin, "inverseBindMatrices") != nullptr)
+					{
+						if (GetAccessor(logger, pRoot, json::GetInteger(pSkin, "inverseBindMatrices", -1), 16, inverseBindMatrices) == false)
+						{
+							return false;
+						}
+
+						if (inverseBindMatrices.count < skinJointCount)
+						{
+							logger->PrintW(Logger::TYPE_ERROR, L"The number of inverse bind matrices is insufficient : Node[%s]", node.name.c_str());
+							return false;
+						}
+					}
+
+					node.bones.reserve(skinJointCount);
+
+					for (size_t i = 0; i < skinJointCount; i++)
+					{
+						const json::Value* pJoint = pJoints->elements[i];
+						int64_t gltfJointIndex = (pJoint->type == json::VALUE_TYPE_NUMBER) ? static_cast<int64_t>(pJoint->number) : -1;
+
+						if ((gltfJointIndex < 0) || (static_cast<uint64_t>(gltfJointIndex) >= gltfNodeCount) || (nodeIndexMap[static_cast<size_t>(gltfJointIndex)] < 0))
+						{
+							logger->PrintW(Logger::TYPE_ERROR, L"The joint node is not in the scene : Node[%s] Joint[%u]", node.name.c_str(), static_cast<uint32_t>(i));
+							return false;
+						}
+
+						// toChs񂪂̂܂܃ItZbgsɂȂ
+						IModelSource::Bone bone;
+						bone.nodeIndex = nodeIndexMap[static_cast<size_t>(gltfJointIndex)];
+						bone.nodeName = m_Nodes[bone.nodeIndex].name;
+						bone.offsetMatrix = glm::mat4(1.0f);
+
+						if (inverseBindMatrices.componentCount != 0)
+						{
+							GltfModelSource::ReadFloat(inverseBindMatrices, static_cast<uint32_t>(i), &bone.offsetMatrix[0][0], 16);
+						}
+
+						node.bones.push_back(bone);
+					}
+
+					jointCount = static_cast<uint32_t>(skinJointCount);
+				}
+
+				/****************/
+				/* v~eBu */
+				/****************/
+
+				const json::Value* pPrimitives = json::FindArray(pMesh, "primitives");
+				size_t primitiveCount = json::GetElementCount(pPrimitives);
+
+				for (size_t i = 0; i < primitiveCount; i++)
+				{
+					const json::Value* pPrimitive = pPrimitives->elements[i];
+
+					if (json::GetInteger(pPrimitive, "mode", GltfModelSource::PRIMITIVE_MODE_TRIANGLES) != GltfModelSource::PRIMITIVE_MODE_TRIANGLES)
+					{
+						logger->PrintW(Logger::TYPE_WARNING, L"Primitives other than triangles are not supported : Node[%s]", node.name.c_str());
+						continue;
+					}
+
+					const json::Value* pAttributes = json::FindObject(pPrimitive, "attributes");
+
+					GltfModelSource::Primitive primitive{};
+
+					if (GetAccessor(logger, pRoot, json::GetInteger(pAttributes, "POSITION", -1), 3, primitive.position) == false)
+					{
+						return false;
+					}
+
+					if ((json::Find(pAttributes, "NORMAL") != nullptr) &&
+						(GetAccessor(logger, pRoot, json::GetInteger(pAttributes, "NORMAL", -1), 3, primitive.normal) == false))
+					{
+						return false;
+					}
+
+					if ((json::Find(pAttributes, "TEXCOORD_0") != nullptr) &&
+						(GetAccessor(logger, pRoot, json::GetInteger(pAttributes, "TEXCOORD_0", -1), 2, primitive.texcoord) == false))
+					{
+						return false;
+					}
+
+					if ((jointCount > 0) && (json::Find(pAttributes, "JOINTS_0") != nullptr) && (json::Find(pAttributes, "WEIGHTS_0") != nullptr))
+					{
+						if ((GetAccessor(logger, pRoot, json::GetInteger(pAttributes, "JOINTS_0", -1), 4, primitive.joints) == false) ||
+							(GetAccessor(logger, pRoot, json::GetInteger(pAttributes, "WEIGHTS_0", -1), 4, primitive.weights) == false))
+						{
+							return false;
+						}
+					}
+
+					if ((json::Find(pPrimitive, "indices") != nullptr) &&
+						(GetAccessor(logger, pRoot, json::GetInteger(pPrimitive, "indices", -1), 1, primitive.indices) == false))
+					{
+						return false;
+					}
+
+					uint32_t vertexCount = primitive.position.count;
+
+					if (((primitive.normal.componentCount != 0) && (primitive.normal.count != vertexCount)) ||
+						((primitive.texcoord.componentCount != 0) && (primitive.texcoord.count != vertexCount)) ||
+						((primitive.joints.componentCount != 0) && (primitive.joints.count != vertexCount)) ||
+						((primitive.weights.componentCount != 0) && (primitive.weights.count != vertexCount)))
+					{
+						logger->PrintW(Logger::TYPE_ERROR, L"The number of vertex attributes does not match : Node[%s]", node.name.c_str());
+						return false;
+					}
+
+					uint32_t triangleCount = ((primitive.indices.componentCount != 0) ? primitive.indices.count : vertexCount) / 3;
+					if (triangleCount == 0)
+					{
+						continue;
+					}
+
+					// }eA蓖ĂĂȂv~eBuɂ̓ftHg̃}eA蓖Ă
+					int32_t materialIndex = static_cast<int32_t>(json::GetInteger(pPrimitive, "material", -1));
+					if ((materialIndex < 0) || (materialIndex >= gltfMaterialCount))
+					{
+						if (defaultMaterialIndex < 0)
+						{
+							defaultMaterialIndex = static_cast<int32_t>(m_Materials.size());
+							m_Materials.push_back(IModelSource::Material::Default(L"default"));
+						}
+
+						materialIndex = defaultMaterialIndex;
+					}
+
+					if (std::find(node.materialIndices.begin(), node.materialIndices.end(), materialIndex) == node.materialIndices.end())
+					{
+						node.materialIndices.push_back(materialIndex);
+					}
+
+					primitive.nodeIndex = nodeIndex;
+					primitive.materialIndex = materialIndex;
+					primitive.jointCount = jointCount;
+					primitive.sharedVertex = (primitive.indices.componentCount != 0) && (primitive.normal.componentCount != 0);
+					primitive.firstVertex = 0;
+					primitive.vertexCount = 0;
+					primitive.firstPolygon = static_cast<uint32_t>(polygonCount);
+					primitive.triangleCount = triangleCount;
+
+					primitives.push_back(primitive);
+
+					node.polygonCount += triangleCount;
+					polygonCount += triangleCount;
+
+					if (polygonCount > UINT32_MAX)
+					{
+						logger->PrintA(Logger::TYPE_ERROR, "Too many polygons");
+						return false;
+					}
+				}
+			}
+
+			if (primitives.empty() == true)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "No polygon");
+				return false;
+			}
+
+			m_Polygons.resize(static_cast<size_t>(polygonCount));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ev~eBu̒_̐ɐ
+		// ----------------------------------------------------------------------------------------------------
+
+		// _Lv~eBúACfbNXQƂĂ钸_쐬
+		// i̓v~eBuƂɐāA_A|S̍쐬ƍ킹 2 񕪂ɂȂ
+
+		handle->BeginStage(BACKGROUND_JOB_STAGE_LOAD_SOURCE, static_cast<uint64_t>(primitives.size()) * 2);
+
+		{
+			std::atomic<size_t> nextPrimitive(0);
+
+			auto countFunc = [&primitives, &nextPrimitive, &handle]()
+			{
+				size_t primitiveIndex;
+
+				while ((handle->IsCancelRequested() == false) && ((primitiveIndex = nextPrimitive.fetch_add(1)) < primitives.size()))
+				{
+					GltfModelSource::CountPrimitiveVertices(primitives[primitiveIndex]);
+					handle->AddProgress(1);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(primitives.size(), countFunc);
+
+			// ĂяõXbh
+			countFunc();
+
+			task.Wait();
+		}
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _͈̔͂蓖Ă
+		// ----------------------------------------------------------------------------------------------------
+
+		// v~eBu̓m[h̏Ԃɕł邽߁Am[h̒_A͈͂ɂȂ
+
+		{
+			uint64_t vertexCount = 0;
+
+			auto it_begin = primitives.begin();
+			auto it_end = primitives.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				IModelSource::Node& node = m_Nodes[it->nodeIndex];
+
+				if (it->result == false)
+				{
+					logger->PrintW(Logger::TYPE_ERROR, L"The primitive refers to a vertex that does not exist : Node[%s]", node.name.c_str());
+					return false;
+				}
+
+				if (node.vertexCount == 0)
+				{
+					node.firstVertexIndex = static_cast<uint32_t>(vertexCount);
+				}
+
+				it->firstVertex = static_cast<uint32_t>(vertexCount);
+
+				node.vertexCount += it->vertexCount;
+				vertexCount += it->vertexCount;
+
+				if (vertexCount > UINT32_MAX)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Too many vertices");
+					return false;
+				}
+			}
+
+			m_Vertices.resize(static_cast<size_t>(vertexCount));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _A|Sɍ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// ev~eBuޒ_A|S͈̔͂͏dȂȂ
+
+		{
+			std::atomic<size_t> nextPrimitive(0);
+
+			auto buildFunc = [this, &primitives, &nextPrimitive, &config, &handle]()
+			{
+				size_t primitiveIndex;
+
+				while ((handle->IsCancelRequested() == false) && ((primitiveIndex = nextPrimitive.fetch_add(1)) < primitives.size()))
+				{
+					GltfModelSource::BuildPrimitive(primitives[primitiveIndex], config, m_Vertices.data(), m_Polygons.data());
+					handle->AddProgress(1);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(primitives.size(), buildFunc);
+
+			// ĂяõXbh쐬ɉ
+			buildFunc();
+
+			task.Wait();
+		}
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[h̃{bNX쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			collection::Vector<glm::vec3> aabbMins;
+			collection::Vector<glm::vec3> aabbMaxs;
+
+			aabbMins.resize(m_Nodes.size(), glm::vec3(+VE_FLOAT_MAX));
+			aabbMaxs.resize(m_Nodes.size(), glm::vec3(-VE_FLOAT_MAX));
+
+			auto it_begin = primitives.begin();
+			auto it_end = primitives.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				IModelSource::Node& node = m_Nodes[it->nodeIndex];
+
+				if (it->result == false)
+				{
+					logger->PrintW(Logger::TYPE_ERROR, L"The primitive refers to a vertex or joint that does not exist : Node[%s]", node.name.c_str());
+					return false;
+				}
+
+				node.hasUV |= it->hasUV;
+
+				aabbMins[it->nodeIndex] = glm::min(aabbMins[it->nodeIndex], it->aabbMin);
+				aabbMaxs[it->nodeIndex] = glm::max(aabbMaxs[it->nodeIndex], it->aabbMax);
+			}
+
+			size_t nodeCount = m_Nodes.size();
+
+			for (size_t i = 0; i < nodeCount; i++)
+			{
+				IModelSource::Node& node = m_Nodes[i];
+
+				if (node.polygonCount == 0)
+				{
+					node.bones.clear();
+					continue;
+				}
+
+				if (node.bones.empty() == false)
+				{
+					/**********************/
+					/* {[̃{bNX */
+					/**********************/
+
+					size_t boneCount = node.bones.size();
+
+					collection::Vector<glm::vec3> boneMins;
+					collection::Vector<glm::vec3> boneMaxs;
+
+					boneMins.resize(boneCount, glm::vec3(+VE_FLOAT_MAX));
+					boneMaxs.resize(boneCount, glm::vec3(-VE_FLOAT_MAX));
+
+					IModelSource::Vertex* pVertexBegin = m_Vertices.data() + node.firstVertexIndex;
+					IModelSource::Vertex* pVertexEnd = pVertexBegin + node.vertexCount;
+
+					for (IModelSource::Vertex* pVertex = pVertexBegin; pVertex != pVertexEnd; ++pVertex)
+					{
+						for (uint32_t k = 0; k < 4; k++)
+						{
+							if (pVertex->weights[k] > 0.0f)
+							{
+								boneMins[pVertex->indices[k]] = glm::min(boneMins[pVertex->indices[k]], pVertex->pos);
+								boneMaxs[pVertex->indices[k]] = glm::max(boneMaxs[pVertex->indices[k]], pVertex->pos);
+							}
+						}
+					}
+
+					/************************/
+					/* gp̃{[폜 */
+					/************************/
+
+					collection::Vector<IModelSource::Bone> usedBones;
+					usedBones.reserve(boneCount);
+
+					collection::Vector<uint8_t> boneIndexTable;
+					boneIndexTable.resize(boneCount, 0);
+
+					node.boxes.reserve(boneCount);
+
+					for (size_t j = 0; j < boneCount; j++)
+					{
+						if (boneMins[j].x > boneMaxs[j].x)
+						{
+							continue;
+						}
+
+						boneIndexTable[j] = static_cast<uint8_t>(usedBones.size());
+						usedBones.push_back(node.bones[j]);
+
+						// bVԂ AABB
+						IModelSource::Box box;
+						box.center = (boneMins[j] + boneMaxs[j]) * 0.5f;
+						box.axis[0] = glm::vec3(1.0f, 0.0f, 0.0f);
+						box.axis[1] = glm::vec3(0.0f, 1.0f, 0.0f);
+						box.axis[2] = glm::vec3(0.0f, 0.0f, 1.0f);
+						box.halfExtent = (boneMaxs[j] - boneMins[j]) * 0.5f;
+
+						node.boxes.push_back(box);
+					}
+
+					if (usedBones.size() != boneCount)
+					{
+						for (IModelSource::Vertex* pVertex = pVertexBegin; pVertex != pVertexEnd; ++pVertex)
+						{
+							for (uint32_t k = 0; k < 4; k++)
+							{
+								pVertex->indices[k] = (pVertex->weights[k] > 0.0f) ? boneIndexTable[pVertex->indices[k]] : 0;
+							}
+						}
+					}
+
+					node.bones.swap(usedBones);
+				}
+				else
+				{
+					IModelSource::Box box;
+					box.center = (aabbMins[i] + aabbMaxs[i]) * 0.5f;
+					box.axis[0] = glm::vec3(1.0f, 0.0f, 0.0f);
+					box.axis[1] = glm::vec3(0.0f, 1.0f, 0.0f);
+					box.axis[2] = glm::vec3(0.0f, 0.0f, 1.0f);
+					box.halfExtent = (aabbMaxs[i] - aabbMins[i]) * 0.5f;
+
+					node.boxes.push_back(box);
+				}
+
+				m_MeshNodeCount++;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+
+		logger->PrintA(Logger::TYPE_INFO, "Gltf : Buffer[%u] Primitive[%u] Vertex[%u] Polygon[%u] Node[%u] Material[%u]",
+			static_cast<uint32_t>(m_Buffers.size()),
+			static_cast<uint32_t>(primitives.size()),
+			static_cast<uint32_t>(m_Vertices.size()),
+			static_cast<uint32_t>(m_Polygons.size()),
+			static_cast<uint32_t>(m_Nodes.size()),
+			static_cast<uint32_t>(m_Materials.size()));
+
+		return true;
+	}
+
+	bool GltfModelSource::LoadBuffers(LoggerPtr logger, const json::Value* pRoot, const uint8_t* pBinData, uint64_t binSize)
+	{
+		StringW dirPath;
+		GetDirectoryPath(m_FilePath.c_str(), dirPath);
+
+		const json::Value* pBuffers = json::FindArray(pRoot, "buffers");
+		size_t bufferCount = json::GetElementCount(pBuffers);
+
+		// Base64 WJobt@̃AhXςȂ悤ɁAɊmۂĂ
+		m_Buffers.resize(bufferCount);
+
+		for (size_t i = 0; i < bufferCount; i++)
+		{
+			const json::Value* pBuffer = pBuffers->elements[i];
+			GltfModelSource::Buffer& buffer = m_Buffers[i];
+
+			const char* pUri = json::GetString(pBuffer, "uri", nullptr);
+
+			if (pUri == nullptr)
+			{
+				/***********************/
+				/* GLB  BIN `N */
+				/***********************/
+
+				if ((i != 0) || (pBinData == nullptr))
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "The buffer has no data : Buffer[%u]", static_cast<uint32_t>(i));
+					return false;
+				}
+
+				buffer.pData = pBinData;
+				buffer.size = binSize;
+			}
+			else if (strncmp(pUri, "data:", 5) == 0)
+			{
+				/***************************/
+				/* Base64 ̖ߍ݃f[^ */
+				/***************************/
+
+				const char* pComma = strchr(pUri, ',');
+
+				if ((pComma == nullptr) || (pComma - pUri < 7) || (strncmp(pComma - 7, ";base64", 7) != 0) ||
+					(GltfModelSource::DecodeBase64(pComma + 1, pUri + strlen(pUri), buffer.data) == false))
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Failed to decode the buffer : Buffer[%u]", static_cast<uint32_t>(i));
+					return false;
+				}
+
+				buffer.pData = buffer.data.data();
+				buffer.size = buffer.data.size();
+			}
+			else
+			{
+				/******************/
+				/* Õt@C */
+				/******************/
+
+				StringW path;
+				GltfModelSource::DecodeUri(pUri, path);
+
+				StringW filePath;
+
+				if (IsRelativePath(path.c_str()) == true)
+				{
+					filePath = dirPath;
+					filePath += path;
+				}
+				else
+				{
+					filePath = path;
+				}
+
+				GltfModelSource::MappedFile file{};
+				if (MapFile(logger, filePath.c_str(), file) == false)
+				{
+					return false;
+				}
+
+				m_MappedFiles.push_back(file);
+
+				buffer.pData = file.pData;
+				buffer.size = file.size;
+			}
+
+			int64_t byteLength = json::GetInteger(pBuffer, "byteLength", -1);
+			if ((byteLength < 0) || (static_cast<uint64_t>(byteLength) > buffer.size))
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "The buffer is too small : Buffer[%u]", static_cast<uint32_t>(i));
+				return false;
+			}
+
+			buffer.size = static_cast<uint64_t>(byteLength);
+		}
+
+		return true;
+	}
+
+	void GltfModelSource::LoadMaterials(LoggerPtr logger, const json::Value* pRoot, const ModelSourceConfig& config)
+	{
+		const json::Value* pMaterials = json::FindArray(pRoot, "materials");
+		size_t materialCount = json::GetElementCount(pMaterials);
+
+		m_Materials.reserve(materialCount + 1);
+
+		for (size_t i = 0; i < materialCount; i++)
+		{
+			const json::Value* pMaterial = pMaterials->elements[i];
+
+			StringW name;
+
+			const char* pName = json::GetString(pMaterial, "name", nullptr);
+			if (pName != nullptr)
+			{
+				GltfModelSource::ToWideStringUtf8(pName, name);
+			}
+			else
+			{
+				wchar_t temp[32];
+				wsprintfW(temp, L"material%u", static_cast<uint32_t>(i));
+				name = temp;
+			}
+
+			IModelSource::Material material = IModelSource::Material::Default(name.c_str());
+
+			// ----------------------------------------------------------------------------------------------------
+			// ^bNAtlXtHɋߎ
+			// ----------------------------------------------------------------------------------------------------
+
+			const json::Value* pPbr = json::FindObject(pMaterial, "pbrMetallicRoughness");
+
+			glm::vec4 baseColor = glm::vec4(1.0f);
+			json::GetNumbers(pPbr, "baseColorFactor", &baseColor[0], 4);
+
+			float metallic = static_cast<float>(json::GetNumber(pPbr, "metallicFactor", 1.0));
+			float roughness = static_cast<float>(json::GetNumber(pPbr, "roughnessFactor", 1.0));
+
+			// eNX`̒l͕Ȃ߁AԂ̒lƂ݂Ȃ
+			if (json::Find(pPbr, "metallicRoughnessTexture") != nullptr)
+			{
+				metallic *= 0.5f;
+				roughness *= 0.5f;
+			}
+
+			metallic = glm::clamp(metallic, 0.0f, 1.0f);
+			roughness = glm::clamp(roughness, 0.0f, 1.0f);
+
+			/****************/
+			/* fBt[Y */
+			/****************/
+
+			// tHł͋̊̉f荞݂\łȂ߁AfBt[YSɂ͗ƂȂ
+			material.diffuseColor = baseColor;
+			material.diffuseFactor = 1.0f - metallic * 0.5f;
+
+			if (strcmp(json::GetString(pMaterial, "alphaMode", "OPAQUE"), "OPAQUE") == 0)
+			{
+				material.diffuseColor.a = 1.0f;
+			}
+
+			/****************/
+			/* XyL[ */
+			/****************/
+
+			// ̔˗ 4% A̓x[XJ[Ŕ˂
+			glm::vec3 specularColor = glm::mix(glm::vec3(0.04f), glm::vec3(baseColor), metallic);
+
+			material.specularColor = glm::vec4(specularColor, 1.0f);
+			material.specularFactor = 1.0f - roughness;
+
+			// tlX Blinn-Phong ̎wɕϊ ( alpha = roughness^2 , n = 2 / alpha^2 - 2 )
+			float alpha = std::max(roughness * roughness, 0.01f);
+			material.shininess = glm::clamp(2.0f / (alpha * alpha) - 2.0f, 1.0f, 1000.0f);
+
+			/**************/
+			/* G~bVu */
+			/**************/
+
+			glm::vec3 emissive = glm::vec3(0.0f);
+			json::GetNumbers(pMaterial, "emissiveFactor", &emissive[0], 3);
+
+			const json::Value* pEmissiveStrength = json::FindObject(json::FindObject(pMaterial, "extensions"), "KHR_materials_emissive_strength");
+			emissive *= static_cast<float>(json::GetNumber(pEmissiveStrength, "emissiveStrength", 1.0));
+
+			material.emissiveFactor = GltfModelSource::ToLuminance(emissive);
+
+			/**************/
+			/* eNX` */
+			/**************/
+
+			// ^bNAtlX̃eNX`̓XyL[̃eNX`Ƃ͈ӖقȂ邽ߎgpȂ
+			GltfModelSource::GetTexture(logger, pRoot, json::FindObject(pPbr, "baseColorTexture"), config.pathType, material.diffuseTexture);
+			GltfModelSource::GetTexture(logger, pRoot, json::FindObject(pMaterial, "normalTexture"), config.pathType, material.bumpTexture);
+
+			m_Materials.push_back(material);
+		}
+	}
+
+	bool GltfModelSource::LoadNode(LoggerPtr logger, const json::Value* pRoot, int64_t gltfNodeIndex, int32_t parentIndex, collection::Vector<int32_t>& nodeIndexMap)
+	{
+		const json::Value* pNode = json::GetElement(json::FindArray(pRoot, "nodes"), gltfNodeIndex);
+		if (pNode == nullptr)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The node does not exist : Node[%d]", static_cast<int32_t>(gltfNodeIndex));
+			return false;
+		}
+
+		// zĂA܂͕̐em[h
+		if (nodeIndexMap[static_cast<size_t>(gltfNodeIndex)] >= 0)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The node is referenced more than once : Node[%d]", static_cast<int32_t>(gltfNodeIndex));
+			return false;
+		}
+
+		int32_t nodeIndex = static_cast<int32_t>(m_Nodes.size());
+		nodeIndexMap[static_cast<size_t>(gltfNodeIndex)] = nodeIndex;
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[h쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		IModelSource::Node node;
+
+		const char* pName = json::GetString(pNode, "name", nullptr);
+		if (pName != nullptr)
+		{
+			GltfModelSource::ToWideStringUtf8(pName, node.name);
+		}
+		else
+		{
+			wchar_t temp[32];
+			wsprintfW(temp, L"node%d", static_cast<int32_t>(gltfNodeIndex));
+			node.name = temp;
+		}
+
+		node.parentIndex = parentIndex;
+		node.localTranslation = glm::vec3(0.0f);
+		node.localRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		node.localScaling = glm::vec3(1.0f);
+		node.firstVertexIndex = 0;
+		node.vertexCount = 0;
+		node.firstPolygonIndex = 0;
+		node.polygonCount = 0;
+		node.hasUV = false;
+
+		glm::mat4 matrix;
+
+		if (json::GetNumbers(pNode, "matrix", &matrix[0][0], 16) == true)
+		{
+			glm::vec3 skew;
+			glm::vec4 perspective;
+
+			glm::decompose(matrix, node.localScaling, node.localRotation, node.localTranslation, skew, perspective);
+		}
+		else
+		{
+			json::GetNumbers(pNode, "translation", &node.localTranslation[0], 3);
+			json::GetNumbers(pNode, "scale", &node.localScaling[0], 3);
+
+			// glTF ̉] x y z w ̏
+			float rotation[4];
+			if (json::GetNumbers(pNode, "rotation", rotation, 4) == true)
+			{
+				node.localRotation = glm::quat(rotation[3], rotation[0], rotation[1], rotation[2]);
+			}
+		}
+
+		m_Nodes.push_back(node);
+
+		// ----------------------------------------------------------------------------------------------------
+		// qǂݍ
+		// ----------------------------------------------------------------------------------------------------
+
+		const json::Value* pChildren = json::FindArray(pNode, "children");
+		size_t childCount = json::GetElementCount(pChildren);
+
+		for (size_t i = 0; i < childCount; i++)
+		{
+			const json::Value* pChild = pChildren->elements[i];
+			int64_t gltfChildIndex = (pChild->type == json::VALUE_TYPE_NUMBER) ? static_cast<int64_t>(pChild->number) : -1;
+
+			if (LoadNode(logger, pRoot, gltfChildIndex, nodeIndex, nodeIndexMap) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool GltfModelSource::GetAccessor(LoggerPtr logger, const json::Value* pRoot, int64_t accessorIndex, uint32_t componentCount, GltfModelSource::Accessor& accessor)
+	{
+		const json::Value* pAccessor = json::GetElement(json::FindArray(pRoot, "accessors"), accessorIndex);
+		if (pAccessor == nullptr)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The accessor does not exist : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		if (json::Find(pAccessor, "sparse") != nullptr)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "Sparse accessors are not supported : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// vf̌^
+		// ----------------------------------------------------------------------------------------------------
+
+		static const char* TYPE_NAMES[] = { "SCALAR", "VEC2", "VEC3", "VEC4", "MAT4" };
+		static const uint32_t TYPE_COMPONENT_COUNTS[] = { 1, 2, 3, 4, 16 };
+
+		const char* pType = json::GetString(pAccessor, "type", "");
+		uint32_t typeComponentCount = 0;
+
+		for (uint32_t i = 0; i < _countof(TYPE_NAMES); i++)
+		{
+			if (strcmp(pType, TYPE_NAMES[i]) == 0)
+			{
+				typeComponentCount = TYPE_COMPONENT_COUNTS[i];
+				break;
+			}
+		}
+
+		if (typeComponentCount != componentCount)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The accessor type is invalid : Accessor[%d] Type[%s]", static_cast<int32_t>(accessorIndex), pType);
+			return false;
+		}
+
+		uint64_t componentSize;
+
+		int64_t componentType = json::GetInteger(pAccessor, "componentType", 0);
+		switch (componentType)
+		{
+		case GltfModelSource::COMPONENT_TYPE_BYTE:
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_BYTE:
+			componentSize = 1;
+			break;
+		case GltfModelSource::COMPONENT_TYPE_SHORT:
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_SHORT:
+			componentSize = 2;
+			break;
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_INT:
+		case GltfModelSource::COMPONENT_TYPE_FLOAT:
+			componentSize = 4;
+			break;
+
+		default:
+			logger->PrintA(Logger::TYPE_ERROR, "The component type is invalid : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		int64_t count = json::GetInteger(pAccessor, "count", -1);
+		if ((count < 0) || (count > UINT32_MAX))
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The accessor count is invalid : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		uint64_t elementSize = componentSize * componentCount;
+
+		accessor.pData = nullptr;
+		accessor.stride = elementSize;
+		accessor.componentType = static_cast<GltfModelSource::COMPONENT_TYPE>(componentType);
+		accessor.componentCount = componentCount;
+		accessor.count = static_cast<uint32_t>(count);
+		accessor.normalized = json::GetBoolean(pAccessor, "normalized", false);
+
+		// ----------------------------------------------------------------------------------------------------
+		// obt@r[
+		// ----------------------------------------------------------------------------------------------------
+
+		// obt@r[ꍇ́AׂĂ̗vf 0
+
+		if (json::Find(pAccessor, "bufferView") == nullptr)
+		{
+			return true;
+		}
+
+		const json::Value* pBufferView = json::GetElement(json::FindArray(pRoot, "bufferViews"), json::GetInteger(pAccessor, "bufferView", -1));
+		int64_t bufferIndex = json::GetInteger(pBufferView, "buffer", -1);
+
+		if ((bufferIndex < 0) || (static_cast<uint64_t>(bufferIndex) >= m_Buffers.size()))
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The buffer view is invalid : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		const GltfModelSource::Buffer& buffer = m_Buffers[static_cast<size_t>(bufferIndex)];
+
+		int64_t viewOffset = json::GetInteger(pBufferView, "byteOffset", 0);
+		int64_t viewLength = json::GetInteger(pBufferView, "byteLength", -1);
+		int64_t viewStride = json::GetInteger(pBufferView, "byteStride", 0);
+		int64_t accessorOffset = json::GetInteger(pAccessor, "byteOffset", 0);
+
+		if ((viewOffset < 0) || (viewLength < 0) || (static_cast<uint64_t>(viewOffset) + static_cast<uint64_t>(viewLength) > buffer.size) ||
+			(viewStride < 0) || (viewStride > 255) || ((viewStride != 0) && (static_cast<uint64_t>(viewStride) < elementSize)) ||
+			(accessorOffset < 0))
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The buffer view is out of range : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		if (viewStride != 0)
+		{
+			accessor.stride = static_cast<uint64_t>(viewStride);
+		}
+
+		if ((accessor.count > 0) && (static_cast<uint64_t>(accessorOffset) + accessor.stride * (accessor.count - 1) + elementSize > static_cast<uint64_t>(viewLength)))
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "The accessor is out of range : Accessor[%d]", static_cast<int32_t>(accessorIndex));
+			return false;
+		}
+
+		accessor.pData = buffer.pData + viewOffset + accessorOffset;
+
+		return true;
+	}
+
+	bool GltfModelSource::MapFile(LoggerPtr logger, const wchar_t* pFilePath, GltfModelSource::MappedFile& mappedFile)
+	{
+		HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to open the file : %s", pFilePath);
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if ((GetFileSizeEx(fileHandle, &fileSize) == FALSE) || (fileSize.QuadPart == 0))
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"The file is empty : %s", pFilePath);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to map the file : %s", pFilePath);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		const uint8_t* pData = static_cast<const uint8_t*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (pData == nullptr)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to map the file : %s", pFilePath);
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		mappedFile.fileHandle = fileHandle;
+		mappedFile.mappingHandle = mappingHandle;
+		mappedFile.pData = pData;
+		mappedFile.size = static_cast<uint64_t>(fileSize.QuadPart);
+
+		return true;
+	}
+
+	void GltfModelSource::UnmapFiles()
+	{
+		auto it_begin = m_MappedFiles.begin();
+		auto it_end = m_MappedFiles.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			UnmapViewOfFile(it->pData);
+			CloseHandle(it->mappingHandle);
+			CloseHandle(it->fileHandle);
+		}
+
+		m_MappedFiles.clear();
+	}
+
+	void GltfModelSource::CountPrimitiveVertices(GltfModelSource::Primitive& primitive)
+	{
+		primitive.result = true;
+
+		if (primitive.sharedVertex == false)
+		{
+			// gCAO̊pƂɒ_쐬
+			primitive.vertexCount = primitive.triangleCount * 3;
+			return;
+		}
+
+		collection::Vector<uint8_t> used;
+		used.resize(primitive.position.count, 0);
+
+		uint32_t indexCount = primitive.triangleCount * 3;
+		uint32_t vertexCount = 0;
+
+		for (uint32_t i = 0; i < indexCount; i++)
+		{
+			uint32_t index;
+
+			if ((GltfModelSource::ReadUInt(primitive.indices, i, &index, 1) == false) || (index >= primitive.position.count))
+			{
+				primitive.result = false;
+				return;
+			}
+
+			if (used[index] == 0)
+			{
+				used[index] = 1;
+				vertexCount++;
+			}
+		}
+
+		primitive.vertexCount = vertexCount;
+	}
+
+	void GltfModelSource::BuildPrimitive(GltfModelSource::Primitive& primitive, const ModelSourceConfig& config, IModelSource::Vertex* pVertices, IModelSource::Polygon* pPolygons)
+	{
+		bool hasIndices = (primitive.indices.componentCount != 0);
+		bool hasNormal = (primitive.normal.componentCount != 0);
+		bool hasWeights = (primitive.joints.componentCount != 0) && (primitive.weights.componentCount != 0);
+
+		primitive.aabbMin = glm::vec3(+VE_FLOAT_MAX);
+		primitive.aabbMax = glm::vec3(-VE_FLOAT_MAX);
+		primitive.hasUV = (primitive.texcoord.componentCount != 0);
+		primitive.result = true;
+
+		// ANZT[̒_A쐬_ւ̃CfbNX ( _Lꍇ̂ )
+		collection::Vector<uint32_t> vertexMap;
+		if (primitive.sharedVertex == true)
+		{
+			vertexMap.resize(primitive.position.count, ~0U);
+		}
+
+		IModelSource::Vertex* pVertexBegin = pVertices + primitive.firstVertex;
+		uint32_t vertexCount = 0;
+
+		IModelSource::Polygon* pPolygon = pPolygons + primitive.firstPolygon;
+		IModelSource::Polygon* pPolygonEnd = pPolygon + primitive.triangleCount;
+
+		uint32_t cornerIndex = 0;
+
+		while (pPolygon != pPolygonEnd)
+		{
+			for (uint32_t i = 0; i < 3; i++)
+			{
+				uint32_t index = cornerIndex++;
+
+				if (hasIndices == true)
+				{
+					if (GltfModelSource::ReadUInt(primitive.indices, index, &index, 1) == false)
+					{
+						primitive.result = false;
+						return;
+					}
+				}
+
+				if (index >= primitive.position.count)
+				{
+					primitive.result = false;
+					return;
+				}
+
+				if (primitive.sharedVertex == true)
+				{
+					if (vertexMap[index] != ~0U)
+					{
+						// 쐬ς
+						pPolygon->indices[i] = primitive.firstVertex + vertexMap[index];
+						continue;
+					}
+
+					vertexMap[index] = vertexCount;
+				}
+
+				if (vertexCount >= primitive.vertexCount)
+				{
+					primitive.result = false;
+					return;
+				}
+
+				IModelSource::Vertex* pVertex = pVertexBegin + vertexCount;
+				pPolygon->indices[i] = primitive.firstVertex + vertexCount;
+				vertexCount++;
+
+				/******************/
+				/* ʒuA@AUV */
+				/******************/
+
+				GltfModelSource::ReadFloat(primitive.position, index, &pVertex->pos[0], 3);
+
+				pVertex->uv = glm::vec2(0.0f);
+				pVertex->tangent = glm::vec3(0.0f);
+				pVertex->binormal = glm::vec3(0.0f);
+				pVertex->normal = glm::vec3(0.0f);
+
+				if (hasNormal == true)
+				{
+					GltfModelSource::ReadFloat(primitive.normal, index, &pVertex->normal[0], 3);
+				}
+
+				if (primitive.hasUV == true)
+				{
+					GltfModelSource::ReadFloat(primitive.texcoord, index, &pVertex->uv[0], 2);
+				}
+
+				/************/
+				/* EFCg */
+				/************/
+
+				pVertex->indices[0] = 0;
+				pVertex->indices[1] = 0;
+				pVertex->indices[2] = 0;
+				pVertex->indices[3] = 0;
+				pVertex->weights[0] = 1.0f;
+				pVertex->weights[1] = 0.0f;
+				pVertex->weights[2] = 0.0f;
+				pVertex->weights[3] = 0.0f;
+
+				if (hasWeights == true)
+				{
+					uint32_t joints[4];
+					float weights[4];
+
+					if (GltfModelSource::ReadUInt(primitive.joints, index, joints, 4) == false)
+					{
+						primitive.result = false;
+						return;
+					}
+
+					GltfModelSource::ReadFloat(primitive.weights, index, weights, 4);
+
+					// EFCg̑傫ɕׂ
+					uint32_t order[4] = { 0, 1, 2, 3 };
+					std::sort(order, order + 4, [&weights](uint32_t lh, uint32_t rh) { return weights[lh] > weights[rh]; });
+
+					float weightSum = 0.0f;
+
+					for (uint32_t j = 0; j < 4; j++)
+					{
+						uint32_t src = order[j];
+
+						if (weights[src] > 0.0f)
+						{
+							if (joints[src] >= primitive.jointCount)
+							{
+								primitive.result = false;
+								return;
+							}
+
+							pVertex->indices[j] = static_cast<uint8_t>(joints[src]);
+							pVertex->weights[j] = weights[src];
+							weightSum += weights[src];
+						}
+						else
+						{
+							pVertex->indices[j] = 0;
+							pVertex->weights[j] = 0.0f;
+						}
+					}
+
+					if (weightSum > VE_FLOAT_EPSILON)
+					{
+						float invWeightSum = 1.0f / weightSum;
+
+						for (uint32_t j = 0; j < 4; j++)
+						{
+							pVertex->weights[j] *= invWeightSum;
+						}
+					}
+					else
+					{
+						pVertex->indices[0] = 0;
+						pVertex->weights[0] = 1.0f;
+					}
+				}
+
+				primitive.aabbMin = glm::min(primitive.aabbMin, pVertex->pos);
+				primitive.aabbMax = glm::max(primitive.aabbMax, pVertex->pos);
+			}
+
+			/********/
+			/* @ */
+			/********/
+
+			if (hasNormal == false)
+			{
+				// @ꍇA_̓gCAOƂɍ쐬Ă
+				IModelSource::Vertex& v0 = pVertices[pPolygon->indices[0]];
+				IModelSource::Vertex& v1 = pVertices[pPolygon->indices[1]];
+				IModelSource::Vertex& v2 = pVertices[pPolygon->indices[2]];
+
+				glm::vec3 ab;
+				glm::vec3 bc;
+
+				if (config.flags & MODEL_SOURCE_INVERT_NORMAL)
+				{
+					ab = v0.pos - v1.pos;
+					bc = v2.pos - v1.pos;
+				}
+				else
+				{
+					ab = v0.pos - v1.pos;
+					bc = v1.pos - v2.pos;
+				}
+
+				glm::vec3 normal = glm::normalize(glm::cross(ab, bc));
+
+				v0.normal = normal;
+				v1.normal = normal;
+				v2.normal = normal;
+			}
+
+			/************/
+			/* ڐ */
+			/************/
+
+			if (primitive.hasUV == true)
+			{
+				GltfModelSource::ComputeTangentSpace(pVertices, *pPolygon);
+			}
+
+			/**************/
+			/* }eA */
+			/**************/
+
+			pPolygon->materialIndex = primitive.materialIndex;
+
+			/************/
+			/* ʂ̔] */
+			/************/
+
+			if (config.flags & MODEL_SOURCE_FLIP_FACE)
+			{
+				uint32_t temp = pPolygon->indices[0];
+				pPolygon->indices[0] = pPolygon->indices[2];
+				pPolygon->indices[2] = temp;
+			}
+
+			pPolygon++;
+		}
+
+		VE_ASSERT(vertexCount == primitive.vertexCount);
+
+		/*******************************/
+		/* ڐԂ̐KAUV ̔] */
+		/*******************************/
+
+		IModelSource::Vertex* pVertex = pVertexBegin;
+		IModelSource::Vertex* pVertexEnd = pVertex + vertexCount;
+
+		while (pVertex != pVertexEnd)
+		{
+			if (primitive.hasUV == true)
+			{
+				GltfModelSource::NormalizeTangentSpace(*pVertex);
+			}
+
+			if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_U)
+			{
+				pVertex->uv.x = 1.0f - pVertex->uv.x;
+			}
+
+			if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_V)
+			{
+				pVertex->uv.y = 1.0f - pVertex->uv.y;
+			}
+
+			pVertex++;
+		}
+	}
+
+	void GltfModelSource::ReadFloat(const GltfModelSource::Accessor& accessor, uint32_t index, float* pValues, uint32_t count)
+	{
+		if (accessor.pData == nullptr)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				pValues[i] = 0.0f;
+			}
+
+			return;
+		}
+
+		const uint8_t* pElement = accessor.pData + accessor.stride * index;
+
+		switch (accessor.componentType)
+		{
+		case GltfModelSource::COMPONENT_TYPE_FLOAT:
+			// CAEgv邽߁Aϊɂ̂܂܃Rs[
+			memcpy(pValues, pElement, sizeof(float) * count);
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_BYTE:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				float value = static_cast<float>(static_cast<int8_t>(pElement[i]));
+				pValues[i] = (accessor.normalized == true) ? std::max(value / 127.0f, -1.0f) : value;
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_BYTE:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				float value = static_cast<float>(pElement[i]);
+				pValues[i] = (accessor.normalized == true) ? value / 255.0f : value;
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_SHORT:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				int16_t temp;
+				memcpy(&temp, pElement + sizeof(int16_t) * i, sizeof(int16_t));
+
+				float value = static_cast<float>(temp);
+				pValues[i] = (accessor.normalized == true) ? std::max(value / 32767.0f, -1.0f) : value;
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_SHORT:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint16_t temp;
+				memcpy(&temp, pElement + sizeof(uint16_t) * i, sizeof(uint16_t));
+
+				float value = static_cast<float>(temp);
+				pValues[i] = (accessor.normalized == true) ? value / 65535.0f : value;
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_INT:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint32_t temp;
+				memcpy(&temp, pElement + sizeof(uint32_t) * i, sizeof(uint32_t));
+
+				pValues[i] = static_cast<float>(temp);
+			}
+			break;
+		}
+	}
+
+	bool GltfModelSource::ReadUInt(const GltfModelSource::Accessor& accessor, uint32_t index, uint32_t* pValues, uint32_t count)
+	{
+		if (accessor.pData == nullptr)
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				pValues[i] = 0;
+			}
+
+			return true;
+		}
+
+		const uint8_t* pElement = accessor.pData + accessor.stride * index;
+
+		switch (accessor.componentType)
+		{
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_BYTE:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				pValues[i] = pElement[i];
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_SHORT:
+			for (uint32_t i = 0; i < count; i++)
+			{
+				uint16_t temp;
+				memcpy(&temp, pElement + sizeof(uint16_t) * i, sizeof(uint16_t));
+
+				pValues[i] = temp;
+			}
+			break;
+
+		case GltfModelSource::COMPONENT_TYPE_UNSIGNED_INT:
+			// CAEgv邽߁Aϊɂ̂܂܃Rs[
+			memcpy(pValues, pElement, sizeof(uint32_t) * count);
+			break;
+
+		default:
+			return false;
+		}
+
+		return true;
+	}
+
+	void GltfModelSource::GetTexture(LoggerPtr logger, const json::Value* pRoot, const json::Value* pTextureInfo, MODEL_SOURCE_PATH_TYPE pathType, StringW& texture)
+	{
+		if (pTextureInfo == nullptr)
+		{
+			return;
+		}
+
+		int64_t textureIndex = json::GetInteger(pTextureInfo, "index", -1);
+
+		const json::Value* pTexture = json::GetElement(json::FindArray(pRoot, "textures"), textureIndex);
+		const json::Value* pImage = json::GetElement(json::FindArray(pRoot, "images"), json::GetInteger(pTexture, "source", -1));
+
+		if (pImage == nullptr)
+		{
+			logger->PrintA(Logger::TYPE_WARNING, "The texture has no image : Texture[%d]", static_cast<int32_t>(textureIndex));
+			return;
+		}
+
+		// eNX`̓t@C쐬邽߁Aobt@r[ Base64 Ŗߍ܂ꂽC[W͓ǂݍ߂Ȃ
+		const char* pUri = json::GetString(pImage, "uri", nullptr);
+		if ((pUri == nullptr) || (strncmp(pUri, "data:", 5) == 0))
+		{
+			logger->PrintA(Logger::TYPE_WARNING, "Embedded images are not supported : Texture[%d]", static_cast<int32_t>(textureIndex));
+			return;
+		}
+
+		GltfModelSource::DecodeUri(pUri, texture);
+
+		if (pathType == MODEL_SOURCE_PATH_TYPE_STRIP)
+		{
+			texture = PathFindFileNameW(texture.c_str());
+		}
+	}
+
+	bool GltfModelSource::DecodeBase64(const char* pCurrent, const char* pEnd, collection::Vector<uint8_t>& data)
+	{
+		data.clear();
+		data.reserve(static_cast<size_t>(pEnd - pCurrent) / 4 * 3);
+
+		uint32_t bits = 0;
+		uint32_t bitCount = 0;
+
+		while ((pCurrent != pEnd) && (*pCurrent != '='))
+		{
+			char c = *pCurrent++;
+			uint32_t value;
+
+			if ((c >= 'A') && (c <= 'Z'))
+			{
+				value = c - 'A';
+			}
+			else if ((c >= 'a') && (c <= 'z'))
+			{
+				value = c - 'a' + 26;
+			}
+			else if ((c >= '0') && (c <= '9'))
+			{
+				value = c - '0' + 52;
+			}
+			else if ((c == '+') || (c == '-'))
+			{
+				value = 62;
+			}
+			else if ((c == '/') || (c == '_'))
+			{
+				value = 63;
+			}
+			else
+			{
+				return false;
+			}
+
+			bits = (bits << 6) | value;
+			bitCount += 6;
+
+			if (bitCount >= 8)
+			{
+				bitCount -= 8;
+				data.push_back(static_cast<uint8_t>(bits >> bitCount));
+				bits &= (1U << bitCount) - 1;
+			}
+		}
+
+		return true;
+	}
+
+	void GltfModelSource::DecodeUri(const char* pUri, StringW& path)
+	{
+		// p[ZgGR[fBO߂Ă UTF-8 Chɕϊ
+
+		StringA temp;
+		temp.reserve(strlen(pUri));
+
+		while (*pUri != '\0')
+		{
+			if ((pUri[0] == '%') && (isxdigit(static_cast<uint8_t>(pUri[1])) != 0) && (isxdigit(static_cast<uint8_t>(pUri[2])) != 0))
+			{
+				char hex[3] = { pUri[1], pUri[2], '\0' };
+				temp.push_back(static_cast<char>(strtoul(hex, nullptr, 16)));
+				pUri += 3;
+			}
+			else
+			{
+				temp.push_back(*pUri++);
+			}
+		}
+
+		GltfModelSource::ToWideStringUtf8(temp.c_str(), path);
+	}
+
+	void GltfModelSource::ToWideStringUtf8(const char* pSrc, StringW& dst)
+	{
+		int32_t length = MultiByteToWideChar(CP_UTF8, 0, pSrc, -1, nullptr, 0);
+		if (length <= 0)
+		{
+			dst.clear();
+			return;
+		}
+
+		collection::Vector<wchar_t> buffer;
+		buffer.resize(length);
+
+		MultiByteToWideChar(CP_UTF8, 0, pSrc, -1, buffer.data(), length);
+
+		dst = buffer.data();
+	}
+
+	void GltfModelSource::ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon)
+	{
+		const IModelSource::Vertex& v0 = pVertices[polygon.indices[0]];
+		const IModelSource::Vertex& v1 = pVertices[polygon.indices[1]];
+		const IModelSource::Vertex& v2 = pVertices[polygon.indices[2]];
+
+		glm::vec3 p0 = v0.pos;
+		glm::vec3 p1 = v1.pos;
+		glm::vec3 p2 = v2.pos;
+
+		glm::vec2 t0 = v0.uv;
+		glm::vec2 t1 = v1.uv;
+		glm::vec2 t2 = v2.uv;
+
+		glm::vec3 cp0[3] =
+		{
+			glm::vec3(p0.x, t0.x, t0.y),
+			glm::vec3(p0.y, t0.x, t0.y),
+			glm::vec3(p0.z, t0.x, t0.y),
+		};
+
+		glm::vec3 cp1[3] =
+		{
+			glm::vec3(p1.x, t1.x, t1.y),
+			glm::vec3(p1.y, t1.x, t1.y),
+			glm::vec3(p1.z, t1.x, t1.y),
+		};
+
+		glm::vec3 cp2[3] =
+		{
+			glm::vec3(p2.x, t2.x, t2.y),
+			glm::vec3(p2.y, t2.x, t2.y),
+			glm::vec3(p2.z, t2.x, t2.y),
+		};
+
+		float u[3];
+		float v[3];
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			glm::vec3 v1 = cp1[i] - cp0[i];
+			glm::vec3 v2 = cp2[i] - cp1[i];
+
+			glm::vec3 abc = glm::cross(v1, v2);
+
+			if ((-VE_FLOAT_EPSILON <= abc.x) && (VE_FLOAT_EPSILON >= abc.x))
+			{
+				//kނĂ|S
+				u[i] = 1.0f;
+				v[i] = 1.0f;
+			}
+			else
+			{
+				u[i] = (abc.y / abc.x);
+				v[i] = (abc.z / abc.x);
+			}
+		}
+
+		glm::vec3 tangent = glm::normalize(glm::vec3(u[0], u[1], u[2]));
+		glm::vec3 binormal = glm::normalize(glm::vec3(v[0], v[1], v[2]));
+
+		// _LgCAO̐ڐԂ𑫂킹ĂAŌ NormalizeTangentSpace ŐK
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			IModelSource::Vertex& vertex = pVertices[polygon.indices[i]];
+			vertex.tangent += tangent;
+			vertex.binormal += binormal;
+		}
+	}
+
+	void GltfModelSource::NormalizeTangentSpace(IModelSource::Vertex& vertex)
+	{
+		float tangentLength = glm::length(vertex.tangent);
+		float binormalLength = glm::length(vertex.binormal);
+
+		if ((tangentLength > VE_FLOAT_EPSILON) && (binormalLength > VE_FLOAT_EPSILON))
+		{
+			vertex.tangent /= tangentLength;
+			vertex.binormal /= binormalLength;
+		}
+		else
+		{
+			// 킹ڐԂłĂꍇ́A@쐬
+			glm::vec3 axis = (::fabs(vertex.normal.x) < 0.9f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+			vertex.tangent = glm::normalize(glm::cross(axis, vertex.normal));
+			vertex.binormal = glm::cross(vertex.normal, vertex.tangent);
+		}
+	}
+
+	float GltfModelSource::ToLuminance(const glm::vec3& color)
+	{
+		static const glm::mat3 MAT = glm::mat3(0.4124, 0.2126, 0.0193, 0.3576, 0.7152, 0.1192, 0.1805, 0.0722, 0.9505);
+
+		glm::vec3 xyz = MAT * color;
+
+		return xyz.g;
+	}
+
+}
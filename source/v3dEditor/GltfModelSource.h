@@ -0,0 +1,137 @@
+#pragma once
+
+#include "IModelSource.h"
+
+namespace ve {
+
+	namespace json {
+		struct Value;
+	}
+
+	class GltfModelSource final : public IModelSource
+	{
+	public:
+		static ModelSourcePtr Create();
+
+		GltfModelSource();
+		virtual ~GltfModelSource();
+
+		bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle) override;
+		void GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes) override;
+
+		const wchar_t* GetFilePath() const override;
+		const collection::Vector<IModelSource::Material>& GetMaterials() const override;
+		const collection::Vector<IModelSource::Vertex>& GetVertices() const override;
+		const collection::Vector<IModelSource::Polygon>& GetPolygons() const override;
+		const collection::Vector<IModelSource::Node>& GetNodes() const override;
+		size_t GetEmptyNodeCount() const override;
+		size_t GetMeshNodeCount() const override;
+		void ReleaseGeometry() override;
+
+		VE_DECLARE_ALLOCATOR
+
+	private:
+		static constexpr uint32_t GLB_MAGIC = 0x46546C67; // "glTF"
+		static constexpr uint32_t GLB_VERSION = 2;
+		static constexpr uint32_t GLB_CHUNK_TYPE_JSON = 0x4E4F534A; // "JSON"
+		static constexpr uint32_t GLB_CHUNK_TYPE_BIN = 0x004E4942; // "BIN"
+
+		static constexpr int64_t PRIMITIVE_MODE_TRIANGLES = 4;
+
+		enum COMPONENT_TYPE
+		{
+			COMPONENT_TYPE_BYTE = 5120,
+			COMPONENT_TYPE_UNSIGNED_BYTE = 5121,
+			COMPONENT_TYPE_SHORT = 5122,
+			COMPONENT_TYPE_UNSIGNED_SHORT = 5123,
+			COMPONENT_TYPE_UNSIGNED_INT = 5125,
+			COMPONENT_TYPE_FLOAT = 5126,
+		};
+
+		struct MappedFile
+		{
+			HANDLE fileHandle;
+			HANDLE mappingHandle;
+			const uint8_t* pData;
+			uint64_t size;
+		};
+
+		struct Buffer
+		{
+			const uint8_t* pData; // }bvt@CA܂ data ɓWJew
+			uint64_t size;
+			collection::Vector<uint8_t> data; // Base64 Ŗߍ܂ꂽobt@
+		};
+
+		// obt@r[̗vf𒼐ڎQƂ
+		struct Accessor
+		{
+			const uint8_t* pData; // obt@r[ꍇ nullptr ( ׂĂ̗vf 0 )
+			uint64_t stride;
+			GltfModelSource::COMPONENT_TYPE componentType;
+			uint32_t componentCount;
+			uint32_t count;
+			bool normalized;
+		};
+
+		// ɍ쐬v~eBu
+		struct Primitive
+		{
+			GltfModelSource::Accessor indices; // CfbNXꍇ componentCount  0
+			GltfModelSource::Accessor position;
+			GltfModelSource::Accessor normal;
+			GltfModelSource::Accessor texcoord;
+			GltfModelSource::Accessor joints;
+			GltfModelSource::Accessor weights;
+
+			int32_t nodeIndex;
+			int32_t materialIndex;
+			uint32_t jointCount; // XLꍇ 0
+			bool sharedVertex; // CfbNXƖ@ꍇ́AANZT[̒_gCAOԂŋL
+			uint32_t firstVertex;
+			uint32_t vertexCount;
+			uint32_t firstPolygon;
+			uint32_t triangleCount;
+
+			glm::vec3 aabbMin;
+			glm::vec3 aabbMax;
+			bool hasUV;
+			bool result;
+		};
+
+		StringW m_FilePath;
+		collection::Vector<IModelSource::Material> m_Materials;
+		collection::Vector<IModelSource::Vertex> m_Vertices;
+		collection::Vector<IModelSource::Polygon> m_Polygons;
+		collection::Vector<IModelSource::Node> m_Nodes;
+		size_t m_MeshNodeCount;
+
+		collection::Vector<GltfModelSource::MappedFile> m_MappedFiles;
+		collection::Vector<GltfModelSource::Buffer> m_Buffers;
+
+		bool Load(LoggerPtr logger, const json::Value* pRoot, const uint8_t* pBinData, uint64_t binSize, const ModelSourceConfig& config, BackgroundJobHandlePtr handle);
+		bool LoadBuffers(LoggerPtr logger, const json::Value* pRoot, const uint8_t* pBinData, uint64_t binSize);
+		void LoadMaterials(LoggerPtr logger, const json::Value* pRoot, const ModelSourceConfig& config);
+		bool LoadNode(LoggerPtr logger, const json::Value* pRoot, int64_t gltfNodeIndex, int32_t parentIndex, collection::Vector<int32_t>& nodeIndexMap);
+		bool GetAccessor(LoggerPtr logger, const json::Value* pRoot, int64_t accessorIndex, uint32_t componentCount, GltfModelSource::Accessor& accessor);
+
+		bool MapFile(LoggerPtr logger, const wchar_t* pFilePath, GltfModelSource::MappedFile& mappedFile);
+		void UnmapFiles();
+
+		static void CountPrimitiveVertices(GltfModelSource::Primitive& primitive);
+		static void BuildPrimitive(GltfModelSource::Primitive& primitive, const ModelSourceConfig& config, IModelSource::Vertex* pVertices, IModelSource::Polygon* pPolygons);
+
+		static void ReadFloat(const GltfModelSource::Accessor& accessor, uint32_t index, float* pValues, uint32_t count);
+		static bool ReadUInt(const GltfModelSource::Accessor& accessor, uint32_t index, uint32_t* pValues, uint32_t count);
+
+		static void GetTexture(LoggerPtr logger, const json::Value* pRoot, const json::Value* pTextureInfo, MODEL_SOURCE_PATH_TYPE pathType, StringW& texture);
+		static bool DecodeBase64(const char* pCurrent, const char* pEnd, collection::Vector<uint8_t>& data);
+		static void DecodeUri(const char* pUri, StringW& path);
+		static void ToWideStringUtf8(const char* pSrc, StringW& dst);
+
+		static void ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon);
+		static void NormalizeTangentSpace(IModelSource::Vertex& vertex);
+		static float ToLuminance(const glm::vec3& color);
+	};
+
+}
@@ -17,6 +17,10 @@ namespace ve {
 		virtual uint32_t GetPolygonCount() const = 0;
 		virtual uint32_t GetBoneCount() const = 0;
 
+		// _LbV̓v ( ACMR : gCAOAATVR : _̒_VF[_[̎s )
+		virtual float GetACMR() const = 0;
+		virtual float GetATVR() const = 0;
+
 		virtual const AABB& GetAABB() const = 0;
 
 		virtual bool GetVisible() const = 0;
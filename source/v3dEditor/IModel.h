@@ -10,7 +10,7 @@ namespace ve {
 	public:
 		virtual ~IModel() {}
 
-		virtual bool Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config) = 0;
+		virtual bool Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config, BackgroundJobHandlePtr handle) = 0;
 		virtual bool Load(LoggerPtr logger, const wchar_t* pFilePath) = 0;
 		virtual bool Save(LoggerPtr logger) = 0;
 
@@ -16,9 +16,10 @@ namespace ve {
 			float weights[4];
 		};
 
+		// _ GetVertices Ŏ擾郊XgLACfbNXŎQƂ
 		struct Polygon
 		{
-			IModelSource::Vertex vertices[3];
+			uint32_t indices[3];
 			int32_t materialIndex;
 		};
 
@@ -95,20 +96,29 @@ namespace ve {
 
 			collection::Vector<int32_t> materialIndices;
 
+			// |S̃CfbNX firstVertexIndex  vertexCount ͈̔͂̒_QƂ
+			uint32_t firstVertexIndex;
+			uint32_t vertexCount;
+
 			uint32_t firstPolygonIndex;
 			uint32_t polygonCount;
 
 			bool hasUV;
 		};
 
-		virtual bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config) = 0;
+		virtual bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle) = 0;
+		// pFilePath ̂قɓǂݍރt@C̃pX擾 ( C|[gLbṼnbVɊ܂߂邽߁ALoad ̑OɌĂяo )
+		virtual void GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes) = 0;
 
 		virtual const wchar_t* GetFilePath() const = 0;
 		virtual const collection::Vector<IModelSource::Material>& GetMaterials() const = 0;
+		virtual const collection::Vector<IModelSource::Vertex>& GetVertices() const = 0;
 		virtual const collection::Vector<IModelSource::Polygon>& GetPolygons() const = 0;
 		virtual const collection::Vector<IModelSource::Node>& GetNodes() const = 0;
 		virtual size_t GetEmptyNodeCount() const = 0;
 		virtual size_t GetMeshNodeCount() const = 0;
+		// bV̍쐬Ɏgp_A|S ( ȍ~ GetVerticesAGetPolygons ͋Ԃ )
+		virtual void ReleaseGeometry() = 0;
 
 	protected:
 		virtual ~IModelSource() {}
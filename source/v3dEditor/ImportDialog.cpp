@@ -12,6 +12,8 @@ namespace ve {
 		m_OptimizeEnable(false),
 		m_SommosingEnable(true),
 		m_SmoosingAngle(30.0f),
+		m_PackedVertexEnable(false),
+		m_MemoryBudget(512),
 		m_PathType(0)
 	{
 		m_Rotate[0] = 0.0f;
@@ -24,6 +26,9 @@ namespace ve {
 		m_FileBrowser.SetHash("Import_OpenFile");
 		m_FileBrowser.SetMode(FileBrowser::MODE_OPEN);
 		m_FileBrowser.AddExtension("fbx");
+		m_FileBrowser.AddExtension("obj");
+		m_FileBrowser.AddExtension("gltf");
+		m_FileBrowser.AddExtension("glb");
 	}
 
 	ImportDialog::~ImportDialog()
@@ -155,6 +160,11 @@ namespace ve {
 			ImGui::PopStyleVar();
 		}
 
+		ImGui::Checkbox("PackedVertex###ImportDialog_PackedVertexEnable", &m_PackedVertexEnable);
+
+		// 0 ̏ꍇ͐Ȃ
+		ImGui::SliderInt("MemoryBudget###ImportDialog_MemoryBudget", &m_MemoryBudget, 0, 4096, (m_MemoryBudget > 0) ? "%.0f MB" : "Unlimited");
+
 		// ----------------------------------------------------------------------------------------------------
 		// Config - PathType
 		// ----------------------------------------------------------------------------------------------------
@@ -226,6 +236,8 @@ namespace ve {
 		m_Data.rednererConfig.optimizeEnable = m_OptimizeEnable;
 		m_Data.rednererConfig.smoosingEnable = m_SommosingEnable;
 		m_Data.rednererConfig.smoosingCos = glm::cos(glm::radians(m_SmoosingAngle));
+		m_Data.rednererConfig.packedVertexEnable = m_PackedVertexEnable;
+		m_Data.rednererConfig.memoryBudget = static_cast<uint32_t>(m_MemoryBudget);
 	}
 
 }
\ No newline at end of file
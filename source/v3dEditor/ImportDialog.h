@@ -38,6 +38,8 @@ namespace ve {
 		bool m_OptimizeEnable;
 		bool m_SommosingEnable;
 		float m_SmoosingAngle;
+		bool m_PackedVertexEnable;
+		int32_t m_MemoryBudget;
 		int32_t m_PathType;
 
 		Data m_Data;
@@ -74,6 +74,8 @@ namespace ve {
 		m_PolygonCount = "";
 		m_MeshCount = "";
 		m_BoneCount = "";
+		m_ACMR = "";
+		m_ATVR = "";
 
 		m_MaterialNameList.clear();
 		m_MaterialList.clear();
@@ -106,6 +108,8 @@ namespace ve {
 				m_StartNode = mesh->GetModel()->GetOwner();
 				m_PolygonCount = std::to_string(mesh->GetPolygonCount());
 				m_BoneCount = std::to_string(mesh->GetBoneCount());
+				m_ACMR = std::to_string(mesh->GetACMR());
+				m_ATVR = std::to_string(mesh->GetATVR());
 			}
 			else
 			{
@@ -658,6 +662,8 @@ namespace ve {
 
 			ImGui::InputText("Polygons###Inspector_Mesh_Polygons", &m_PolygonCount[0], m_PolygonCount.size(), ImGuiInputTextFlags_ReadOnly);
 			ImGui::InputText("Bones###Inspector_Mesh_Bones", &m_BoneCount[0], m_BoneCount.size(), ImGuiInputTextFlags_ReadOnly);
+			ImGui::InputText("ACMR###Inspector_Mesh_ACMR", &m_ACMR[0], m_ACMR.size(), ImGuiInputTextFlags_ReadOnly);
+			ImGui::InputText("ATVR###Inspector_Mesh_ATVR", &m_ATVR[0], m_ATVR.size(), ImGuiInputTextFlags_ReadOnly);
 			ImGui::Spacing();
 
 			if (ImGui::Checkbox("Visible###Inspector_Mesh_Visible", &visible) == true)
@@ -62,6 +62,8 @@ namespace ve {
 		StringA m_PolygonCount;
 		StringA m_MeshCount;
 		StringA m_BoneCount;
+		StringA m_ACMR;
+		StringA m_ATVR;
 
 		collection::Vector<StringA> m_MaterialNameList;
 		collection::Vector<const char*> m_MaterialList;
@@ -0,0 +1,640 @@
+#pragma once
+
+namespace ve {
+
+	namespace json {
+
+		enum VALUE_TYPE
+		{
+			VALUE_TYPE_NULL = 0,
+			VALUE_TYPE_BOOLEAN = 1,
+			VALUE_TYPE_NUMBER = 2,
+			VALUE_TYPE_STRING = 3,
+			VALUE_TYPE_ARRAY = 4,
+			VALUE_TYPE_OBJECT = 5,
+		};
+
+		// q̐[̏ ( sȃt@CŃX^bNg؂Ȃ悤ɂ )
+		static constexpr uint32_t MAX_DEPTH = 256;
+
+		struct Value;
+
+		struct Member
+		{
+			StringA name;
+			Value* pValue;
+		};
+
+		struct Value
+		{
+		public:
+			VALUE_TYPE type;
+
+			bool boolean;
+			double number;
+			StringA string; // UTF-8
+
+			collection::Vector<Value*> elements;
+			collection::Vector<Member> members;
+
+			static Value* Create()
+			{
+				return VE_NEW_T(Value);
+			}
+
+			void Destroy()
+			{
+				auto it_element_begin = elements.begin();
+				auto it_element_end = elements.end();
+
+				for (auto it_element = it_element_begin; it_element != it_element_end; ++it_element)
+				{
+					(*it_element)->Destroy();
+				}
+
+				auto it_member_begin = members.begin();
+				auto it_member_end = members.end();
+
+				for (auto it_member = it_member_begin; it_member != it_member_end; ++it_member)
+				{
+					it_member->pValue->Destroy();
+				}
+
+				VE_DELETE_THIS_T(this, Value);
+			}
+
+		private:
+			Value() :
+				type(VALUE_TYPE_NULL),
+				boolean(false),
+				number(0.0)
+			{
+			}
+
+			VE_DECLARE_ALLOCATOR
+		};
+
+		// ----------------------------------------------------------------------------------------------------
+		// Q
+		// ----------------------------------------------------------------------------------------------------
+
+		static const Value* Find(const Value* pObject, const char* pName)
+		{
+			if ((pObject == nullptr) || (pObject->type != VALUE_TYPE_OBJECT))
+			{
+				return nullptr;
+			}
+
+			auto it = std::find_if(pObject->members.begin(), pObject->members.end(), [pName](const Member& member) { return member.name == pName; });
+			if (it == pObject->members.end())
+			{
+				return nullptr;
+			}
+
+			return it->pValue;
+		}
+
+		static const Value* FindObject(const Value* pObject, const char* pName)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_OBJECT)) ? pValue : nullptr;
+		}
+
+		static const Value* FindArray(const Value* pObject, const char* pName)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_ARRAY)) ? pValue : nullptr;
+		}
+
+		static const Value* GetElement(const Value* pArray, int64_t index)
+		{
+			if ((pArray == nullptr) || (pArray->type != VALUE_TYPE_ARRAY) || (index < 0) || (static_cast<uint64_t>(index) >= pArray->elements.size()))
+			{
+				return nullptr;
+			}
+
+			return pArray->elements[static_cast<size_t>(index)];
+		}
+
+		static size_t GetElementCount(const Value* pArray)
+		{
+			if ((pArray == nullptr) || (pArray->type != VALUE_TYPE_ARRAY))
+			{
+				return 0;
+			}
+
+			return pArray->elements.size();
+		}
+
+		static double GetNumber(const Value* pObject, const char* pName, double defaultValue)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_NUMBER)) ? pValue->number : defaultValue;
+		}
+
+		static int64_t GetInteger(const Value* pObject, const char* pName, int64_t defaultValue)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_NUMBER)) ? static_cast<int64_t>(pValue->number) : defaultValue;
+		}
+
+		static bool GetBoolean(const Value* pObject, const char* pName, bool defaultValue)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_BOOLEAN)) ? pValue->boolean : defaultValue;
+		}
+
+		static const char* GetString(const Value* pObject, const char* pName, const char* pDefaultValue)
+		{
+			const Value* pValue = Find(pObject, pName);
+
+			return ((pValue != nullptr) && (pValue->type == VALUE_TYPE_STRING)) ? pValue->string.c_str() : pDefaultValue;
+		}
+
+		// l̔zǂݍ ( vf̐ count ƈvȂꍇ false Ԃ )
+		static bool GetNumbers(const Value* pObject, const char* pName, float* pValues, size_t count)
+		{
+			const Value* pArray = FindArray(pObject, pName);
+			if ((pArray == nullptr) || (pArray->elements.size() != count))
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < count; i++)
+			{
+				if (pArray->elements[i]->type != VALUE_TYPE_NUMBER)
+				{
+					return false;
+				}
+
+				pValues[i] = static_cast<float>(pArray->elements[i]->number);
+			}
+
+			return true;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// 
+		// ----------------------------------------------------------------------------------------------------
+
+		static const char* SkipSpace(const char* pCurrent, const char* pEnd)
+		{
+			while ((pCurrent != pEnd) && ((*pCurrent == ' ') || (*pCurrent == '\t') || (*pCurrent == '\n') || (*pCurrent == '\r')))
+			{
+				pCurrent++;
+			}
+
+			return pCurrent;
+		}
+
+		static bool ParseKeyword(const char*& pCurrent, const char* pEnd, const char* pKeyword)
+		{
+			const char* pTemp = pCurrent;
+
+			while (*pKeyword != '\0')
+			{
+				if ((pTemp == pEnd) || (*pTemp != *pKeyword))
+				{
+					return false;
+				}
+
+				pTemp++;
+				pKeyword++;
+			}
+
+			pCurrent = pTemp;
+
+			return true;
+		}
+
+		static bool ParseHex4(const char*& pCurrent, const char* pEnd, uint32_t& code)
+		{
+			code = 0;
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				if (pCurrent == pEnd)
+				{
+					return false;
+				}
+
+				char c = *pCurrent++;
+				code <<= 4;
+
+				if ((c >= '0') && (c <= '9'))
+				{
+					code |= c - '0';
+				}
+				else if ((c >= 'a') && (c <= 'f'))
+				{
+					code |= c - 'a' + 10;
+				}
+				else if ((c >= 'A') && (c <= 'F'))
+				{
+					code |= c - 'A' + 10;
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		static bool ParseString(const char*& pCurrent, const char* pEnd, StringA& string)
+		{
+			if ((pCurrent == pEnd) || (*pCurrent != '"'))
+			{
+				return false;
+			}
+
+			pCurrent++;
+
+			string.clear();
+
+			while (pCurrent != pEnd)
+			{
+				// GXP[v̖͈͂͂܂Ƃ߂Ēǉ
+				const char* pBegin = pCurrent;
+				while ((pCurrent != pEnd) && (*pCurrent != '"') && (*pCurrent != '\\'))
+				{
+					pCurrent++;
+				}
+
+				string.append(pBegin, pCurrent);
+
+				if (pCurrent == pEnd)
+				{
+					return false;
+				}
+
+				if (*pCurrent == '"')
+				{
+					pCurrent++;
+					return true;
+				}
+
+				// GXP[v
+				pCurrent++;
+				if (pCurrent == pEnd)
+				{
+					return false;
+				}
+
+				char c = *pCurrent++;
+
+				switch (c)
+				{
+				case '"':
+				case '\\':
+				case '/':
+					string.push_back(c);
+					break;
+				case 'b':
+					string.push_back('\b');
+					break;
+				case 'f':
+					string.push_back('\f');
+					break;
+				case 'n':
+					string.push_back('\n');
+					break;
+				case 'r':
+					string.push_back('\r');
+					break;
+				case 't':
+					string.push_back('\t');
+					break;
+				case 'u':
+				{
+					uint32_t code;
+					if (ParseHex4(pCurrent, pEnd, code) == false)
+					{
+						return false;
+					}
+
+					// TQ[gyA
+					if ((code >= 0xD800) && (code <= 0xDBFF))
+					{
+						uint32_t lowCode;
+						if ((ParseKeyword(pCurrent, pEnd, "\\u") == false) || (ParseHex4(pCurrent, pEnd, lowCode) == false) || (lowCode < 0xDC00) || (lowCode > 0xDFFF))
+						{
+							return false;
+						}
+
+						code = 0x10000 + ((code - 0xD800) << 10) + (lowCode - 0xDC00);
+					}
+
+					// UTF-8 ɕϊ
+					if (code < 0x80)
+					{
+						string.push_back(static_cast<char>(code));
+					}
+					else if (code < 0x800)
+					{
+						string.push_back(static_cast<char>(0xC0 | (code >> 6)));
+						string.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					else if (code < 0x10000)
+					{
+						string.push_back(static_cast<char>(0xE0 | (code >> 12)));
+						string.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+						string.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+					else
+					{
+						string.push_back(static_cast<char>(0xF0 | (code >> 18)));
+						string.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+						string.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+						string.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+					}
+				}
+				break;
+
+				default:
+					return false;
+				}
+			}
+
+			return false;
+		}
+
+		// P[̉e󂯂Ȃ悤ɎOŉ͂
+		static bool ParseNumber(const char*& pCurrent, const char* pEnd, double& number)
+		{
+			const char* pTemp = pCurrent;
+
+			bool negative = false;
+			if ((pTemp != pEnd) && (*pTemp == '-'))
+			{
+				negative = true;
+				pTemp++;
+			}
+
+			uint64_t mantissa = 0;
+			int32_t exponent = 0;
+			uint32_t digitCount = 0;
+
+			//  19 ܂ŕێAȍ~͎̌wɌJ
+			while ((pTemp != pEnd) && (*pTemp >= '0') && (*pTemp <= '9'))
+			{
+				if (mantissa < 1000000000000000000ULL)
+				{
+					mantissa = mantissa * 10 + (*pTemp - '0');
+				}
+				else
+				{
+					exponent++;
+				}
+
+				pTemp++;
+				digitCount++;
+			}
+
+			if (digitCount == 0)
+			{
+				return false;
+			}
+
+			if ((pTemp != pEnd) && (*pTemp == '.'))
+			{
+				pTemp++;
+
+				uint32_t fractionCount = 0;
+
+				while ((pTemp != pEnd) && (*pTemp >= '0') && (*pTemp <= '9'))
+				{
+					if (mantissa < 1000000000000000000ULL)
+					{
+						mantissa = mantissa * 10 + (*pTemp - '0');
+						exponent--;
+					}
+
+					pTemp++;
+					fractionCount++;
+				}
+
+				if (fractionCount == 0)
+				{
+					return false;
+				}
+			}
+
+			if ((pTemp != pEnd) && ((*pTemp == 'e') || (*pTemp == 'E')))
+			{
+				pTemp++;
+
+				bool negativeExponent = false;
+				if ((pTemp != pEnd) && ((*pTemp == '-') || (*pTemp == '+')))
+				{
+					negativeExponent = (*pTemp == '-');
+					pTemp++;
+				}
+
+				int32_t value = 0;
+				uint32_t exponentCount = 0;
+
+				while ((pTemp != pEnd) && (*pTemp >= '0') && (*pTemp <= '9'))
+				{
+					if (value < 10000)
+					{
+						value = value * 10 + (*pTemp - '0');
+					}
+
+					pTemp++;
+					exponentCount++;
+				}
+
+				if (exponentCount == 0)
+				{
+					return false;
+				}
+
+				exponent += negativeExponent ? -value : value;
+			}
+
+			number = static_cast<double>(mantissa);
+
+			if (exponent > 0)
+			{
+				number *= std::pow(10.0, exponent);
+			}
+			else if (exponent < 0)
+			{
+				number /= std::pow(10.0, -exponent);
+			}
+
+			if (negative == true)
+			{
+				number = -number;
+			}
+
+			pCurrent = pTemp;
+
+			return true;
+		}
+
+		static bool ParseValue(const char*& pCurrent, const char* pEnd, Value* pValue, uint32_t depth)
+		{
+			if (depth >= MAX_DEPTH)
+			{
+				return false;
+			}
+
+			pCurrent = SkipSpace(pCurrent, pEnd);
+			if (pCurrent == pEnd)
+			{
+				return false;
+			}
+
+			switch (*pCurrent)
+			{
+			case '{':
+			{
+				pValue->type = VALUE_TYPE_OBJECT;
+
+				pCurrent = SkipSpace(pCurrent + 1, pEnd);
+				if ((pCurrent != pEnd) && (*pCurrent == '}'))
+				{
+					pCurrent++;
+					return true;
+				}
+
+				while (true)
+				{
+					Member member;
+					member.pValue = nullptr;
+
+					pCurrent = SkipSpace(pCurrent, pEnd);
+					if (ParseString(pCurrent, pEnd, member.name) == false)
+					{
+						return false;
+					}
+
+					pCurrent = SkipSpace(pCurrent, pEnd);
+					if (ParseKeyword(pCurrent, pEnd, ":") == false)
+					{
+						return false;
+					}
+
+					member.pValue = Value::Create();
+					if (member.pValue == nullptr)
+					{
+						return false;
+					}
+
+					// sꍇ Destroy ŉ悤ɁAɒǉĂ
+					pValue->members.push_back(member);
+
+					if (ParseValue(pCurrent, pEnd, member.pValue, depth + 1) == false)
+					{
+						return false;
+					}
+
+					pCurrent = SkipSpace(pCurrent, pEnd);
+					if (ParseKeyword(pCurrent, pEnd, ",") == false)
+					{
+						return ParseKeyword(pCurrent, pEnd, "}");
+					}
+				}
+			}
+			break;
+
+			case '[':
+			{
+				pValue->type = VALUE_TYPE_ARRAY;
+
+				pCurrent = SkipSpace(pCurrent + 1, pEnd);
+				if ((pCurrent != pEnd) && (*pCurrent == ']'))
+				{
+					pCurrent++;
+					return true;
+				}
+
+				while (true)
+				{
+					Value* pElement = Value::Create();
+					if (pElement == nullptr)
+					{
+						return false;
+					}
+
+					pValue->elements.push_back(pElement);
+
+					if (ParseValue(pCurrent, pEnd, pElement, depth + 1) == false)
+					{
+						return false;
+					}
+
+					pCurrent = SkipSpace(pCurrent, pEnd);
+					if (ParseKeyword(pCurrent, pEnd, ",") == false)
+					{
+						return ParseKeyword(pCurrent, pEnd, "]");
+					}
+				}
+			}
+			break;
+
+			case '"':
+				pValue->type = VALUE_TYPE_STRING;
+				return ParseString(pCurrent, pEnd, pValue->string);
+
+			case 't':
+				pValue->type = VALUE_TYPE_BOOLEAN;
+				pValue->boolean = true;
+				return ParseKeyword(pCurrent, pEnd, "true");
+
+			case 'f':
+				pValue->type = VALUE_TYPE_BOOLEAN;
+				pValue->boolean = false;
+				return ParseKeyword(pCurrent, pEnd, "false");
+
+			case 'n':
+				pValue->type = VALUE_TYPE_NULL;
+				return ParseKeyword(pCurrent, pEnd, "null");
+			}
+
+			pValue->type = VALUE_TYPE_NUMBER;
+
+			return ParseNumber(pCurrent, pEnd, pValue->number);
+		}
+
+		static Value* Load(const char* pData, size_t dataSize)
+		{
+			const char* pCurrent = pData;
+			const char* pEnd = pData + dataSize;
+
+			// UTF-8  BOM
+			ParseKeyword(pCurrent, pEnd, "\xEF\xBB\xBF");
+
+			Value* pDocument = Value::Create();
+			if (pDocument == nullptr)
+			{
+				return nullptr;
+			}
+
+			if (ParseValue(pCurrent, pEnd, pDocument, 0) == false)
+			{
+				pDocument->Destroy();
+				return nullptr;
+			}
+
+			// ̋ ( GLB ̃`N̓Xy[XŖ߂Ă ) ȊOcĂꍇ̓G[
+			if (SkipSpace(pCurrent, pEnd) != pEnd)
+			{
+				pDocument->Destroy();
+				return nullptr;
+			}
+
+			return pDocument;
+		}
+
+	}
+
+}
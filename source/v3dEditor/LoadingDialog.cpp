@@ -0,0 +1,78 @@
+#include "LoadingDialog.h"
+#include "BackgroundQueue.h"
+
+namespace ve {
+
+	LoadingDialog::LoadingDialog() : GuiFloat("Loading", ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize),
+		m_ScreenSize(0)
+	{
+	}
+
+	LoadingDialog::~LoadingDialog()
+	{
+	}
+
+	void LoadingDialog::Render(const glm::uvec2& screenSize, BackgroundJobHandlePtr handle)
+	{
+		VE_ASSERT(handle != nullptr);
+
+		m_ScreenSize = screenSize;
+		m_Handle = handle;
+
+		GuiFloat::Render();
+
+		m_Handle = nullptr;
+	}
+
+	bool LoadingDialog::OnRender()
+	{
+		uint64_t doneCount;
+		uint64_t totalCount;
+		m_Handle->GetProgress(doneCount, totalCount);
+
+		// A͓ƗčXV邽߁A𒴂邱Ƃ
+		doneCount = std::min(doneCount, totalCount);
+
+		char overlay[128];
+		float fraction;
+
+		if (totalCount > 0)
+		{
+			sprintf_s(overlay, "%llu/%llu", doneCount, totalCount);
+			fraction = static_cast<float>(static_cast<double>(doneCount) / static_cast<double>(totalCount));
+		}
+		else
+		{
+			overlay[0] = '\0';
+			fraction = 0.0f;
+		}
+
+		if (m_Handle->IsCancelRequested() == false)
+		{
+			ImGui::Text("Loading...");
+			ImGui::SameLine();
+
+			if (ImGui::Button("Cancel###Loading_Cancel") == true)
+			{
+				m_Handle->Cancel();
+			}
+		}
+		else
+		{
+			ImGui::Text("Canceling...");
+		}
+
+		ImGui::ProgressBar(fraction, ImVec2(256.0f, 0.0f), overlay);
+
+		ImVec2 windowSize = ImGui::GetWindowSize();
+
+		ImVec2 windowPos;
+		windowPos.x = (static_cast<float>(m_ScreenSize.x) - windowSize.x) * 0.5f;
+		windowPos.y = static_cast<float>(m_ScreenSize.y) - windowSize.y - 16.0f;
+
+		ImGui::SetWindowPos(GetName(), windowPos);
+
+		return false;
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "GuiFloat.h"
+
+namespace ve {
+
+	// 炸ɁAobNOEhœǂݍłiʂ̉ɕ\
+	class LoadingDialog final : public GuiFloat
+	{
+	public:
+		LoadingDialog();
+		virtual~LoadingDialog();
+
+		void Render(const glm::uvec2& screenSize, BackgroundJobHandlePtr handle);
+
+	private:
+		glm::uvec2 m_ScreenSize;
+		BackgroundJobHandlePtr m_Handle;
+
+		bool OnRender() override;
+	};
+
+}
@@ -6,6 +6,7 @@
 #include "GraphicsFactory.h"
 #include "DynamicBuffer.h"
 #include "Texture.h"
+#include "TextureLoader.h"
 #include "IMesh.h"
 
 //#define VE_MATERIAL_NO_TEXTURE
@@ -577,7 +578,7 @@ namespace ve {
 	/* private - Material */
 	/**********************/
 
-	bool Material::Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath)
+	bool Material::Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath, TextureLoaderPtr textureLoader)
 	{
 		// ----------------------------------------------------------------------------------------------------
 		// t@Cwb_[ǂݍ
@@ -636,7 +637,7 @@ namespace ve {
 			wchar_t filePath[1024];
 			if (PathCombineW(filePath, pDirPath, data.diffuseTexture) != nullptr)
 			{
-				SetDiffuseTexture(Texture::Create(impl->deviceContext, filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
+				SetDiffuseTexture(textureLoader->Add(filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
 			}
 			else
 			{
@@ -650,7 +651,7 @@ namespace ve {
 			wchar_t filePath[1024];
 			if (PathCombineW(filePath, pDirPath, data.specularTexture) != nullptr)
 			{
-				SetSpecularTexture(Texture::Create(impl->deviceContext, filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
+				SetSpecularTexture(textureLoader->Add(filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
 			}
 			else
 			{
@@ -663,7 +664,7 @@ namespace ve {
 			wchar_t filePath[1024];
 			if (PathCombineW(filePath, pDirPath, data.bumpTexture) != nullptr)
 			{
-				SetBumpTexture(Texture::Create(impl->deviceContext, filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
+				SetBumpTexture(textureLoader->Add(filePath, V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3D_ACCESS_SHADER_READ));
 			}
 			else
 			{
@@ -775,6 +776,32 @@ namespace ve {
 		return true;
 	}
 
+	void Material::RebindTextures()
+	{
+#ifndef VE_MATERIAL_NO_TEXTURE
+		for (uint32_t i = 0; i < Material::TEXTURE_TYPE_COUNT; i++)
+		{
+			Material::TextureInfo& info = impl->textureInfos[i];
+			if (info.enable == true)
+			{
+				if (impl->textures[impl->nextTexturesIndex][i] == nullptr)
+				{
+					impl->textures[impl->nextTexturesIndex][i] = impl->textures[impl->curTexturesIndex][i];
+				}
+
+				// v[Xz_[Ƃ̓~bv}bṽxقȂ邽߁ATv[XV
+				info.mipLevel = impl->textures[impl->nextTexturesIndex][i]->GetNativeImageViewPtr()->GetDesc().levelCount - 1;
+				info.update = true;
+
+				VE_SET_BIT(impl->updateFlags, Material::UPDATE_TEXTURES);
+				VE_SET_BIT(impl->updateFlags, Material::UPDATE_SAMPLERS);
+			}
+		}
+
+		Update();
+#endif //VE_MATERIAL_NO_TEXTURE
+	}
+
 	void Material::Connect(IMesh* pMesh, uint32_t subsetIndex)
 	{
 		Material::Session session;
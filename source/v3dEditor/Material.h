@@ -175,9 +175,12 @@ namespace ve {
 
 		// ----------------------------------------------------------------------------------------------------
 
-		bool Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath);
+		bool Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath, TextureLoaderPtr textureLoader);
 		bool Save(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath);
 
+		// TextureLoader ̓ǂݍ݂IeNX`AfXNv^Zbgɐݒ肵
+		void RebindTextures();
+
 		void Connect(IMesh* pMesh, uint32_t subsetIndex);
 		void Disconnect(IMesh* pMesh);
 
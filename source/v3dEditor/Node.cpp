@@ -211,6 +211,19 @@ namespace ve {
 		}
 	}
 
+	void Node::Remove(NodePtr node)
+	{
+		NodePtr parent = node->GetParent();
+		if (parent != nullptr)
+		{
+			auto it = std::find(parent->impl->childs.begin(), parent->impl->childs.end(), node);
+			VE_ASSERT(it != parent->impl->childs.end());
+			parent->impl->childs.erase(it);
+
+			node->impl->parent.reset();
+		}
+	}
+
 	const glm::mat4& Node::GetLocalMatrix() const
 	{
 		return impl->localMatrix;
@@ -316,51 +329,4 @@ namespace ve {
 		}
 	}
 
-	void Node::Draw(
-		const Frustum& frustum,
-		uint32_t frameIndex,
-		collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
-		collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets,
-		uint32_t debugFlags, DebugRenderer* pDebugRenderer)
-	{
-		if (impl->attribute->Draw(frustum, frameIndex, opacityDrawSets, transparencyDrawSets) == true)
-		{
-			if (debugFlags != 0)
-			{
-				impl->attribute->DebugDraw(debugFlags, pDebugRenderer);
-			}
-		}
-
-		if (impl->childs.empty() == false)
-		{
-			auto it_begin = impl->childs.begin();
-			auto it_end = impl->childs.end();
-
-			for (auto it = it_begin; it != it_end; ++it)
-			{
-				(*it)->Draw(frustum, frameIndex, opacityDrawSets, transparencyDrawSets, debugFlags, pDebugRenderer);
-			}
-		}
-	}
-
-	void Node::DrawShadow(
-		const Sphere& sphere,
-		uint32_t frameIndex,
-		collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
-		AABB& aabb)
-	{
-		impl->attribute->DrawShadow(sphere, frameIndex, shadowDrawSets, aabb);
-
-		if (impl->childs.empty() == false)
-		{
-			auto it_begin = impl->childs.begin();
-			auto it_end = impl->childs.end();
-
-			for (auto it = it_begin; it != it_end; ++it)
-			{
-				(*it)->DrawShadow(sphere, frameIndex, shadowDrawSets, aabb);
-			}
-		}
-	}
-
 }
\ No newline at end of file
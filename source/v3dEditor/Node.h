@@ -34,6 +34,7 @@ namespace ve {
 		static NodePtr Find(NodePtr node, const wchar_t* pName);
 		static void RemoveByName(NodePtr node, const wchar_t* pName);
 		static void RemoveByGroup(NodePtr node, uint32_t groupMask);
+		static void Remove(NodePtr node);
 
 		const glm::mat4& GetLocalMatrix() const;
 		const Transform& GetLocalTransform() const;
@@ -49,19 +50,6 @@ namespace ve {
 		void Update();
 		void Update(const glm::mat4& worldMatrix);
 
-		void Draw(
-			const Frustum& frustum,
-			uint32_t frameIndex,
-			collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
-			collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets,
-			uint32_t debugFlags, DebugRenderer* pDebugRenderer);
-
-		void DrawShadow(
-			const Sphere& sphere,
-			uint32_t frameIndex,
-			collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
-			AABB& aabb);
-
 		VE_DECLARE_ALLOCATOR
 
 	private:
@@ -8,6 +8,7 @@
 namespace ve {
 
 	class DebugRenderer;
+	class AabbTree;
 
 	class NodeAttribute
 	{
@@ -51,6 +52,9 @@ namespace ve {
 		virtual void SetSelectKey(uint32_t key) {}
 		virtual void DrawSelect(uint32_t frameIndex, SelectDrawSet& drawSet) {}
 
+		// V[ AABB c[ɋEo^ ( nullptr ̏ꍇ͓o^ )
+		virtual void SetAabbTree(AabbTree* pAabbTree) {}
+
 	private:
 		struct Impl;
 		Impl* impl;
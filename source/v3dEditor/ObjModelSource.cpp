@@ -0,0 +1,1779 @@
+#include "ObjModelSource.h"
+#include "DeviceContext.h"
+#include "Logger.h"
+#include "BackgroundQueue.h"
+#include "ParallelTask.h"
+#include <atomic>
+
+namespace ve {
+
+	ModelSourcePtr ObjModelSource::Create()
+	{
+		return std::move(std::make_shared<ObjModelSource>());
+	}
+
+	ObjModelSource::ObjModelSource() :
+		m_MeshNodeCount(0)
+	{
+	}
+
+	ObjModelSource::~ObjModelSource()
+	{
+	}
+
+	bool ObjModelSource::Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle)
+	{
+		m_FilePath = pFilePath;
+
+		// ----------------------------------------------------------------------------------------------------
+		// t@CɃ}bv
+		// ----------------------------------------------------------------------------------------------------
+
+		HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to open the file : %s", pFilePath);
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if ((GetFileSizeEx(fileHandle, &fileSize) == FALSE) || (fileSize.QuadPart == 0))
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"The file is empty : %s", pFilePath);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to map the file : %s", pFilePath);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		const char* pData = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (pData == nullptr)
+		{
+			logger->PrintW(Logger::TYPE_ERROR, L"Failed to map the file : %s", pFilePath);
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// [h
+		// ----------------------------------------------------------------------------------------------------
+
+		bool result = Load(logger, pData, static_cast<uint64_t>(fileSize.QuadPart), config, handle);
+
+		UnmapViewOfFile(pData);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+
+		return result;
+	}
+
+	void ObjModelSource::GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes)
+	{
+		// }eACu ( mtllib ) ̍s𒲂ׂ ( JȂꍇ Load Ŏs )
+
+		HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if ((GetFileSizeEx(fileHandle, &fileSize) == FALSE) || (fileSize.QuadPart == 0))
+		{
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mappingHandle == nullptr)
+		{
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		const char* pData = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+		if (pData == nullptr)
+		{
+			CloseHandle(mappingHandle);
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		StringW dirPath;
+		GetDirectoryPath(pFilePath, dirPath);
+
+		const char* pCurrent = pData;
+		const char* pEnd = pData + fileSize.QuadPart;
+
+		while (pCurrent != pEnd)
+		{
+			const char* pNextLine = ObjModelSource::SkipLine(pCurrent, pEnd);
+
+			const char* pLineEnd = pNextLine;
+			while ((pLineEnd != pCurrent) && ((pLineEnd[-1] == '\n') || (pLineEnd[-1] == '\r')))
+			{
+				pLineEnd--;
+			}
+
+			const char* pLine = ObjModelSource::SkipSpace(pCurrent, pLineEnd);
+			const char* pArgs;
+
+			if (ObjModelSource::IsKeyword(pLine, pLineEnd, "mtllib", pArgs) == true)
+			{
+				StringA fileNames;
+				ObjModelSource::ParseName(pArgs, pLineEnd, fileNames);
+
+				ObjModelSource::AddMaterialLibraryFilePathes(dirPath.c_str(), fileNames, filePathes);
+			}
+
+			pCurrent = pNextLine;
+		}
+
+		UnmapViewOfFile(pData);
+		CloseHandle(mappingHandle);
+		CloseHandle(fileHandle);
+	}
+
+	const wchar_t* ObjModelSource::GetFilePath() const
+	{
+		return m_FilePath.c_str();
+	}
+
+	const collection::Vector<IModelSource::Material>& ObjModelSource::GetMaterials() const
+	{
+		return m_Materials;
+	}
+
+	const collection::Vector<IModelSource::Vertex>& ObjModelSource::GetVertices() const
+	{
+		return m_Vertices;
+	}
+
+	const collection::Vector<IModelSource::Polygon>& ObjModelSource::GetPolygons() const
+	{
+		return m_Polygons;
+	}
+
+	const collection::Vector<IModelSource::Node>& ObjModelSource::GetNodes() const
+	{
+		return m_Nodes;
+	}
+
+	size_t ObjModelSource::GetEmptyNodeCount() const
+	{
+		return m_Nodes.size() - m_MeshNodeCount;
+	}
+
+	size_t ObjModelSource::GetMeshNodeCount() const
+	{
+		return m_MeshNodeCount;
+	}
+
+	void ObjModelSource::ReleaseGeometry()
+	{
+		collection::Vector<IModelSource::Vertex>().swap(m_Vertices);
+		collection::Vector<IModelSource::Polygon>().swap(m_Polygons);
+	}
+
+	bool ObjModelSource::Load(LoggerPtr logger, const char* pData, uint64_t dataSize, const ModelSourceConfig& config, BackgroundJobHandlePtr handle)
+	{
+		size_t workerCount = ParallelTask::GetMaxConcurrency();
+
+		// ----------------------------------------------------------------------------------------------------
+		// s̓rŋ؂Ȃ悤Ƀ`Nɕ
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<ObjModelSource::Chunk> chunks;
+
+		{
+			uint64_t chunkSize = std::max(dataSize / (workerCount * ObjModelSource::CHUNKS_PER_WORKER), ObjModelSource::CHUNK_MIN_SIZE);
+
+			chunks.reserve(static_cast<size_t>(dataSize / chunkSize) + 1);
+
+			const char* pChunkBegin = pData;
+			const char* pDataEnd = pData + dataSize;
+
+			while (pChunkBegin != pDataEnd)
+			{
+				const char* pChunkEnd;
+
+				if (static_cast<uint64_t>(pDataEnd - pChunkBegin) > chunkSize)
+				{
+					pChunkEnd = ObjModelSource::SkipLine(pChunkBegin + chunkSize, pDataEnd);
+				}
+				else
+				{
+					pChunkEnd = pDataEnd;
+				}
+
+				chunks.push_back(ObjModelSource::Chunk{});
+
+				ObjModelSource::Chunk& chunk = chunks.back();
+				chunk.pBegin = pChunkBegin;
+				chunk.pEnd = pChunkEnd;
+
+				pChunkBegin = pChunkEnd;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// `Nɉ
+		// ----------------------------------------------------------------------------------------------------
+
+		handle->BeginStage(BACKGROUND_JOB_STAGE_READ_FILE, chunks.size());
+
+		{
+			std::atomic<size_t> nextChunk(0);
+
+			auto parseFunc = [&chunks, &nextChunk, &handle]()
+			{
+				size_t chunkIndex;
+
+				while ((handle->IsCancelRequested() == false) && ((chunkIndex = nextChunk.fetch_add(1)) < chunks.size()))
+				{
+					ObjModelSource::ParseChunk(chunks[chunkIndex]);
+					handle->AddProgress(1);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(chunks.size(), parseFunc);
+
+			// ĂяõXbh͂ɉ
+			parseFunc();
+
+			task.Wait();
+		}
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _̑܂Ƃ߂
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<glm::vec3> positions;
+		collection::Vector<glm::vec2> texcoords;
+		collection::Vector<glm::vec3> normals;
+
+		{
+			size_t positionCount = 0;
+			size_t texcoordCount = 0;
+			size_t normalCount = 0;
+			uint32_t lineCount = 0;
+
+			auto it_begin = chunks.begin();
+			auto it_end = chunks.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (it->result == false)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Failed to parse the OBJ file : Line[%u]", lineCount + it->errorLine);
+					return false;
+				}
+
+				it->positionBase = static_cast<int32_t>(positionCount);
+				it->texcoordBase = static_cast<int32_t>(texcoordCount);
+				it->normalBase = static_cast<int32_t>(normalCount);
+
+				positionCount += it->positions.size();
+				texcoordCount += it->texcoords.size();
+				normalCount += it->normals.size();
+				lineCount += it->lineCount;
+			}
+
+			if ((positionCount > INT32_MAX) || (texcoordCount > INT32_MAX) || (normalCount > INT32_MAX))
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Too many vertices");
+				return false;
+			}
+
+			positions.reserve(positionCount);
+			texcoords.reserve(texcoordCount);
+			normals.reserve(normalCount);
+
+			// ܂Ƃ߂`N̑͂ɉāA̎gpʂ̃s[N}
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				positions.insert(positions.end(), it->positions.begin(), it->positions.end());
+				texcoords.insert(texcoords.end(), it->texcoords.begin(), it->texcoords.end());
+				normals.insert(normals.end(), it->normals.begin(), it->normals.end());
+
+				collection::Vector<glm::vec3>().swap(it->positions);
+				collection::Vector<glm::vec2>().swap(it->texcoords);
+				collection::Vector<glm::vec3>().swap(it->normals);
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// }eACuǂݍ
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Map<StringA, int32_t> materialMap;
+
+		{
+			StringW dirPath;
+			GetDirectoryPath(m_FilePath.c_str(), dirPath);
+
+			collection::Vector<StringW> filePathes;
+
+			auto it_begin = chunks.begin();
+			auto it_end = chunks.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				auto it_record_begin = it->records.begin();
+				auto it_record_end = it->records.end();
+
+				for (auto it_record = it_record_begin; it_record != it_record_end; ++it_record)
+				{
+					if (it_record->type == ObjModelSource::RECORD_TYPE_MTLLIB)
+					{
+						ObjModelSource::AddMaterialLibraryFilePathes(dirPath.c_str(), it_record->name, filePathes);
+					}
+				}
+			}
+
+			auto it_path_begin = filePathes.begin();
+			auto it_path_end = filePathes.end();
+
+			for (auto it_path = it_path_begin; it_path != it_path_end; ++it_path)
+			{
+				if (LoadMaterialLibrary(logger, it_path->c_str(), config, materialMap) == false)
+				{
+					logger->PrintW(Logger::TYPE_WARNING, L"Failed to load the material library : %s", it_path->c_str());
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// [gm[h쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			IModelSource::Node rootNode;
+			rootNode.name = L"RootNode";
+			rootNode.parentIndex = -1;
+			rootNode.localTranslation = glm::vec3(0.0f);
+			rootNode.localRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			rootNode.localScaling = glm::vec3(1.0f);
+			rootNode.firstVertexIndex = 0;
+			rootNode.vertexCount = 0;
+			rootNode.firstPolygonIndex = 0;
+			rootNode.polygonCount = 0;
+			rootNode.hasUV = false;
+
+			if (config.flags & MODEL_SOURCE_TRANSFORM)
+			{
+				rootNode.localScaling *= config.scale;
+				rootNode.localRotation *= glm::quat(config.rotation);
+			}
+
+			m_Nodes.push_back(rootNode);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// O[v ( m[h ) ƃ}eAŃgCAO؂ăZOg쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// ÕO[v񌻂ꂽꍇ́AЂƂ̃m[hɂ܂Ƃ߂
+
+		collection::Vector<ObjModelSource::Segment> segments;
+
+		{
+			collection::Map<StringA, int32_t> nodeMap;
+
+			StringA groupName = "default";
+			int32_t materialIndex = -1;
+			int32_t defaultMaterialIndex = -1;
+
+			auto addSegment = [this, &segments, &nodeMap, &groupName, &materialIndex, &defaultMaterialIndex](uint32_t chunkIndex, uint32_t firstTriangle, uint32_t triangleEnd)
+			{
+				if (firstTriangle == triangleEnd)
+				{
+					return;
+				}
+
+				int32_t nodeIndex;
+
+				auto it_node = nodeMap.find(groupName);
+				if (it_node == nodeMap.end())
+				{
+					nodeIndex = static_cast<int32_t>(m_Nodes.size());
+					nodeMap[groupName] = nodeIndex;
+
+					IModelSource::Node node;
+					ToWideString(groupName.c_str(), node.name);
+					node.parentIndex = 0;
+					node.localTranslation = glm::vec3(0.0f);
+					node.localRotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+					node.localScaling = glm::vec3(1.0f);
+					node.firstVertexIndex = 0;
+					node.vertexCount = 0;
+					node.firstPolygonIndex = 0;
+					node.polygonCount = 0;
+					node.hasUV = false;
+
+					m_Nodes.push_back(node);
+				}
+				else
+				{
+					nodeIndex = it_node->second;
+				}
+
+				// }eA蓖ĂĂȂgCAOɂ̓ftHg̃}eA蓖Ă
+				int32_t segmentMaterialIndex = materialIndex;
+				if (segmentMaterialIndex < 0)
+				{
+					if (defaultMaterialIndex < 0)
+					{
+						defaultMaterialIndex = static_cast<int32_t>(m_Materials.size());
+						m_Materials.push_back(IModelSource::Material::Default(L"default"));
+					}
+
+					segmentMaterialIndex = defaultMaterialIndex;
+				}
+
+				IModelSource::Node& node = m_Nodes[nodeIndex];
+
+				if (std::find(node.materialIndices.begin(), node.materialIndices.end(), segmentMaterialIndex) == node.materialIndices.end())
+				{
+					node.materialIndices.push_back(segmentMaterialIndex);
+				}
+
+				node.polygonCount += triangleEnd - firstTriangle;
+
+				ObjModelSource::Segment segment{};
+				segment.chunkIndex = chunkIndex;
+				segment.firstTriangle = firstTriangle;
+				segment.triangleCount = triangleEnd - firstTriangle;
+				segment.nodeIndex = nodeIndex;
+				segment.materialIndex = segmentMaterialIndex;
+
+				segments.push_back(segment);
+			};
+
+			uint32_t chunkCount = static_cast<uint32_t>(chunks.size());
+
+			for (uint32_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+			{
+				const ObjModelSource::Chunk& chunk = chunks[chunkIndex];
+
+				uint32_t firstTriangle = 0;
+
+				auto it_record_begin = chunk.records.begin();
+				auto it_record_end = chunk.records.end();
+
+				for (auto it_record = it_record_begin; it_record != it_record_end; ++it_record)
+				{
+					if (it_record->type == ObjModelSource::RECORD_TYPE_GROUP)
+					{
+						addSegment(chunkIndex, firstTriangle, it_record->triangleIndex);
+						firstTriangle = it_record->triangleIndex;
+
+						groupName = it_record->name;
+					}
+					else if (it_record->type == ObjModelSource::RECORD_TYPE_MATERIAL)
+					{
+						addSegment(chunkIndex, firstTriangle, it_record->triangleIndex);
+						firstTriangle = it_record->triangleIndex;
+
+						auto it_material = materialMap.find(it_record->name);
+						if (it_material != materialMap.end())
+						{
+							materialIndex = it_material->second;
+						}
+						else
+						{
+							logger->PrintA(Logger::TYPE_WARNING, "The material is not defined : Material[%s]", it_record->name.c_str());
+
+							materialIndex = static_cast<int32_t>(m_Materials.size());
+							materialMap[it_record->name] = materialIndex;
+
+							StringW materialName;
+							ToWideString(it_record->name.c_str(), materialName);
+							m_Materials.push_back(IModelSource::Material::Default(materialName.c_str()));
+						}
+					}
+				}
+
+				addSegment(chunkIndex, firstTriangle, static_cast<uint32_t>(chunk.faceVertices.size() / 3));
+			}
+
+			if (segments.empty() == true)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "No polygon");
+				return false;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[hƂɃ|SA悤ɁAZOg̏ݐ߂
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			uint64_t polygonCount = 0;
+
+			auto it_node_begin = m_Nodes.begin();
+			auto it_node_end = m_Nodes.end();
+
+			for (auto it_node = it_node_begin; it_node != it_node_end; ++it_node)
+			{
+				it_node->firstPolygonIndex = static_cast<uint32_t>(polygonCount);
+				polygonCount += it_node->polygonCount;
+			}
+
+			if (polygonCount > UINT32_MAX)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Too many polygons");
+				return false;
+			}
+
+			collection::Vector<uint32_t> nodeCursors;
+			nodeCursors.reserve(m_Nodes.size());
+
+			for (auto it_node = it_node_begin; it_node != it_node_end; ++it_node)
+			{
+				nodeCursors.push_back(it_node->firstPolygonIndex);
+			}
+
+			auto it_begin = segments.begin();
+			auto it_end = segments.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				it->firstPolygon = nodeCursors[it->nodeIndex];
+				nodeCursors[it->nodeIndex] += it->triangleCount;
+			}
+
+			m_Polygons.resize(static_cast<size_t>(polygonCount));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// |SƁAZOgŋL钸_̎QƂɍ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// eZOgރ|S͈̔͂͏dȂȂ
+		// ʒuAUVA@̃CfbNXׂē_͋LA|Sɂ̓ZOg̒_̃CfbNXł
+
+		// i̓ZOgƂɐāA_̍쐬ƍ킹 2 񕪂ɂȂ
+
+		handle->BeginStage(BACKGROUND_JOB_STAGE_LOAD_SOURCE, static_cast<uint64_t>(segments.size()) * 2);
+
+		{
+			std::atomic<size_t> nextSegment(0);
+
+			auto buildFunc = [this, &segments, &nextSegment, &chunks, &positions, &texcoords, &normals, &handle]()
+			{
+				size_t segmentIndex;
+
+				collection::HashMap<ObjModelSource::VertexKey, uint32_t> vertexMap;
+
+				while ((handle->IsCancelRequested() == false) && ((segmentIndex = nextSegment.fetch_add(1)) < segments.size()))
+				{
+					ObjModelSource::Segment& segment = segments[segmentIndex];
+					const ObjModelSource::Chunk& chunk = chunks[segment.chunkIndex];
+
+					const ObjModelSource::FaceVertex* pFaceVertex = chunk.faceVertices.data() + static_cast<size_t>(segment.firstTriangle) * 3;
+
+					IModelSource::Polygon* pPolygon = m_Polygons.data() + segment.firstPolygon;
+					IModelSource::Polygon* pPolygonEnd = pPolygon + segment.triangleCount;
+
+					segment.result = true;
+
+					vertexMap.clear();
+
+					while ((pPolygon != pPolygonEnd) && (segment.result == true))
+					{
+						ObjModelSource::VertexKey keys[3];
+						bool hasNormal = true;
+
+						for (uint32_t i = 0; (i < 3) && (segment.result == true); i++)
+						{
+							ObjModelSource::VertexKey& key = keys[i];
+
+							key.position = pFaceVertex->position + ((pFaceVertex->flags & ObjModelSource::FACE_VERTEX_RELATIVE_POSITION) ? chunk.positionBase : 0);
+							if ((key.position < 0) || (static_cast<size_t>(key.position) >= positions.size()))
+							{
+								segment.result = false;
+								continue;
+							}
+
+							key.texcoord = INT32_MIN;
+							key.normal = INT32_MIN;
+
+							if (pFaceVertex->texcoord != INT32_MIN)
+							{
+								key.texcoord = pFaceVertex->texcoord + ((pFaceVertex->flags & ObjModelSource::FACE_VERTEX_RELATIVE_TEXCOORD) ? chunk.texcoordBase : 0);
+								if ((key.texcoord < 0) || (static_cast<size_t>(key.texcoord) >= texcoords.size()))
+								{
+									segment.result = false;
+									continue;
+								}
+							}
+
+							if (pFaceVertex->normal != INT32_MIN)
+							{
+								key.normal = pFaceVertex->normal + ((pFaceVertex->flags & ObjModelSource::FACE_VERTEX_RELATIVE_NORMAL) ? chunk.normalBase : 0);
+								if ((key.normal < 0) || (static_cast<size_t>(key.normal) >= normals.size()))
+								{
+									segment.result = false;
+									continue;
+								}
+							}
+							else
+							{
+								hasNormal = false;
+							}
+
+							pFaceVertex++;
+						}
+
+						if (segment.result == false)
+						{
+							continue;
+						}
+
+						for (uint32_t i = 0; i < 3; i++)
+						{
+							if (hasNormal == true)
+							{
+								auto ret = vertexMap.emplace(keys[i], static_cast<uint32_t>(segment.vertexKeys.size()));
+								if (ret.second == true)
+								{
+									segment.vertexKeys.push_back(keys[i]);
+								}
+
+								pPolygon->indices[i] = ret.first->second;
+							}
+							else
+							{
+								// @gCAO狁߂邽߁A_͋LȂ
+								keys[i].normal = INT32_MIN;
+
+								pPolygon->indices[i] = static_cast<uint32_t>(segment.vertexKeys.size());
+								segment.vertexKeys.push_back(keys[i]);
+							}
+						}
+
+						pPolygon->materialIndex = segment.materialIndex;
+
+						pPolygon++;
+					}
+
+					handle->AddProgress(1);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(segments.size(), buildFunc);
+
+			// ĂяõXbh쐬ɉ
+			buildFunc();
+
+			task.Wait();
+		}
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[hƂɒ_A悤ɁAZOg̒_̏ݐ߂
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			auto it_begin = segments.begin();
+			auto it_end = segments.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (it->result == false)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "The face refers to a vertex that does not exist");
+					return false;
+				}
+
+				m_Nodes[it->nodeIndex].vertexCount += static_cast<uint32_t>(it->vertexKeys.size());
+			}
+
+			uint64_t vertexCount = 0;
+
+			auto it_node_begin = m_Nodes.begin();
+			auto it_node_end = m_Nodes.end();
+
+			for (auto it_node = it_node_begin; it_node != it_node_end; ++it_node)
+			{
+				it_node->firstVertexIndex = static_cast<uint32_t>(vertexCount);
+				vertexCount += it_node->vertexCount;
+
+				if (vertexCount > UINT32_MAX)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Too many vertices");
+					return false;
+				}
+			}
+
+			collection::Vector<uint32_t> nodeCursors;
+			nodeCursors.reserve(m_Nodes.size());
+
+			for (auto it_node = it_node_begin; it_node != it_node_end; ++it_node)
+			{
+				nodeCursors.push_back(it_node->firstVertexIndex);
+			}
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				it->firstVertex = nodeCursors[it->nodeIndex];
+				nodeCursors[it->nodeIndex] += static_cast<uint32_t>(it->vertexKeys.size());
+			}
+
+			m_Vertices.resize(static_cast<size_t>(vertexCount));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _ɍ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// eZOgޒ_A|S͈̔͂͏dȂȂ
+
+		{
+			std::atomic<size_t> nextSegment(0);
+
+			auto buildFunc = [this, &segments, &nextSegment, &positions, &texcoords, &normals, &config, &handle]()
+			{
+				size_t segmentIndex;
+
+				while ((handle->IsCancelRequested() == false) && ((segmentIndex = nextSegment.fetch_add(1)) < segments.size()))
+				{
+					ObjModelSource::Segment& segment = segments[segmentIndex];
+
+					segment.aabbMin = glm::vec3(+VE_FLOAT_MAX);
+					segment.aabbMax = glm::vec3(-VE_FLOAT_MAX);
+					segment.hasUV = false;
+
+					/******************/
+					/* ʒuA@AUV */
+					/******************/
+
+					const ObjModelSource::VertexKey* pKeyBegin = segment.vertexKeys.data();
+					const ObjModelSource::VertexKey* pKeyEnd = pKeyBegin + segment.vertexKeys.size();
+
+					IModelSource::Vertex* pVertexBegin = m_Vertices.data() + segment.firstVertex;
+					IModelSource::Vertex* pVertex = pVertexBegin;
+
+					for (const ObjModelSource::VertexKey* pKey = pKeyBegin; pKey != pKeyEnd; ++pKey)
+					{
+						pVertex->pos = positions[pKey->position];
+						pVertex->uv = (pKey->texcoord != INT32_MIN) ? texcoords[pKey->texcoord] : glm::vec2(0.0f);
+						pVertex->tangent = glm::vec3(0.0f);
+						pVertex->binormal = glm::vec3(0.0f);
+						pVertex->normal = (pKey->normal != INT32_MIN) ? normals[pKey->normal] : glm::vec3(0.0f);
+
+						pVertex->indices[0] = 0;
+						pVertex->indices[1] = 0;
+						pVertex->indices[2] = 0;
+						pVertex->indices[3] = 0;
+						pVertex->weights[0] = 1.0f;
+						pVertex->weights[1] = 0.0f;
+						pVertex->weights[2] = 0.0f;
+						pVertex->weights[3] = 0.0f;
+
+						segment.aabbMin = glm::min(segment.aabbMin, pVertex->pos);
+						segment.aabbMax = glm::max(segment.aabbMax, pVertex->pos);
+
+						pVertex++;
+					}
+
+					IModelSource::Polygon* pPolygon = m_Polygons.data() + segment.firstPolygon;
+					IModelSource::Polygon* pPolygonEnd = pPolygon + segment.triangleCount;
+
+					while (pPolygon != pPolygonEnd)
+					{
+						const ObjModelSource::VertexKey& key0 = pKeyBegin[pPolygon->indices[0]];
+						const ObjModelSource::VertexKey& key1 = pKeyBegin[pPolygon->indices[1]];
+						const ObjModelSource::VertexKey& key2 = pKeyBegin[pPolygon->indices[2]];
+
+						pPolygon->indices[0] += segment.firstVertex;
+						pPolygon->indices[1] += segment.firstVertex;
+						pPolygon->indices[2] += segment.firstVertex;
+
+						IModelSource::Vertex& v0 = m_Vertices[pPolygon->indices[0]];
+						IModelSource::Vertex& v1 = m_Vertices[pPolygon->indices[1]];
+						IModelSource::Vertex& v2 = m_Vertices[pPolygon->indices[2]];
+
+						/********/
+						/* @ */
+						/********/
+
+						if (key0.normal == INT32_MIN)
+						{
+							// @gCAO̒_́ÃgCAOgpĂ
+							glm::vec3 ab;
+							glm::vec3 bc;
+
+							if (config.flags & MODEL_SOURCE_INVERT_NORMAL)
+							{
+								ab = v0.pos - v1.pos;
+								bc = v2.pos - v1.pos;
+							}
+							else
+							{
+								ab = v0.pos - v1.pos;
+								bc = v1.pos - v2.pos;
+							}
+
+							glm::vec3 normal = glm::normalize(glm::cross(ab, bc));
+
+							v0.normal = normal;
+							v1.normal = normal;
+							v2.normal = normal;
+						}
+
+						/************/
+						/* ڐ */
+						/************/
+
+						if ((key0.texcoord != INT32_MIN) && (key1.texcoord != INT32_MIN) && (key2.texcoord != INT32_MIN))
+						{
+							ObjModelSource::ComputeTangentSpace(m_Vertices.data(), *pPolygon);
+							segment.hasUV = true;
+						}
+
+						/************/
+						/* ʂ̔] */
+						/************/
+
+						if (config.flags & MODEL_SOURCE_FLIP_FACE)
+						{
+							uint32_t temp = pPolygon->indices[0];
+							pPolygon->indices[0] = pPolygon->indices[2];
+							pPolygon->indices[2] = temp;
+						}
+
+						pPolygon++;
+					}
+
+					/*******************************/
+					/* ڐԂ̐KAUV ̔] */
+					/*******************************/
+
+					pVertex = pVertexBegin;
+
+					for (const ObjModelSource::VertexKey* pKey = pKeyBegin; pKey != pKeyEnd; ++pKey)
+					{
+						if (pKey->texcoord != INT32_MIN)
+						{
+							ObjModelSource::NormalizeTangentSpace(*pVertex);
+						}
+
+						if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_U)
+						{
+							pVertex->uv.x = 1.0f - pVertex->uv.x;
+						}
+
+						if (config.flags & MODEL_SOURCE_INVERT_TEXCOORD_V)
+						{
+							pVertex->uv.y = 1.0f - pVertex->uv.y;
+						}
+
+						pVertex++;
+					}
+
+					// QƂ͂gpȂ
+					collection::Vector<ObjModelSource::VertexKey>().swap(segment.vertexKeys);
+
+					handle->AddProgress(1);
+				}
+			};
+
+			ParallelTask task;
+			task.Start(segments.size(), buildFunc);
+
+			// ĂяõXbh쐬ɉ
+			buildFunc();
+
+			task.Wait();
+		}
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[h̃{bNX쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			collection::Vector<glm::vec3> aabbMins;
+			collection::Vector<glm::vec3> aabbMaxs;
+
+			aabbMins.resize(m_Nodes.size(), glm::vec3(+VE_FLOAT_MAX));
+			aabbMaxs.resize(m_Nodes.size(), glm::vec3(-VE_FLOAT_MAX));
+
+			auto it_begin = segments.begin();
+			auto it_end = segments.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				IModelSource::Node& node = m_Nodes[it->nodeIndex];
+				node.hasUV |= it->hasUV;
+
+				aabbMins[it->nodeIndex] = glm::min(aabbMins[it->nodeIndex], it->aabbMin);
+				aabbMaxs[it->nodeIndex] = glm::max(aabbMaxs[it->nodeIndex], it->aabbMax);
+			}
+
+			size_t nodeCount = m_Nodes.size();
+
+			for (size_t i = 0; i < nodeCount; i++)
+			{
+				IModelSource::Node& node = m_Nodes[i];
+
+				if (node.polygonCount == 0)
+				{
+					continue;
+				}
+
+				IModelSource::Box box;
+				box.center = (aabbMins[i] + aabbMaxs[i]) * 0.5f;
+				box.axis[0] = glm::vec3(1.0f, 0.0f, 0.0f);
+				box.axis[1] = glm::vec3(0.0f, 1.0f, 0.0f);
+				box.axis[2] = glm::vec3(0.0f, 0.0f, 1.0f);
+				box.halfExtent = (aabbMaxs[i] - aabbMins[i]) * 0.5f;
+
+				node.boxes.push_back(box);
+
+				m_MeshNodeCount++;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+
+		logger->PrintA(Logger::TYPE_INFO, "Obj : Chunk[%u] Position[%u] TexCoord[%u] Normal[%u] Vertex[%u] Polygon[%u] Node[%u] Material[%u]",
+			static_cast<uint32_t>(chunks.size()),
+			static_cast<uint32_t>(positions.size()),
+			static_cast<uint32_t>(texcoords.size()),
+			static_cast<uint32_t>(normals.size()),
+			static_cast<uint32_t>(m_Vertices.size()),
+			static_cast<uint32_t>(m_Polygons.size()),
+			static_cast<uint32_t>(m_Nodes.size()),
+			static_cast<uint32_t>(m_Materials.size()));
+
+		return true;
+	}
+
+	bool ObjModelSource::LoadMaterialLibrary(LoggerPtr logger, const wchar_t* pFilePath, const ModelSourceConfig& config, collection::Map<StringA, int32_t>& materialMap)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// t@Cǂݍ
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<char> data;
+
+		{
+			HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (fileHandle == INVALID_HANDLE_VALUE)
+			{
+				return false;
+			}
+
+			LARGE_INTEGER fileSize;
+			if ((GetFileSizeEx(fileHandle, &fileSize) == FALSE) || (fileSize.QuadPart > UINT32_MAX))
+			{
+				CloseHandle(fileHandle);
+				return false;
+			}
+
+			data.resize(static_cast<size_t>(fileSize.QuadPart));
+
+			if ((data.empty() == false) && (FileRead(fileHandle, data.size(), data.data()) == false))
+			{
+				CloseHandle(fileHandle);
+				return false;
+			}
+
+			CloseHandle(fileHandle);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// }eA쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		const char* pCurrent = data.data();
+		const char* pEnd = pCurrent + data.size();
+
+		int32_t materialIndex = -1;
+
+		while (pCurrent != pEnd)
+		{
+			const char* pNextLine = ObjModelSource::SkipLine(pCurrent, pEnd);
+
+			const char* pLineEnd = pNextLine;
+			while ((pLineEnd != pCurrent) && ((pLineEnd[-1] == '\n') || (pLineEnd[-1] == '\r')))
+			{
+				pLineEnd--;
+			}
+
+			const char* pLine = ObjModelSource::SkipSpace(pCurrent, pLineEnd);
+			const char* pArgs;
+
+			if (ObjModelSource::IsKeyword(pLine, pLineEnd, "newmtl", pArgs) == true)
+			{
+				StringA name;
+				ObjModelSource::ParseName(pArgs, pLineEnd, name);
+
+				// Õ}eAɂꍇ́Aɒ`ꂽ̂D悷
+				if (materialMap.find(name) == materialMap.end())
+				{
+					StringW materialName;
+					ToWideString(name.c_str(), materialName);
+
+					materialIndex = static_cast<int32_t>(m_Materials.size());
+					materialMap[name] = materialIndex;
+
+					m_Materials.push_back(IModelSource::Material::Default(materialName.c_str()));
+				}
+				else
+				{
+					logger->PrintA(Logger::TYPE_WARNING, "The material is already defined : Material[%s]", name.c_str());
+					materialIndex = -1;
+				}
+			}
+			else if (materialIndex >= 0)
+			{
+				IModelSource::Material& material = m_Materials[materialIndex];
+
+				glm::vec3 color;
+				float value;
+
+				if (ObjModelSource::IsKeyword(pLine, pLineEnd, "Kd", pArgs) == true)
+				{
+					if (ObjModelSource::ParseColor(pArgs, pLineEnd, color) == true)
+					{
+						material.diffuseColor.r = color.r;
+						material.diffuseColor.g = color.g;
+						material.diffuseColor.b = color.b;
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "Ks", pArgs) == true)
+				{
+					if (ObjModelSource::ParseColor(pArgs, pLineEnd, color) == true)
+					{
+						material.specularColor.r = color.r;
+						material.specularColor.g = color.g;
+						material.specularColor.b = color.b;
+						material.specularFactor = 1.0f;
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "Ke", pArgs) == true)
+				{
+					if (ObjModelSource::ParseColor(pArgs, pLineEnd, color) == true)
+					{
+						material.emissiveFactor = ObjModelSource::ToLuminance(color);
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "Ns", pArgs) == true)
+				{
+					if (ObjModelSource::ParseFloat(pArgs, pLineEnd, value) == true)
+					{
+						material.shininess = value;
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "d", pArgs) == true)
+				{
+					if (ObjModelSource::ParseFloat(pArgs, pLineEnd, value) == true)
+					{
+						material.diffuseColor.a = glm::clamp(value, 0.0f, 1.0f);
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "Tr", pArgs) == true)
+				{
+					if (ObjModelSource::ParseFloat(pArgs, pLineEnd, value) == true)
+					{
+						material.diffuseColor.a = glm::clamp(1.0f - value, 0.0f, 1.0f);
+					}
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "map_Kd", pArgs) == true)
+				{
+					ObjModelSource::ParseTexture(pArgs, pLineEnd, config.pathType, material.diffuseTexture);
+				}
+				else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "map_Ks", pArgs) == true)
+				{
+					ObjModelSource::ParseTexture(pArgs, pLineEnd, config.pathType, material.specularTexture);
+				}
+				else if ((ObjModelSource::IsKeyword(pLine, pLineEnd, "map_Bump", pArgs) == true) ||
+					(ObjModelSource::IsKeyword(pLine, pLineEnd, "map_bump", pArgs) == true) ||
+					(ObjModelSource::IsKeyword(pLine, pLineEnd, "bump", pArgs) == true) ||
+					(ObjModelSource::IsKeyword(pLine, pLineEnd, "norm", pArgs) == true))
+				{
+					ObjModelSource::ParseTexture(pArgs, pLineEnd, config.pathType, material.bumpTexture);
+				}
+			}
+
+			pCurrent = pNextLine;
+		}
+
+		return true;
+	}
+
+	void ObjModelSource::AddMaterialLibraryFilePathes(const wchar_t* pDirPath, const StringA& fileNames, collection::Vector<StringW>& filePathes)
+	{
+		StringW fileNamesW;
+		ToWideString(fileNames.c_str(), fileNamesW);
+
+		collection::Vector<StringW> items;
+		ParseStringW(fileNamesW, L" \t", items);
+
+		auto it_begin = items.begin();
+		auto it_end = items.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			StringW filePath;
+
+			if (IsRelativePath(it->c_str()) == true)
+			{
+				filePath = pDirPath;
+				filePath += *it;
+			}
+			else
+			{
+				filePath = *it;
+			}
+
+			if (std::find(filePathes.begin(), filePathes.end(), filePath) == filePathes.end())
+			{
+				filePathes.push_back(filePath);
+			}
+		}
+	}
+
+	void ObjModelSource::ParseChunk(ObjModelSource::Chunk& chunk)
+	{
+		const char* pCurrent = chunk.pBegin;
+		const char* pEnd = chunk.pEnd;
+
+		chunk.lineCount = 0;
+		chunk.errorLine = 0;
+		chunk.result = true;
+
+		while (pCurrent != pEnd)
+		{
+			chunk.lineCount++;
+
+			const char* pNextLine = ObjModelSource::SkipLine(pCurrent, pEnd);
+
+			const char* pLineEnd = pNextLine;
+			while ((pLineEnd != pCurrent) && ((pLineEnd[-1] == '\n') || (pLineEnd[-1] == '\r')))
+			{
+				pLineEnd--;
+			}
+
+			const char* pLine = ObjModelSource::SkipSpace(pCurrent, pLineEnd);
+			const char* pArgs;
+
+			bool lineResult = true;
+
+			if (ObjModelSource::IsKeyword(pLine, pLineEnd, "v", pArgs) == true)
+			{
+				/********/
+				/* ʒu */
+				/********/
+
+				glm::vec3 position;
+
+				if ((ObjModelSource::ParseFloat(pArgs, pLineEnd, position.x) == true) &&
+					(ObjModelSource::ParseFloat(pArgs, pLineEnd, position.y) == true) &&
+					(ObjModelSource::ParseFloat(pArgs, pLineEnd, position.z) == true))
+				{
+					chunk.positions.push_back(position);
+				}
+				else
+				{
+					lineResult = false;
+				}
+			}
+			else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "vt", pArgs) == true)
+			{
+				/******/
+				/* UV */
+				/******/
+
+				glm::vec2 texcoord;
+
+				if (ObjModelSource::ParseFloat(pArgs, pLineEnd, texcoord.x) == true)
+				{
+					if (ObjModelSource::ParseFloat(pArgs, pLineEnd, texcoord.y) == false)
+					{
+						texcoord.y = 0.0f;
+					}
+
+					chunk.texcoords.push_back(texcoord);
+				}
+				else
+				{
+					lineResult = false;
+				}
+			}
+			else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "vn", pArgs) == true)
+			{
+				/********/
+				/* @ */
+				/********/
+
+				glm::vec3 normal;
+
+				if ((ObjModelSource::ParseFloat(pArgs, pLineEnd, normal.x) == true) &&
+					(ObjModelSource::ParseFloat(pArgs, pLineEnd, normal.y) == true) &&
+					(ObjModelSource::ParseFloat(pArgs, pLineEnd, normal.z) == true))
+				{
+					chunk.normals.push_back(normal);
+				}
+				else
+				{
+					lineResult = false;
+				}
+			}
+			else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "f", pArgs) == true)
+			{
+				/*******************************************/
+				/*  ( p`̓t@ŎOp`ɕ ) */
+				/*******************************************/
+
+				ObjModelSource::FaceVertex firstFaceVertex;
+				ObjModelSource::FaceVertex prevFaceVertex;
+				ObjModelSource::FaceVertex faceVertex;
+
+				uint32_t faceVertexCount = 0;
+
+				while ((lineResult == true) && (ObjModelSource::SkipSpace(pArgs, pLineEnd) != pLineEnd))
+				{
+					if (ObjModelSource::ParseFaceVertex(pArgs, pLineEnd, chunk, faceVertex) == true)
+					{
+						if (faceVertexCount == 0)
+						{
+							firstFaceVertex = faceVertex;
+						}
+						else if (faceVertexCount >= 2)
+						{
+							chunk.faceVertices.push_back(firstFaceVertex);
+							chunk.faceVertices.push_back(prevFaceVertex);
+							chunk.faceVertices.push_back(faceVertex);
+						}
+
+						prevFaceVertex = faceVertex;
+						faceVertexCount++;
+					}
+					else
+					{
+						lineResult = false;
+					}
+				}
+
+				if (faceVertexCount < 3)
+				{
+					lineResult = false;
+				}
+			}
+			else if ((ObjModelSource::IsKeyword(pLine, pLineEnd, "g", pArgs) == true) || (ObjModelSource::IsKeyword(pLine, pLineEnd, "o", pArgs) == true))
+			{
+				/************/
+				/* O[v */
+				/************/
+
+				ObjModelSource::Record record;
+				record.type = ObjModelSource::RECORD_TYPE_GROUP;
+				record.triangleIndex = static_cast<uint32_t>(chunk.faceVertices.size() / 3);
+				ObjModelSource::ParseName(pArgs, pLineEnd, record.name);
+
+				if (record.name.empty() == true)
+				{
+					record.name = "default";
+				}
+
+				chunk.records.push_back(record);
+			}
+			else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "usemtl", pArgs) == true)
+			{
+				/**************/
+				/* }eA */
+				/**************/
+
+				ObjModelSource::Record record;
+				record.type = ObjModelSource::RECORD_TYPE_MATERIAL;
+				record.triangleIndex = static_cast<uint32_t>(chunk.faceVertices.size() / 3);
+				ObjModelSource::ParseName(pArgs, pLineEnd, record.name);
+
+				chunk.records.push_back(record);
+			}
+			else if (ObjModelSource::IsKeyword(pLine, pLineEnd, "mtllib", pArgs) == true)
+			{
+				/************************/
+				/* }eACu */
+				/************************/
+
+				ObjModelSource::Record record;
+				record.type = ObjModelSource::RECORD_TYPE_MTLLIB;
+				record.triangleIndex = static_cast<uint32_t>(chunk.faceVertices.size() / 3);
+				ObjModelSource::ParseName(pArgs, pLineEnd, record.name);
+
+				chunk.records.push_back(record);
+			}
+
+			// RgAX[WOO[v ( s )A ( l )A_ ( p ) Ȃǂ͖
+
+			if (lineResult == false)
+			{
+				chunk.errorLine = chunk.lineCount;
+				chunk.result = false;
+				return;
+			}
+
+			pCurrent = pNextLine;
+		}
+	}
+
+	bool ObjModelSource::ParseFaceVertex(const char*& pCurrent, const char* pEnd, const ObjModelSource::Chunk& chunk, ObjModelSource::FaceVertex& faceVertex)
+	{
+		// v v/vt v//vn v/vt/vn
+
+		const char* pNext = ObjModelSource::SkipSpace(pCurrent, pEnd);
+
+		faceVertex.texcoord = INT32_MIN;
+		faceVertex.normal = INT32_MIN;
+		faceVertex.flags = 0;
+
+		if (ObjModelSource::ParseIndex(pNext, pEnd, chunk.positions.size(), ObjModelSource::FACE_VERTEX_RELATIVE_POSITION, faceVertex.position, faceVertex.flags) == false)
+		{
+			return false;
+		}
+
+		if ((pNext != pEnd) && (*pNext == '/'))
+		{
+			pNext++;
+
+			if ((pNext != pEnd) && (*pNext != '/'))
+			{
+				if (ObjModelSource::ParseIndex(pNext, pEnd, chunk.texcoords.size(), ObjModelSource::FACE_VERTEX_RELATIVE_TEXCOORD, faceVertex.texcoord, faceVertex.flags) == false)
+				{
+					return false;
+				}
+			}
+
+			if ((pNext != pEnd) && (*pNext == '/'))
+			{
+				pNext++;
+
+				if (ObjModelSource::ParseIndex(pNext, pEnd, chunk.normals.size(), ObjModelSource::FACE_VERTEX_RELATIVE_NORMAL, faceVertex.normal, faceVertex.flags) == false)
+				{
+					return false;
+				}
+			}
+		}
+
+		if ((pNext != pEnd) && (*pNext != ' ') && (*pNext != '\t'))
+		{
+			return false;
+		}
+
+		pCurrent = pNext;
+
+		return true;
+	}
+
+	bool ObjModelSource::ParseIndex(const char*& pCurrent, const char* pEnd, size_t count, uint32_t relativeFlag, int32_t& index, uint32_t& flags)
+	{
+		// ̒l 1 n܂΃CfbNXA̒l͂܂łɒ`ꂽvf̑΃CfbNX
+		// ΃CfbNX̓`N̐擪̃CfbNXɕϊAŃ`N̐擪̃CfbNX
+
+		int32_t value;
+
+		if ((ObjModelSource::ParseInt(pCurrent, pEnd, value) == false) || (value == 0))
+		{
+			return false;
+		}
+
+		if (value > 0)
+		{
+			index = value - 1;
+		}
+		else
+		{
+			index = static_cast<int32_t>(count) + value;
+			flags |= relativeFlag;
+		}
+
+		return true;
+	}
+
+	bool ObjModelSource::ParseColor(const char*& pCurrent, const char* pEnd, glm::vec3& color)
+	{
+		if (ObjModelSource::ParseFloat(pCurrent, pEnd, color.r) == false)
+		{
+			return false;
+		}
+
+		// lЂƂ̏ꍇ̓O[XP[
+		if ((ObjModelSource::ParseFloat(pCurrent, pEnd, color.g) == false) ||
+			(ObjModelSource::ParseFloat(pCurrent, pEnd, color.b) == false))
+		{
+			color.g = color.r;
+			color.b = color.r;
+		}
+
+		return true;
+	}
+
+	void ObjModelSource::ParseTexture(const char* pCurrent, const char* pEnd, MODEL_SOURCE_PATH_TYPE pathType, StringW& texture)
+	{
+		// IvV ( -bm 1.0 Ȃ ) ̓t@C̑OɎw肳邽߁AŌ̍ڂt@CƂ
+
+		while ((pEnd != pCurrent) && ((pEnd[-1] == ' ') || (pEnd[-1] == '\t')))
+		{
+			pEnd--;
+		}
+
+		const char* pName = pEnd;
+		while ((pName != pCurrent) && (pName[-1] != ' ') && (pName[-1] != '\t'))
+		{
+			pName--;
+		}
+
+		if (pName == pEnd)
+		{
+			return;
+		}
+
+		StringA name(pName, pEnd);
+		ToWideString(name.c_str(), texture);
+
+		if (pathType == MODEL_SOURCE_PATH_TYPE_STRIP)
+		{
+			texture = PathFindFileNameW(texture.c_str());
+		}
+	}
+
+	const char* ObjModelSource::SkipSpace(const char* pCurrent, const char* pEnd)
+	{
+		while ((pCurrent != pEnd) && ((*pCurrent == ' ') || (*pCurrent == '\t')))
+		{
+			pCurrent++;
+		}
+
+		return pCurrent;
+	}
+
+	const char* ObjModelSource::SkipLine(const char* pCurrent, const char* pEnd)
+	{
+		const char* pFound = static_cast<const char*>(memchr(pCurrent, '\n', static_cast<size_t>(pEnd - pCurrent)));
+
+		return (pFound != nullptr) ? (pFound + 1) : pEnd;
+	}
+
+	bool ObjModelSource::IsKeyword(const char* pCurrent, const char* pEnd, const char* pKeyword, const char*& pNext)
+	{
+		while (*pKeyword != '\0')
+		{
+			if ((pCurrent == pEnd) || (*pCurrent != *pKeyword))
+			{
+				return false;
+			}
+
+			pCurrent++;
+			pKeyword++;
+		}
+
+		// L[[ȟ͋󔒂s̏I ( v  vt Ȃǂʂ )
+		if ((pCurrent != pEnd) && (*pCurrent != ' ') && (*pCurrent != '\t'))
+		{
+			return false;
+		}
+
+		pNext = pCurrent;
+
+		return true;
+	}
+
+	bool ObjModelSource::ParseFloat(const char*& pCurrent, const char* pEnd, float& value)
+	{
+		// P[ɈˑA𐮐œǂݍł 10 ׂ̂|
+		//  19 ܂œǂݍ݁Aȍ~͎̌wɔf
+
+		static constexpr double POW10[] =
+		{
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+			1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+		};
+
+		static constexpr int32_t POW10_MAX = 22;
+		static constexpr uint32_t MANTISSA_MAX_DIGIT = 19;
+
+		const char* pNext = ObjModelSource::SkipSpace(pCurrent, pEnd);
+
+		bool negative = false;
+
+		if ((pNext != pEnd) && ((*pNext == '-') || (*pNext == '+')))
+		{
+			negative = (*pNext == '-');
+			pNext++;
+		}
+
+		uint64_t mantissa = 0;
+		uint32_t digitCount = 0;
+		int32_t exponent = 0;
+		bool hasDigit = false;
+
+		while ((pNext != pEnd) && (*pNext >= '0') && (*pNext <= '9'))
+		{
+			if (digitCount < MANTISSA_MAX_DIGIT)
+			{
+				mantissa = mantissa * 10 + static_cast<uint64_t>(*pNext - '0');
+				digitCount += (mantissa != 0) ? 1 : 0;
+			}
+			else
+			{
+				exponent++;
+			}
+
+			hasDigit = true;
+			pNext++;
+		}
+
+		if ((pNext != pEnd) && (*pNext == '.'))
+		{
+			pNext++;
+
+			while ((pNext != pEnd) && (*pNext >= '0') && (*pNext <= '9'))
+			{
+				if (digitCount < MANTISSA_MAX_DIGIT)
+				{
+					mantissa = mantissa * 10 + static_cast<uint64_t>(*pNext - '0');
+					digitCount += (mantissa != 0) ? 1 : 0;
+					exponent--;
+				}
+
+				hasDigit = true;
+				pNext++;
+			}
+		}
+
+		if (hasDigit == false)
+		{
+			return false;
+		}
+
+		if ((pNext != pEnd) && ((*pNext == 'e') || (*pNext == 'E')))
+		{
+			const char* pExponent = pNext + 1;
+			bool exponentNegative = false;
+
+			if ((pExponent != pEnd) && ((*pExponent == '-') || (*pExponent == '+')))
+			{
+				exponentNegative = (*pExponent == '-');
+				pExponent++;
+			}
+
+			int32_t exponentValue = 0;
+			bool hasExponentDigit = false;
+
+			while ((pExponent != pEnd) && (*pExponent >= '0') && (*pExponent <= '9'))
+			{
+				if (exponentValue < 10000)
+				{
+					exponentValue = exponentValue * 10 + (*pExponent - '0');
+				}
+
+				hasExponentDigit = true;
+				pExponent++;
+			}
+
+			if (hasExponentDigit == true)
+			{
+				exponent += (exponentNegative == true) ? -exponentValue : exponentValue;
+				pNext = pExponent;
+			}
+		}
+
+		if ((pNext != pEnd) && (*pNext != ' ') && (*pNext != '\t'))
+		{
+			return false;
+		}
+
+		double result = static_cast<double>(mantissa);
+
+		if (exponent < 0)
+		{
+			result = (-exponent <= POW10_MAX) ? (result / POW10[-exponent]) : (result * std::pow(10.0, exponent));
+		}
+		else if (exponent > 0)
+		{
+			result = (exponent <= POW10_MAX) ? (result * POW10[exponent]) : (result * std::pow(10.0, exponent));
+		}
+
+		value = static_cast<float>((negative == true) ? -result : result);
+		pCurrent = pNext;
+
+		return true;
+	}
+
+	bool ObjModelSource::ParseInt(const char*& pCurrent, const char* pEnd, int32_t& value)
+	{
+		const char* pNext = pCurrent;
+
+		bool negative = false;
+
+		if ((pNext != pEnd) && ((*pNext == '-') || (*pNext == '+')))
+		{
+			negative = (*pNext == '-');
+			pNext++;
+		}
+
+		int64_t result = 0;
+		bool hasDigit = false;
+
+		while ((pNext != pEnd) && (*pNext >= '0') && (*pNext <= '9'))
+		{
+			if (result <= INT32_MAX)
+			{
+				result = result * 10 + (*pNext - '0');
+			}
+
+			hasDigit = true;
+			pNext++;
+		}
+
+		if ((hasDigit == false) || (result > INT32_MAX))
+		{
+			return false;
+		}
+
+		value = (negative == true) ? -static_cast<int32_t>(result) : static_cast<int32_t>(result);
+		pCurrent = pNext;
+
+		return true;
+	}
+
+	void ObjModelSource::ParseName(const char* pCurrent, const char* pEnd, StringA& name)
+	{
+		pCurrent = ObjModelSource::SkipSpace(pCurrent, pEnd);
+
+		while ((pEnd != pCurrent) && ((pEnd[-1] == ' ') || (pEnd[-1] == '\t')))
+		{
+			pEnd--;
+		}
+
+		name.assign(pCurrent, pEnd);
+	}
+
+	void ObjModelSource::ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon)
+	{
+		const IModelSource::Vertex& v0 = pVertices[polygon.indices[0]];
+		const IModelSource::Vertex& v1 = pVertices[polygon.indices[1]];
+		const IModelSource::Vertex& v2 = pVertices[polygon.indices[2]];
+
+		glm::vec3 p0 = v0.pos;
+		glm::vec3 p1 = v1.pos;
+		glm::vec3 p2 = v2.pos;
+
+		glm::vec2 t0 = v0.uv;
+		glm::vec2 t1 = v1.uv;
+		glm::vec2 t2 = v2.uv;
+
+		glm::vec3 cp0[3] =
+		{
+			glm::vec3(p0.x, t0.x, t0.y),
+			glm::vec3(p0.y, t0.x, t0.y),
+			glm::vec3(p0.z, t0.x, t0.y),
+		};
+
+		glm::vec3 cp1[3] =
+		{
+			glm::vec3(p1.x, t1.x, t1.y),
+			glm::vec3(p1.y, t1.x, t1.y),
+			glm::vec3(p1.z, t1.x, t1.y),
+		};
+
+		glm::vec3 cp2[3] =
+		{
+			glm::vec3(p2.x, t2.x, t2.y),
+			glm::vec3(p2.y, t2.x, t2.y),
+			glm::vec3(p2.z, t2.x, t2.y),
+		};
+
+		float u[3];
+		float v[3];
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			glm::vec3 v1 = cp1[i] - cp0[i];
+			glm::vec3 v2 = cp2[i] - cp1[i];
+
+			glm::vec3 abc = glm::cross(v1, v2);
+
+			if ((-VE_FLOAT_EPSILON <= abc.x) && (VE_FLOAT_EPSILON >= abc.x))
+			{
+				//kނĂ|S
+				u[i] = 1.0f;
+				v[i] = 1.0f;
+			}
+			else
+			{
+				u[i] = (abc.y / abc.x);
+				v[i] = (abc.z / abc.x);
+			}
+		}
+
+		glm::vec3 tangent = glm::normalize(glm::vec3(u[0], u[1], u[2]));
+		glm::vec3 binormal = glm::normalize(glm::vec3(v[0], v[1], v[2]));
+
+		// _LgCAO̐ڐԂ𑫂킹ĂAŌ NormalizeTangentSpace ŐK
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			IModelSource::Vertex& vertex = pVertices[polygon.indices[i]];
+			vertex.tangent += tangent;
+			vertex.binormal += binormal;
+		}
+	}
+
+	void ObjModelSource::NormalizeTangentSpace(IModelSource::Vertex& vertex)
+	{
+		float tangentLength = glm::length(vertex.tangent);
+		float binormalLength = glm::length(vertex.binormal);
+
+		if ((tangentLength > VE_FLOAT_EPSILON) && (binormalLength > VE_FLOAT_EPSILON))
+		{
+			vertex.tangent /= tangentLength;
+			vertex.binormal /= binormalLength;
+		}
+		else
+		{
+			// 킹ڐԂłĂꍇ́A@쐬
+			glm::vec3 axis = (::fabs(vertex.normal.x) < 0.9f) ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+			vertex.tangent = glm::normalize(glm::cross(axis, vertex.normal));
+			vertex.binormal = glm::cross(vertex.normal, vertex.tangent);
+		}
+	}
+
+	float ObjModelSource::ToLuminance(const glm::vec3& color)
+	{
+		static const glm::mat3 MAT = glm::mat3(0.4124, 0.2126, 0.0193, 0.3576, 0.7152, 0.1192, 0.1805, 0.0722, 0.9505);
+
+		glm::vec3 xyz = MAT * color;
+
+		return xyz.g;
+	}
+
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "IModelSource.h"
+
+namespace ve {
+
+	class ObjModelSource final : public IModelSource
+	{
+	public:
+		static ModelSourcePtr Create();
+
+		ObjModelSource();
+		virtual ~ObjModelSource();
+
+		bool Load(LoggerPtr logger, DeviceContextPtr deviceContext, const wchar_t* pFilePath, const ModelSourceConfig& config, BackgroundJobHandlePtr handle) override;
+		void GetDependentFilePathes(const wchar_t* pFilePath, collection::Vector<StringW>& filePathes) override;
+
+		const wchar_t* GetFilePath() const override;
+		const collection::Vector<IModelSource::Material>& GetMaterials() const override;
+		const collection::Vector<IModelSource::Vertex>& GetVertices() const override;
+		const collection::Vector<IModelSource::Polygon>& GetPolygons() const override;
+		const collection::Vector<IModelSource::Node>& GetNodes() const override;
+		size_t GetEmptyNodeCount() const override;
+		size_t GetMeshNodeCount() const override;
+		void ReleaseGeometry() override;
+
+		VE_DECLARE_ALLOCATOR
+
+	private:
+		// `N̍ŏTCY
+		static constexpr uint64_t CHUNK_MIN_SIZE = 4 * 1024 * 1024;
+		// [J[Xbh̃`N̐ ( s̒̕΂ς߁A[J[Xbh̐葽 )
+		static constexpr uint32_t CHUNKS_PER_WORKER = 4;
+
+		enum RECORD_TYPE
+		{
+			RECORD_TYPE_MTLLIB = 0,
+			RECORD_TYPE_GROUP = 1, // g or o
+			RECORD_TYPE_MATERIAL = 2, // usemtl
+		};
+
+		// `ÑCfbNX͕̒l ( ΎQ ) ̏ꍇA`N̐擪̃CfbNXɂȂAtO
+		enum FACE_VERTEX_FLAG : uint32_t
+		{
+			FACE_VERTEX_RELATIVE_POSITION = 0x00000001,
+			FACE_VERTEX_RELATIVE_TEXCOORD = 0x00000002,
+			FACE_VERTEX_RELATIVE_NORMAL = 0x00000004,
+		};
+
+		struct FaceVertex
+		{
+			int32_t position;
+			int32_t texcoord; // ꍇ INT32_MIN
+			int32_t normal; // ꍇ INT32_MIN
+			uint32_t flags;
+		};
+
+		// t@CŜł̃CfbNX ( ꍇ INT32_MIN )
+		struct VertexKey
+		{
+			int32_t position;
+			int32_t texcoord;
+			int32_t normal;
+
+			bool operator == (const ObjModelSource::VertexKey& rhs) const
+			{
+				return (position == rhs.position) && (texcoord == rhs.texcoord) && (normal == rhs.normal);
+			}
+
+			size_t operator()(const ObjModelSource::VertexKey& key) const
+			{
+				size_t hash = static_cast<size_t>(static_cast<uint32_t>(key.position));
+				hash = hash * 31 + static_cast<size_t>(static_cast<uint32_t>(key.texcoord));
+				hash = hash * 31 + static_cast<size_t>(static_cast<uint32_t>(key.normal));
+				return hash;
+			}
+		};
+
+		struct Record
+		{
+			ObjModelSource::RECORD_TYPE type;
+			uint32_t triangleIndex; // ̃R[hȍ~̃gCAOɓKp
+			StringA name;
+		};
+
+		struct Chunk
+		{
+			const char* pBegin;
+			const char* pEnd;
+
+			collection::Vector<glm::vec3> positions;
+			collection::Vector<glm::vec2> texcoords;
+			collection::Vector<glm::vec3> normals;
+			collection::Vector<ObjModelSource::FaceVertex> faceVertices; // gCAOƂ 3 
+			collection::Vector<ObjModelSource::Record> records;
+
+			// `N̐擪̗vf́At@CŜł̃CfbNX
+			int32_t positionBase;
+			int32_t texcoordBase;
+			int32_t normalBase;
+
+			uint32_t lineCount;
+			uint32_t errorLine; // `N̍sԍ ( 1  )
+			bool result;
+		};
+
+		// m[hA}eAgCAO͈̔
+		struct Segment
+		{
+			uint32_t chunkIndex;
+			uint32_t firstTriangle;
+			uint32_t triangleCount;
+			int32_t nodeIndex;
+			int32_t materialIndex;
+			uint32_t firstVertex;
+			uint32_t firstPolygon;
+			collection::Vector<ObjModelSource::VertexKey> vertexKeys; // ZOg̒_ ( _쐬܂ŕێ )
+			glm::vec3 aabbMin;
+			glm::vec3 aabbMax;
+			bool hasUV;
+			bool result;
+		};
+
+		StringW m_FilePath;
+		collection::Vector<IModelSource::Material> m_Materials;
+		collection::Vector<IModelSource::Vertex> m_Vertices;
+		collection::Vector<IModelSource::Polygon> m_Polygons;
+		collection::Vector<IModelSource::Node> m_Nodes;
+		size_t m_MeshNodeCount;
+
+		bool Load(LoggerPtr logger, const char* pData, uint64_t dataSize, const ModelSourceConfig& config, BackgroundJobHandlePtr handle);
+		bool LoadMaterialLibrary(LoggerPtr logger, const wchar_t* pFilePath, const ModelSourceConfig& config, collection::Map<StringA, int32_t>& materialMap);
+
+		// mtllib ̈̃t@CpXɂāA܂܂܂ĂȂ filePathes ɒǉ
+		static void AddMaterialLibraryFilePathes(const wchar_t* pDirPath, const StringA& fileNames, collection::Vector<StringW>& filePathes);
+
+		static void ParseChunk(ObjModelSource::Chunk& chunk);
+		static bool ParseFaceVertex(const char*& pCurrent, const char* pEnd, const ObjModelSource::Chunk& chunk, ObjModelSource::FaceVertex& faceVertex);
+		static bool ParseIndex(const char*& pCurrent, const char* pEnd, size_t count, uint32_t relativeFlag, int32_t& index, uint32_t& flags);
+		static bool ParseColor(const char*& pCurrent, const char* pEnd, glm::vec3& color);
+		static void ParseTexture(const char* pCurrent, const char* pEnd, MODEL_SOURCE_PATH_TYPE pathType, StringW& texture);
+
+		static const char* SkipSpace(const char* pCurrent, const char* pEnd);
+		static const char* SkipLine(const char* pCurrent, const char* pEnd);
+		static bool IsKeyword(const char* pCurrent, const char* pEnd, const char* pKeyword, const char*& pNext);
+		static bool ParseFloat(const char*& pCurrent, const char* pEnd, float& value);
+		static bool ParseInt(const char*& pCurrent, const char* pEnd, int32_t& value);
+		static void ParseName(const char* pCurrent, const char* pEnd, StringA& name);
+
+		static void ComputeTangentSpace(IModelSource::Vertex* pVertices, const IModelSource::Polygon& polygon);
+		static void NormalizeTangentSpace(IModelSource::Vertex& vertex);
+		static float ToLuminance(const glm::vec3& color);
+	};
+
+}
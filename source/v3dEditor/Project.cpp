@@ -21,6 +21,11 @@ namespace ve {
 
 	Project::~Project()
 	{
+		// ǂݍݒ̃WúAJnĂȂΎsꂸɏI
+		if (m_LoadingHandle != nullptr)
+		{
+			m_LoadingHandle->Cancel();
+		}
 	}
 
 	void Project::New(const wchar_t* pFilePath)
@@ -29,8 +34,10 @@ namespace ve {
 		RemoveFileSpecW(pFilePath, m_DirPath);
 	}
 
-	bool Project::Open(LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, const wchar_t* pFilePath)
+	bool Project::Open(LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, BackgroundQueuePtr backgroundQueue, const wchar_t* pFilePath)
 	{
+		VE_ASSERT(m_LoadingHandle == nullptr);
+
 		RemoveFileExtensionW(pFilePath, m_FilePath);
 		RemoveFileSpecW(pFilePath, m_DirPath);
 
@@ -55,6 +62,8 @@ namespace ve {
 
 		if (LoadRoot(pRoot, logger, deviceContext, scene) == false)
 		{
+			m_LoadingModels.clear();
+			m_LoadingAssets.clear();
 			pDocument->Destroy();
 			return false;
 		}
@@ -63,6 +72,59 @@ namespace ve {
 
 		scene->GetRootNode()->Update();
 
+		// ----------------------------------------------------------------------------------------------------
+		// f̓ǂݍ݂Jn
+		// ----------------------------------------------------------------------------------------------------
+
+		if (m_LoadingAssets.empty() == false)
+		{
+			BackgroundJobHandlePtr handle = std::make_shared<BackgroundJobHandle>();
+			handle->BeginStage(BACKGROUND_JOB_STAGE_LOAD_MODEL, m_LoadingAssets.size());
+
+			// AZbg݂͌ɈˑȂ߁Aׂč쐬Ă܂Ƃ߂Ēǉ
+			collection::Vector<BackgroundQueue::JobPtr> jobs;
+			jobs.reserve(m_LoadingAssets.size());
+
+			auto it_begin = m_LoadingAssets.begin();
+			auto it_end = m_LoadingAssets.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				std::shared_ptr<Project::LoadingAsset> asset = it->second;
+
+				jobs.push_back(backgroundQueue->CreateJob(handle, BACKGROUND_JOB_PRIORITY_NORMAL, [logger, handle, asset]()
+				{
+					BACKGROUND_JOB_STATE state;
+
+					if (asset->model->Load(logger, asset->filePath.c_str()) == true)
+					{
+						SkeletalModel::Finish(logger, asset->model);
+						state = BACKGROUND_JOB_COMPLETED;
+					}
+					else
+					{
+						logger->PrintW(Logger::TYPE_ERROR, L"Failed to load the model : %s", asset->filePath.c_str());
+						state = BACKGROUND_JOB_ERROR;
+					}
+
+					asset->state = state;
+					handle->AddProgress(1);
+
+					return state;
+				}));
+			}
+
+			auto it_job_begin = jobs.begin();
+			auto it_job_end = jobs.end();
+
+			for (auto it_job = it_job_begin; it_job != it_job_end; ++it_job)
+			{
+				backgroundQueue->Submit(*it_job);
+			}
+
+			m_LoadingHandle = handle;
+		}
+
 		return true;
 	}
 
@@ -92,6 +154,112 @@ namespace ve {
 		return true;
 	}
 
+	void Project::Update(LoggerPtr logger, ScenePtr scene)
+	{
+		if (m_LoadingHandle == nullptr)
+		{
+			return;
+		}
+
+		// nhׂ͂ẴWuIĂI邽߁A̎_őҋ@̃AZbg̓WusꂸɃLZĂ
+		// Wu̓nhIOɃAZbg̏Ԃł
+		if (m_LoadingHandle->IsFinished() == true)
+		{
+			auto it_begin = m_LoadingAssets.begin();
+			auto it_end = m_LoadingAssets.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				BACKGROUND_JOB_STATE pendingState = BACKGROUND_JOB_PENDING;
+				it->second->state.compare_exchange_strong(pendingState, BACKGROUND_JOB_CANCELED);
+			}
+		}
+
+		auto it = m_LoadingModels.begin();
+
+		while (it != m_LoadingModels.end())
+		{
+			Project::LoadingModel& loadingModel = (*it);
+			Project::LoadingAsset* pAsset = loadingModel.asset.get();
+			BACKGROUND_JOB_STATE state = pAsset->state;
+
+			if (state == BACKGROUND_JOB_COMPLETED)
+			{
+				// ŏ̃m[hɂ͓ǂݍ񂾃f̂܂ܔzuAȍ~̃m[hɂ̓WIgƃ}eALCX^Xzu
+				// CX^X̓}eAɐڑ邽߁A`ƋȂCXbhō쐬
+				SkeletalModelPtr model;
+
+				if (pAsset->placed == false)
+				{
+					model = pAsset->model;
+					pAsset->placed = true;
+				}
+				else
+				{
+					model = SkeletalModel::CreateInstance(logger, pAsset->model);
+					if (model == nullptr)
+					{
+						logger->PrintW(Logger::TYPE_ERROR, L"Failed to create the model instance : %s", pAsset->filePath.c_str());
+					}
+				}
+
+				if (model != nullptr)
+				{
+					scene->SetNodeModel(loadingModel.node, model);
+					loadingModel.node->Update();
+				}
+				else
+				{
+					Node::Remove(loadingModel.node);
+				}
+
+				it = m_LoadingModels.erase(it);
+			}
+			else if (state != BACKGROUND_JOB_PENDING)
+			{
+				// sA܂̓LZꂽf̃m[h́AȂ܂܎cȂ悤Ɏ菜
+				Node::Remove(loadingModel.node);
+
+				it = m_LoadingModels.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		// ׂẴAZbg̏Ԃm肵I
+		// ҋ@̃AZbg̃m[h́Aق̃AZbgsĂĂǂݍ݂҂
+		if (m_LoadingModels.empty() == false)
+		{
+			return;
+		}
+
+		auto it_asset_begin = m_LoadingAssets.begin();
+		auto it_asset_end = m_LoadingAssets.end();
+
+		for (auto it_asset = it_asset_begin; it_asset != it_asset_end; ++it_asset)
+		{
+			if (it_asset->second->state == BACKGROUND_JOB_PENDING)
+			{
+				return;
+			}
+		}
+
+		m_LoadingAssets.clear();
+		m_LoadingHandle = nullptr;
+	}
+
+	bool Project::IsLoading() const
+	{
+		return (m_LoadingHandle != nullptr);
+	}
+
+	BackgroundJobHandlePtr Project::GetLoadingHandle()
+	{
+		return m_LoadingHandle;
+	}
+
 	const wchar_t* Project::GetFilePathWithoutExtension() const
 	{
 		return m_FilePath.c_str();
@@ -525,6 +693,56 @@ namespace ve {
 		return true;
 	}
 
+	bool Project::GetCanonicalFilePath(const wchar_t* pFilePath, StringW& canonicalFilePath)
+	{
+		wchar_t temp[1024];
+		DWORD tempLength = 0;
+
+		// V{bNNAWNVAZt@C ( 8.3 ` ) Ȃǂۂ̃pX擾
+		HANDLE fileHandle = CreateFileW(pFilePath, 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+		if (fileHandle != INVALID_HANDLE_VALUE)
+		{
+			tempLength = GetFinalPathNameByHandleW(fileHandle, temp, _countof(temp), FILE_NAME_NORMALIZED | VOLUME_NAME_DOS);
+			if (tempLength >= _countof(temp))
+			{
+				tempLength = 0;
+			}
+
+			CloseHandle(fileHandle);
+		}
+
+		const wchar_t* pPath = temp;
+
+		if (tempLength > 0)
+		{
+			// 擪 "\\?\" 菜 ( lbg[ÑpX "\\?\UNC\server\share"  "\\server\share" ɂ )
+			if (wcsncmp(temp, L"\\\\?\\UNC\\", 8) == 0)
+			{
+				temp[6] = L'\\';
+				pPath = temp + 6;
+			}
+			else if (wcsncmp(temp, L"\\\\?\\", 4) == 0)
+			{
+				pPath = temp + 4;
+			}
+		}
+		else
+		{
+			// JȂt@C͕\L𐳋K
+			tempLength = GetFullPathNameW(pFilePath, _countof(temp), temp, nullptr);
+			if ((tempLength == 0) || (tempLength >= _countof(temp)))
+			{
+				return false;
+			}
+		}
+
+		CharLowerBuffW(temp, tempLength);
+
+		canonicalFilePath = pPath;
+
+		return true;
+	}
+
 	bool Project::LoadNode(xml::Element* pElement, LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, NodePtr node)
 	{
 		const xml::Attribute* pNameAttribute = xml::FindAttribute(pElement, L"name");
@@ -564,7 +782,7 @@ namespace ve {
 		}
 		else if (pAttribute->value == L"model")
 		{
-			newNode = LoadModel(pElement, logger, deviceContext, scene, node);
+			newNode = LoadModel(pElement, deviceContext, scene, node);
 		}
 		else
 		{
@@ -752,7 +970,7 @@ namespace ve {
 		return node;
 	}
 
-	NodePtr Project::LoadModel(xml::Element* pElement, LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, NodePtr parent)
+	NodePtr Project::LoadModel(xml::Element* pElement, DeviceContextPtr deviceContext, ScenePtr scene, NodePtr parent)
 	{
 		const xml::Attribute* pNameAttribute = xml::FindAttribute(pElement, L"name");
 		if (pNameAttribute == nullptr)
@@ -772,15 +990,43 @@ namespace ve {
 			return false;
 		}
 
-		SkeletalModelPtr model = SkeletalModel::Create(deviceContext);
-		if (model->Load(logger, filePath) == false)
+		// t@CQƂ郂f́A\L̈Ⴂ ( ΃pXA啶AN ) zpXłЂƂ̃AZbgɂ܂Ƃ߂
+		StringW canonicalFilePath;
+		if (Project::GetCanonicalFilePath(filePath, canonicalFilePath) == false)
 		{
 			return false;
 		}
 
-		SkeletalModel::Finish(logger, model);
+		std::shared_ptr<Project::LoadingAsset> asset;
+
+		auto it_asset = m_LoadingAssets.find(canonicalFilePath);
+		if (it_asset != m_LoadingAssets.end())
+		{
+			asset = it_asset->second;
+		}
+		else
+		{
+			asset = std::make_shared<Project::LoadingAsset>();
+			asset->model = SkeletalModel::Create(deviceContext);
+			asset->filePath = filePath;
+			asset->state = BACKGROUND_JOB_PENDING;
+			asset->placed = false;
+
+			m_LoadingAssets[canonicalFilePath] = asset;
+		}
+
+		// m[hɍ쐬āAgXtH[qݒł悤ɂĂ ( f Open œǂݍ݂Jn )
+		NodePtr node = Node::AddChild(parent);
+		node->SetName(pNameAttribute->value.c_str());
+		node->SetGroupFlags(Project::SceneModelGroup);
 
-		return scene->AddNode(parent, pNameAttribute->value.c_str(), Project::SceneModelGroup, model);
+		Project::LoadingModel loadingModel;
+		loadingModel.node = node;
+		loadingModel.asset = asset;
+
+		m_LoadingModels.push_back(loadingModel);
+
+		return node;
 	}
 
 	bool Project::SaveRoot(xml::Element* pDocument, LoggerPtr logger, ScenePtr scene)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "IModelSource.h"
+#include "BackgroundQueue.h"
 #include "Scene.h"
 #include "NodeAttribute.h"
 #include "XmlUtility.h"
@@ -19,9 +20,15 @@ namespace ve {
 		~Project();
 
 		void New(const wchar_t* pFilePath);
-		bool Open(LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, const wchar_t* pFilePath);
+		// f̓obNOEh̃WuƂĕɓǂݍ݁Â Update ŃV[ɒǉ
+		bool Open(LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, BackgroundQueuePtr backgroundQueue, const wchar_t* pFilePath);
 		bool Save(LoggerPtr logger, ScenePtr scene);
 
+		// ǂݍ݂fV[ɒǉ ( CXbh疈t[Ăяo )
+		void Update(LoggerPtr logger, ScenePtr scene);
+		bool IsLoading() const;
+		BackgroundJobHandlePtr GetLoadingHandle();
+
 		const wchar_t* GetFilePathWithoutExtension() const;
 
 		VE_DECLARE_ALLOCATOR
@@ -61,9 +68,29 @@ namespace ve {
 			const wchar_t* pValue;
 		};
 
+		// ǂݍݒ̃AZbg ( t@CQƂ郂f́AЂƂ̃AZbgL )
+		struct LoadingAsset
+		{
+			SkeletalModelPtr model;
+			StringW filePath;
+			std::atomic<BACKGROUND_JOB_STATE> state;
+			bool placed; // ǂݍ񂾃fꂩ̃m[hɔzuǂ ( ȍ~̓CX^X쐬 )
+		};
+
+		// ǂݍݒ̃f ( m[h͓ǂݍ݂܂őȂ )
+		struct LoadingModel
+		{
+			NodePtr node;
+			std::shared_ptr<Project::LoadingAsset> asset;
+		};
+
 		StringW m_FilePath;
 		StringW m_DirPath;
 
+		collection::Map<StringW, std::shared_ptr<Project::LoadingAsset>> m_LoadingAssets; // L[͐Kt@CpX
+		collection::Vector<Project::LoadingModel> m_LoadingModels;
+		BackgroundJobHandlePtr m_LoadingHandle;
+
 		bool LoadRoot(xml::Element* pElement, LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene);
 		bool LoadScene(xml::Element* pElement, LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene);
 		bool LoadGrid(xml::Element* pElement, ScenePtr scene);
@@ -76,7 +103,7 @@ namespace ve {
 		NodePtr LoadAttribute(xml::Element* pElemen, ScenePtr scene, NodePtr parent);
 		NodePtr LoadCamera(xml::Element* pElemen, ScenePtr scene);
 		NodePtr LoadLight(xml::Element* pElemen, ScenePtr scene);
-		NodePtr LoadModel(xml::Element* pElemen, LoggerPtr logger, DeviceContextPtr deviceContext, ScenePtr scene, NodePtr parent);
+		NodePtr LoadModel(xml::Element* pElemen, DeviceContextPtr deviceContext, ScenePtr scene, NodePtr parent);
 
 		bool SaveRoot(xml::Element* pDocument, LoggerPtr logger, ScenePtr scene);
 		bool SaveScene(xml::Element* pParent, LoggerPtr logger, ScenePtr scene);
@@ -93,6 +120,8 @@ namespace ve {
 		bool SaveModel(xml::Element* pElement, LoggerPtr logger, ModelPtr model);
 
 		static bool ParseColor(const StringW& value, glm::vec4& color);
+		// t@CłΓɂȂpX擾 ( ɂ΃pXAJt@C̓NȂǂ )
+		static bool GetCanonicalFilePath(const wchar_t* pFilePath, StringW& canonicalFilePath);
 	};
 
 }
\ No newline at end of file
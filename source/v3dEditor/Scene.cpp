@@ -14,6 +14,7 @@
 #include "IModel.h"
 #include "NodeSelector.h"
 #include "DebugRenderer.h"
+#include "AabbTree.h"
 
 // ----------------------------------------------------------------------------------------------------
 // NX
@@ -65,6 +66,7 @@ namespace ve {
 		m_ShadowDrawSets(Scene::ShadowDrawSet_DefaultCount, Scene::ShadowDrawSet_ResizeStep),
 		m_pNodeSelector(nullptr),
 		m_SelectBuffer({}),
+		m_pAabbTree(nullptr),
 		m_pDebugRenderer(nullptr)
 	{
 		m_Grid.enable = true;
@@ -292,17 +294,36 @@ namespace ve {
 
 		node->SetName(pName);
 		node->SetGroupFlags(groupFlags);
-		Node::SetAttribute(node, model);
 
-		m_pNodeSelector->Add(model->GetRootNode());
+		SetNodeModel(node, model);
 
 		return node;
 	}
 
+	void Scene::SetNodeModel(NodePtr node, ModelPtr model)
+	{
+		// u郂f̃bV͕`悵Ȃ悤ɁAAABB c[菜
+		NodeAttributePtr oldAttribute = node->GetAttribute();
+		if (oldAttribute->GetType() == NodeAttribute::TYPE_MODEL)
+		{
+			Scene::SetAabbTree(std::static_pointer_cast<IModel>(oldAttribute)->GetRootNode(), nullptr);
+		}
+
+		Node::SetAttribute(node, model);
+
+		m_pNodeSelector->Add(model->GetRootNode());
+		Scene::SetAabbTree(model->GetRootNode(), m_pAabbTree);
+	}
+
 	void Scene::RemoveNodeByGroup(NodePtr parent, uint32_t groupFlags)
 	{
+		// 菜m[h͂킩Ȃ߁AׂĂ̓o^ĂAcm[ho^Ȃ
+		Scene::SetAabbTree(m_RootNode, nullptr);
+
 		Node::RemoveByGroup(m_RootNode, groupFlags);
 
+		Scene::SetAabbTree(m_RootNode, m_pAabbTree);
+
 		m_pNodeSelector->Clear();
 
 		InternalClear();
@@ -328,7 +349,8 @@ namespace ve {
 		// tX^XV
 		// ----------------------------------------------------------------------------------------------------
 
-		m_Frustum.Update(m_Camera->GetViewProjectionMatrix());
+		float pixelScale = static_cast<float>(m_DefaultViewport.rect.height) / (2.0f * tanf(m_Camera->GetFovY() * 0.5f));
+		m_Frustum.Update(m_Camera->GetViewProjectionMatrix(), eyePos, pixelScale);
 
 		// ----------------------------------------------------------------------------------------------------
 		// VhE̋Ep̃XtBAXV
@@ -344,11 +366,39 @@ namespace ve {
 		m_OpacityDrawSets.Clear();
 		m_TransparencyDrawSets.Clear();
 
-		m_RootNode->Draw(m_Frustum, frameIndex, m_OpacityDrawSets, m_TransparencyDrawSets, m_DebugDrawFlags, m_pDebugRenderer);
+		// AABB c[ŃtX^ƌ郁bVT
+		m_CullingResults.clear();
+		m_pAabbTree->Query(m_Frustum, m_CullingResults);
+
+		if (m_CullingResults.empty() == false)
+		{
+			auto it_begin = m_CullingResults.begin();
+			auto it_end = m_CullingResults.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				NodeAttribute* pAttribute = static_cast<NodeAttribute*>(*it);
+
+				if ((pAttribute->Draw(m_Frustum, frameIndex, m_OpacityDrawSets, m_TransparencyDrawSets) == true) && (m_DebugDrawFlags != 0))
+				{
+					pAttribute->DebugDraw(m_DebugDrawFlags, m_pDebugRenderer);
+				}
+			}
+		}
+
+		// Cg AABB c[ɓo^ĂȂ߁AfobO`悾s
+		if (m_DebugDrawFlags != 0)
+		{
+			NodeAttribute* pLightAttribute = m_Light.get();
+			pLightAttribute->DebugDraw(m_DebugDrawFlags, m_pDebugRenderer);
+		}
 
 		if (m_OpacityDrawSets.GetCount() > 0)
 		{
 			Scene::SortOpacityDrawSet(m_OpacityDrawSets.GetData(), 0, static_cast<int64_t>(m_OpacityDrawSets.GetCount()) - 1);
+
+			// \[gŗׂ荇bVA}eA̕`ZbgCX^VOł܂Ƃ߂
+			BatchOpacityDrawSets();
 		}
 
 		if (m_TransparencyDrawSets.GetCount() > 0)
@@ -376,7 +426,21 @@ namespace ve {
 		{
 			AABB aabb;
 
-			m_RootNode->DrawShadow(m_ShadowBounds, frameIndex, m_ShadowDrawSets, aabb);
+			// AABB c[ŋẼXtBAƌ郁bVT
+			m_CullingResults.clear();
+			m_pAabbTree->Query(m_ShadowBounds, m_CullingResults);
+
+			if (m_CullingResults.empty() == false)
+			{
+				auto it_begin = m_CullingResults.begin();
+				auto it_end = m_CullingResults.end();
+
+				for (auto it = it_begin; it != it_end; ++it)
+				{
+					static_cast<NodeAttribute*>(*it)->DrawShadow(m_ShadowBounds, frameIndex, m_ShadowDrawSets, aabb);
+				}
+			}
+
 			/****************************/
 			/* Cgr[s߂ */
 			/****************************/
@@ -555,6 +619,18 @@ namespace ve {
 			m_pNodeSelector = nullptr;
 		}
 
+		if (m_pAabbTree != nullptr)
+		{
+			// V[蒷c郁bVAjc[QƂȂ悤ɂ
+			if (m_RootNode != nullptr)
+			{
+				Scene::SetAabbTree(m_RootNode, nullptr);
+			}
+
+			m_pAabbTree->Destroy();
+			m_pAabbTree = nullptr;
+		}
+
 		// Obh
 		if (m_GeometoryStage.grid.pVertexBuffer != nullptr)
 		{
@@ -562,6 +638,15 @@ namespace ve {
 			m_GeometoryStage.grid.pVertexBuffer = nullptr;
 		}
 
+		// CX^VO
+		DeleteDeviceChild(m_pDeletingQueue, &m_GeometoryStage.instancing.pDescriptorSet);
+
+		if (m_GeometoryStage.instancing.pUniformBuffer != nullptr)
+		{
+			m_GeometoryStage.instancing.pUniformBuffer->Destroy();
+			m_GeometoryStage.instancing.pUniformBuffer = nullptr;
+		}
+
 		// Vvo[ebNX
 		DeleteResource(m_pDeletingQueue, &m_SimpleVertexBuffer.pResource, &m_SimpleVertexBuffer.resourceAllocation);
 	}
@@ -683,6 +768,38 @@ namespace ve {
 			return false;
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// WIg : CX^VO
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			Scene::GeometryStage::Instancing& instancing = m_GeometoryStage.instancing;
+
+			// Ō̂܂Ƃ܂̐擪VF[_[̔z̗vfԂQƂł悤ɁA]ɊmۂĂ
+			uint64_t bufferSize = sizeof(MeshInstanceUniform) * (Scene::InstanceMaxCount + GraphicsFactory::INSTANCE_BATCH_MAX_COUNT);
+
+			instancing.pUniformBuffer = DynamicBuffer::Create(m_DeviceContext, V3D_BUFFER_USAGE_UNIFORM, bufferSize, V3D_PIPELINE_STAGE_VERTEX_SHADER, V3D_ACCESS_UNIFORM_READ, L"VE_Scene_Instancing");
+			if (instancing.pUniformBuffer == nullptr)
+			{
+				return false;
+			}
+
+			instancing.pDescriptorSet = m_DeviceContext->GetGraphicsFactoryPtr()->CreateNativeDescriptorSet(GraphicsFactory::DST_MESH_INSTANCE);
+			if (instancing.pDescriptorSet == nullptr)
+			{
+				return false;
+			}
+
+			if (instancing.pDescriptorSet->SetBuffer(0, instancing.pUniformBuffer->GetNativeBufferPtr(), 0, sizeof(MeshInstanceUniform) * GraphicsFactory::INSTANCE_BATCH_MAX_COUNT) != V3D_OK)
+			{
+				return false;
+			}
+
+			instancing.pDescriptorSet->Update();
+
+			instancing.alignment = static_cast<uint32_t>(pNativeDevice->GetCaps().minUniformBufferOffsetAlignment);
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// [gm[h
 		// ----------------------------------------------------------------------------------------------------
@@ -727,6 +844,16 @@ namespace ve {
 			return false;
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// AABB c[
+		// ----------------------------------------------------------------------------------------------------
+
+		m_pAabbTree = AabbTree::Create();
+		if (m_pAabbTree == nullptr)
+		{
+			return false;
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// fobO_[
 		// ----------------------------------------------------------------------------------------------------
@@ -1422,6 +1549,80 @@ namespace ve {
 		}
 	}
 
+	void Scene::BatchOpacityDrawSets()
+	{
+		Scene::GeometryStage::Instancing& instancing = m_GeometoryStage.instancing;
+
+		OpacityDrawSet** ppDrawSet = m_OpacityDrawSets.GetData();
+		OpacityDrawSet** ppDrawSetEnd = ppDrawSet + m_OpacityDrawSets.GetCount();
+
+		uint8_t* pMemory = nullptr;
+		uint32_t memoryOffset = 0;
+		uint32_t memoryCapacity = sizeof(MeshInstanceUniform) * Scene::InstanceMaxCount;
+
+		while (ppDrawSet != ppDrawSetEnd)
+		{
+			OpacityDrawSet* pFirstDrawSet = *ppDrawSet;
+
+			// ----------------------------------------------------------------------------------------------------
+			// ܂Ƃ߂`Zbg͈̔͂߂
+			// ----------------------------------------------------------------------------------------------------
+
+			OpacityDrawSet** ppBatchEnd = ppDrawSet + 1;
+			uint32_t instanceCount = 1;
+
+			if (pFirstDrawSet->pInstancingPipeline != nullptr)
+			{
+				while ((ppBatchEnd != ppDrawSetEnd) && (instanceCount < GraphicsFactory::INSTANCE_BATCH_MAX_COUNT) && (Scene::CanBatchOpacityDrawSet(pFirstDrawSet, *ppBatchEnd) == true))
+				{
+					ppBatchEnd++;
+					instanceCount++;
+				}
+			}
+
+			// ----------------------------------------------------------------------------------------------------
+			// CX^X ( ߂Ȃꍇ͕`ZbgƂɕ`悷 )
+			// ----------------------------------------------------------------------------------------------------
+
+			uint32_t instanceOffset = (memoryOffset + instancing.alignment - 1) / instancing.alignment * instancing.alignment;
+			uint32_t instanceSize = sizeof(MeshInstanceUniform) * instanceCount;
+
+			if ((instanceCount > 1) && ((instanceOffset + instanceSize) <= memoryCapacity))
+			{
+				if (pMemory == nullptr)
+				{
+					pMemory = static_cast<uint8_t*>(instancing.pUniformBuffer->Map());
+					VE_ASSERT(pMemory != nullptr);
+				}
+
+				MeshInstanceUniform* pInstance = reinterpret_cast<MeshInstanceUniform*>(pMemory + instanceOffset);
+
+				for (OpacityDrawSet** ppInstanceDrawSet = ppDrawSet; ppInstanceDrawSet != ppBatchEnd; ++ppInstanceDrawSet)
+				{
+					OpacityDrawSet* pInstanceDrawSet = *ppInstanceDrawSet;
+
+					pInstance->worldMat = *pInstanceDrawSet->pWorldMatrix;
+					pInstance->key = pInstanceDrawSet->key;
+					pInstance++;
+
+					pInstanceDrawSet->instanceCount = 0;
+				}
+
+				pFirstDrawSet->instanceCount = instanceCount;
+				pFirstDrawSet->instanceOffset = instanceOffset;
+
+				memoryOffset = instanceOffset + instanceSize;
+			}
+
+			ppDrawSet = ppBatchEnd;
+		}
+
+		if (pMemory != nullptr)
+		{
+			instancing.pUniformBuffer->Unmap();
+		}
+	}
+
 	void Scene::InternalClear()
 	{
 		m_OpacityDrawSets.Clear();
@@ -1431,6 +1632,24 @@ namespace ve {
 		m_pNodeSelector->SetFound(nullptr);
 	}
 
+	void Scene::SetAabbTree(NodePtr node, AabbTree* pAabbTree)
+	{
+		NodeAttributePtr attribute = node->GetAttribute();
+		attribute->SetAabbTree(pAabbTree);
+
+		if (attribute->GetType() == NodeAttribute::TYPE_MODEL)
+		{
+			ModelPtr model = std::static_pointer_cast<IModel>(attribute);
+			Scene::SetAabbTree(model->GetRootNode(), pAabbTree);
+		}
+
+		uint32_t childCount = node->GetChildCount();
+		for (uint32_t i = 0; i < childCount; i++)
+		{
+			Scene::SetAabbTree(node->GetChild(i), pAabbTree);
+		}
+	}
+
 	void Scene::RenderGeometry(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex)
 	{
 		const glm::mat4& viewProjMatrix = m_Camera->GetViewProjectionMatrix();
@@ -1469,29 +1688,48 @@ namespace ve {
 			IV3DBuffer* pPrevVertexBuffer = nullptr;
 			IV3DPipeline* pPrevPipeline = nullptr;
 
+			IV3DDescriptorSet* pInstancingDescriptorSet = m_GeometoryStage.instancing.pDescriptorSet;
+			uint32_t instancingDynamicOffset = m_GeometoryStage.instancing.pUniformBuffer->GetNativeRangeSize() * frameIndex;
+
 			while (ppDrawSet != ppDrawSetEnd)
 			{
 				OpacityDrawSet* pDrawSet = *ppDrawSet;
 
-				if (pPrevVertexBuffer != pDrawSet->pVertexBuffer)
+				// CX^X̐ 0 ̕`ZbǵAO̕`Zbgɂ܂Ƃ߂Ă
+				if (pDrawSet->instanceCount > 0)
 				{
-					pCommandBuffer->BindVertexBuffer(0, pDrawSet->pVertexBuffer);
-					pCommandBuffer->BindIndexBuffer(pDrawSet->pIndexBuffer, 0, pDrawSet->indexType);
+					IV3DPipeline* pPipeline = (pDrawSet->instanceCount > 1) ? pDrawSet->pInstancingPipeline : pDrawSet->pPipeline;
 
-					pPrevVertexBuffer = pDrawSet->pVertexBuffer;
-				}
+					if (pPrevVertexBuffer != pDrawSet->pVertexBuffer)
+					{
+						pCommandBuffer->BindVertexBuffer(0, pDrawSet->pVertexBuffer);
+						pCommandBuffer->BindIndexBuffer(pDrawSet->pIndexBuffer, 0, pDrawSet->indexType);
 
-				if (pPrevPipeline != pDrawSet->pPipeline)
-				{
-					pCommandBuffer->BindPipeline(pDrawSet->pPipeline);
-					pCommandBuffer->PushConstant(pDrawSet->pPipeline, 0, &viewProjMatrix);
+						pPrevVertexBuffer = pDrawSet->pVertexBuffer;
+					}
 
-					pPrevPipeline = pDrawSet->pPipeline;
-				}
+					if (pPrevPipeline != pPipeline)
+					{
+						pCommandBuffer->BindPipeline(pPipeline);
+						pCommandBuffer->PushConstant(pPipeline, 0, &viewProjMatrix);
 
-				pCommandBuffer->BindDescriptorSet(pDrawSet->pPipeline, 0, 2, pDrawSet->descriptorSet, 2, pDrawSet->dynamicOffsets);
+						pPrevPipeline = pPipeline;
+					}
 
-				pCommandBuffer->DrawIndexed(pDrawSet->indexCount, 1, pDrawSet->firstIndex, 0, 0);
+					if (pDrawSet->instanceCount > 1)
+					{
+						IV3DDescriptorSet* descriptorSets[3] = { pDrawSet->descriptorSet[0], pDrawSet->descriptorSet[1], pInstancingDescriptorSet };
+						uint32_t dynamicOffsets[3] = { pDrawSet->dynamicOffsets[0], pDrawSet->dynamicOffsets[1], instancingDynamicOffset + pDrawSet->instanceOffset };
+
+						pCommandBuffer->BindDescriptorSet(pPipeline, 0, 3, descriptorSets, 3, dynamicOffsets);
+					}
+					else
+					{
+						pCommandBuffer->BindDescriptorSet(pPipeline, 0, 2, pDrawSet->descriptorSet, 2, pDrawSet->dynamicOffsets);
+					}
+
+					pCommandBuffer->DrawIndexed(pDrawSet->indexCount, pDrawSet->instanceCount, pDrawSet->firstIndex, 0, 0);
+				}
 
 				ppDrawSet++;
 			}
@@ -1674,6 +1912,7 @@ namespace ve {
 			TransparencyDrawSet** ppDrawSetEnd = ppDrawSet + m_TransparencyDrawSets.GetCount();
 
 			IV3DBuffer* pPrevVertexBuffer = nullptr;
+			IV3DBuffer* pPrevIndexBuffer = nullptr;
 			IV3DPipeline* pPrevPipeline = nullptr;
 
 			const glm::mat4& viewProjMatrix = m_Camera->GetViewProjectionMatrix();
@@ -1688,11 +1927,16 @@ namespace ve {
 				if (pPrevVertexBuffer != pDrawSet->pVertexBuffer)
 				{
 					pCommandBuffer->BindVertexBuffer(0, pDrawSet->pVertexBuffer);
-					pCommandBuffer->BindIndexBuffer(pDrawSet->pIndexBuffer, 0, pDrawSet->indexType);
-
 					pPrevVertexBuffer = pDrawSet->pVertexBuffer;
 				}
 
+				// ̓bVƂɃ\[gCfbNXobt@[gp邽߁A_obt@[Ƃ͕ʂɐ؂ւ
+				if (pPrevIndexBuffer != pDrawSet->pIndexBuffer)
+				{
+					pCommandBuffer->BindIndexBuffer(pDrawSet->pIndexBuffer, 0, pDrawSet->indexType);
+					pPrevIndexBuffer = pDrawSet->pIndexBuffer;
+				}
+
 				if (pPrevPipeline != pDrawSet->pPipeline)
 				{
 					pCommandBuffer->BindPipeline(pDrawSet->pPipeline);
@@ -2021,19 +2265,59 @@ namespace ve {
 		pCommandBuffer->Barrier(pipelineBarrier, memoryBarrier);
 	}
 
+	int32_t Scene::CompareOpacityDrawSet(const OpacityDrawSet* pLhs, const OpacityDrawSet* pRhs)
+	{
+		// }eẤACX^VOł܂Ƃ߂悤ɃWIgƃCfbNX͈̔͂ŕׂ
+
+		if (pLhs->sortKey != pRhs->sortKey)
+		{
+			return (pLhs->sortKey < pRhs->sortKey) ? -1 : 1;
+		}
+
+		uint64_t lhsVertexBuffer = reinterpret_cast<uint64_t>(pLhs->pVertexBuffer);
+		uint64_t rhsVertexBuffer = reinterpret_cast<uint64_t>(pRhs->pVertexBuffer);
+
+		if (lhsVertexBuffer != rhsVertexBuffer)
+		{
+			return (lhsVertexBuffer < rhsVertexBuffer) ? -1 : 1;
+		}
+
+		if (pLhs->firstIndex != pRhs->firstIndex)
+		{
+			return (pLhs->firstIndex < pRhs->firstIndex) ? -1 : 1;
+		}
+
+		if (pLhs->indexCount != pRhs->indexCount)
+		{
+			return (pLhs->indexCount < pRhs->indexCount) ? -1 : 1;
+		}
+
+		return 0;
+	}
+
+	bool Scene::CanBatchOpacityDrawSet(const OpacityDrawSet* pFirst, const OpacityDrawSet* pDrawSet)
+	{
+		return (pDrawSet->pInstancingPipeline == pFirst->pInstancingPipeline) &&
+			(pDrawSet->pPipeline == pFirst->pPipeline) &&
+			(pDrawSet->descriptorSet[1] == pFirst->descriptorSet[1]) &&
+			(pDrawSet->dynamicOffsets[1] == pFirst->dynamicOffsets[1]) &&
+			(pDrawSet->pVertexBuffer == pFirst->pVertexBuffer) &&
+			(pDrawSet->pIndexBuffer == pFirst->pIndexBuffer) &&
+			(pDrawSet->indexCount == pFirst->indexCount) &&
+			(pDrawSet->firstIndex == pFirst->firstIndex);
+	}
+
 	void Scene::SortOpacityDrawSet(OpacityDrawSet** list, int64_t first, int64_t last)
 	{
 		const OpacityDrawSet* pDrawSet = list[(first + last) >> 1];
 
-		uint64_t sortKey = pDrawSet->sortKey;
-
 		int64_t i = first;
 		int64_t j = last;
 
 		do
 		{
-			while (list[i]->sortKey < sortKey) { i++; }
-			while (list[j]->sortKey > sortKey) { j--; }
+			while (Scene::CompareOpacityDrawSet(list[i], pDrawSet) < 0) { i++; }
+			while (Scene::CompareOpacityDrawSet(list[j], pDrawSet) > 0) { j--; }
 
 			if (i <= j)
 			{
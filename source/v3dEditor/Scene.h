@@ -10,6 +10,7 @@ namespace ve {
 	class DynamicBuffer;
 	class NodeSelector;
 	class DebugRenderer;
+	class AabbTree;
 
 	class Scene final
 	{
@@ -114,6 +115,7 @@ namespace ve {
 
 		NodePtr GetRootNode();
 		NodePtr AddNode(NodePtr parent, const wchar_t* pName, uint32_t groupFlags, ModelPtr model);
+		void SetNodeModel(NodePtr node, ModelPtr model);
 		void RemoveNodeByGroup(NodePtr parent, uint32_t groupFlags);
 
 		void Update();
@@ -136,6 +138,9 @@ namespace ve {
 		static constexpr uint64_t ShadowDrawSet_DefaultCount = 1024;
 		static constexpr uint64_t ShadowDrawSet_ResizeStep = 256;
 
+		// 1 t[ŃCX^VOŕ`łCX^X̍ő吔 ( ͌ʂɕ`悷 )
+		static constexpr uint32_t InstanceMaxCount = 4096;
+
 		// ----------------------------------------------------------------------------------------------------
 
 		struct PasteStage
@@ -190,6 +195,14 @@ namespace ve {
 				DynamicBuffer* pVertexBuffer;
 				uint32_t vertexCount;
 			}grid;
+
+			// CX^VOŕ`悷郁bṼCX^XƂ̃f[^ ( `Zbĝ܂Ƃ܂育ƂɃACċl߂ )
+			struct Instancing
+			{
+				DynamicBuffer* pUniformBuffer;
+				IV3DDescriptorSet* pDescriptorSet;
+				uint32_t alignment;
+			}instancing;
 		};
 
 		struct SsaoStage
@@ -355,6 +368,10 @@ namespace ve {
 		NodeSelector* m_pNodeSelector;
 		Buffer m_SelectBuffer;
 
+		// bV̋E ( JO͓o^Ă郁bV̐̑ΐɔႷ )
+		AabbTree* m_pAabbTree;
+		collection::Vector<void*> m_CullingResults;
+
 		DebugRenderer* m_pDebugRenderer;
 
 		// ----------------------------------------------------------------------------------------------------
@@ -371,6 +388,10 @@ namespace ve {
 
 		void InternalClear();
 
+		void BatchOpacityDrawSets();
+
+		static void SetAabbTree(NodePtr node, AabbTree* pAabbTree);
+
 		void RenderGeometry(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex);
 		void RenderIllumination(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex);
 		void RenderForward(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex);
@@ -378,6 +399,8 @@ namespace ve {
 		void RenderImageEffect(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex);
 		void RenderFinish(IV3DCommandBuffer* pCommandBuffer, uint32_t frameIndex);
 
+		static int32_t CompareOpacityDrawSet(const OpacityDrawSet* pLhs, const OpacityDrawSet* pRhs);
+		static bool CanBatchOpacityDrawSet(const OpacityDrawSet* pFirst, const OpacityDrawSet* pDrawSet);
 		static void SortOpacityDrawSet(OpacityDrawSet** list, int64_t first, int64_t last);
 		static void SortTransparencyDrawSet(TransparencyDrawSet** list, int64_t first, int64_t last);
 	};
@@ -8,6 +8,12 @@
 #include "Material.h"
 #include "DebugRenderer.h"
 #include "IModel.h"
+#include "BackgroundQueue.h"
+#include "MeshOptimizer.h"
+#include "SkeletalModel.h"
+#include "AabbTree.h"
+#include <chrono>
+#include <glm\gtc\packing.hpp>
 
 namespace ve {
 
@@ -25,17 +31,131 @@ namespace ve {
 		return std::move(mesh);
 	}
 
+	SkeletalMeshPtr SkeletalMesh::CreateInstance(SkeletalMeshPtr source, IModel* pModel)
+	{
+		VE_ASSERT(source->m_Geometry != nullptr);
+
+		SkeletalMeshPtr mesh = SkeletalMesh::Create(source->m_DeviceContext, source->m_ID);
+
+		mesh->m_Geometry = source->m_Geometry;
+
+		mesh->m_Visible = source->m_Visible;
+		mesh->m_CastShadow = source->m_CastShadow;
+
+		mesh->m_PolygonCount = source->m_PolygonCount;
+		mesh->m_ACMR = source->m_ACMR;
+		mesh->m_ATVR = source->m_ATVR;
+
+		mesh->m_VertexFormat = source->m_VertexFormat;
+		mesh->m_VertexBufferSize = source->m_VertexBufferSize;
+		mesh->m_IndexBufferSize = source->m_IndexBufferSize;
+		mesh->m_IndexType = source->m_IndexType;
+
+		mesh->m_DequantizeUniform = source->m_DequantizeUniform;
+
+		// m_Bones.reserve
+		// m_Shapes.reserve
+		// m_WorldMatrices.resize
+		if (mesh->Preparation(source->m_Bones.size()) == false)
+		{
+			return nullptr;
+		}
+
+		mesh->m_MaterialIndices = source->m_MaterialIndices;
+		mesh->m_Clusters = source->m_Clusters;
+		mesh->m_Lods = source->m_Lods;
+		mesh->m_Shapes = source->m_Shapes;
+
+		// pCvC̓}eAA{[̐A_̃tH[}bgȂ̂ŁÂ܂܎gp
+		mesh->m_SelectSubset = source->m_SelectSubset;
+
+		// ----------------------------------------------------------------------------------------------------
+		// TuZbg ( fu|S̓[hsQƂ邽߁AbVƂɎ )
+		// ----------------------------------------------------------------------------------------------------
+
+		mesh->m_ColorSubsets.reserve(source->m_ColorSubsets.size());
+
+		auto it_cs_begin = source->m_ColorSubsets.begin();
+		auto it_cs_end = source->m_ColorSubsets.end();
+
+		for (auto it_cs = it_cs_begin; it_cs != it_cs_end; ++it_cs)
+		{
+			const SkeletalMesh::ColorSubset& srcColorSubset = (*it_cs);
+
+			mesh->m_ColorSubsets.push_back(SkeletalMesh::ColorSubset{});
+
+			SkeletalMesh::ColorSubset& dstColorSubset = mesh->m_ColorSubsets.back();
+			dstColorSubset.materialIndex = srcColorSubset.materialIndex;
+			dstColorSubset.pipelineHandle = srcColorSubset.pipelineHandle;
+			dstColorSubset.shadowPipelineHandle = srcColorSubset.shadowPipelineHandle;
+			dstColorSubset.instancingPipelineHandle = srcColorSubset.instancingPipelineHandle;
+			dstColorSubset.indexCount = srcColorSubset.indexCount;
+			dstColorSubset.firstIndex = srcColorSubset.firstIndex;
+			dstColorSubset.clusterCount = srcColorSubset.clusterCount;
+			dstColorSubset.firstCluster = srcColorSubset.firstCluster;
+			dstColorSubset.lodCount = srcColorSubset.lodCount;
+			dstColorSubset.firstLod = srcColorSubset.firstLod;
+			dstColorSubset.transparency = srcColorSubset.transparency;
+			dstColorSubset.debriPolygon = srcColorSubset.debriPolygon;
+
+			auto it_dp_begin = dstColorSubset.debriPolygon.begin();
+			auto it_dp_end = dstColorSubset.debriPolygon.end();
+
+			for (auto it_dp = it_dp_begin; it_dp != it_dp_end; ++it_dp)
+			{
+				for (uint32_t i = 0; i < 3; i++)
+				{
+					SkeletalMesh::DebriVertex& debriVertex = it_dp->vertices[i];
+					debriVertex.pWorldMatrix = &mesh->m_WorldMatrices[debriVertex.worldMatrixIndex];
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// {[ (  ID ̃m[hɒu )
+		// ----------------------------------------------------------------------------------------------------
+
+		auto it_bone_begin = source->m_Bones.begin();
+		auto it_bone_end = source->m_Bones.end();
+
+		for (auto it_bone = it_bone_begin; it_bone != it_bone_end; ++it_bone)
+		{
+			SkeletalMesh::Bone dstBone;
+			dstBone.node = pModel->GetNode(it_bone->node.lock()->GetID());
+			dstBone.offsetMatrix = it_bone->offsetMatrix;
+
+			mesh->m_Bones.push_back(dstBone);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ̃CfbNXobt@[̓t[Ƃɏނ߁AbVƂɍ쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		mesh->UpdateTransparencyIndexBuffer();
+
+		// ----------------------------------------------------------------------------------------------------
+
+		return std::move(mesh);
+	}
+
 	SkeletalMesh::SkeletalMesh() :
 		m_ID(-1),
 		m_PolygonCount(0),
+		m_ACMR(0.0f),
+		m_ATVR(0.0f),
 		m_SelectSubset({}),
 		m_Uniform({}),
+		m_DequantizeUniform({}),
 		m_pUniformBuffer(nullptr),
+		m_UniformMatrixCount(1),
+		m_VertexFormat(SkeletalMesh::VERTEX_FORMAT_DEFAULT),
 		m_VertexBufferSize(0),
-		m_VertexBuffer({}),
 		m_IndexBufferSize(0),
-		m_IndexBuffer({}),
 		m_IndexType(V3D_INDEX_TYPE_UINT16),
+		m_pTransparencyIndexBuffer(nullptr),
+		m_TransparencyIndexCapacity(0),
+		m_pAabbTree(nullptr),
+		m_AabbTreeProxy(AabbTree::NULL_PROXY),
 		m_Visible(true),
 		m_CastShadow(true)
 	{
@@ -87,6 +207,118 @@ namespace ve {
 				return false;
 			}
 		}
+		else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_4_0_0)
+		{
+			SkeletalMesh::File_InfoHeader_1_4_0_0 oldInfoHeader;
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_InfoHeader_1_4_0_0), &oldInfoHeader) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			infoHeader.flags = oldInfoHeader.flags;
+			infoHeader.polygonCount = oldInfoHeader.polygonCount;
+			infoHeader.materialCount = oldInfoHeader.materialCount;
+			infoHeader.debriVertexCount = oldInfoHeader.debriVertexCount;
+			infoHeader.colorSubsetCount = oldInfoHeader.colorSubsetCount;
+			infoHeader.clusterCount = oldInfoHeader.clusterCount;
+			infoHeader.lodCount = 0;
+			infoHeader.boneCount = oldInfoHeader.boneCount;
+			infoHeader.shapeCount = oldInfoHeader.shapeCount;
+			infoHeader.vertexBufferSize = oldInfoHeader.vertexBufferSize;
+			infoHeader.indexBufferSize = oldInfoHeader.indexBufferSize;
+			infoHeader.indexType = oldInfoHeader.indexType;
+			infoHeader.acmr = oldInfoHeader.acmr;
+			infoHeader.atvr = oldInfoHeader.atvr;
+			infoHeader.vertexFormat = oldInfoHeader.vertexFormat;
+			memcpy_s(infoHeader.positionScale, sizeof(infoHeader.positionScale), oldInfoHeader.positionScale, sizeof(oldInfoHeader.positionScale));
+			memcpy_s(infoHeader.positionOffset, sizeof(infoHeader.positionOffset), oldInfoHeader.positionOffset, sizeof(oldInfoHeader.positionOffset));
+		}
+		else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_3_0_0)
+		{
+			SkeletalMesh::File_InfoHeader_1_3_0_0 oldInfoHeader;
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_InfoHeader_1_3_0_0), &oldInfoHeader) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			infoHeader.flags = oldInfoHeader.flags;
+			infoHeader.polygonCount = oldInfoHeader.polygonCount;
+			infoHeader.materialCount = oldInfoHeader.materialCount;
+			infoHeader.debriVertexCount = oldInfoHeader.debriVertexCount;
+			infoHeader.colorSubsetCount = oldInfoHeader.colorSubsetCount;
+			infoHeader.clusterCount = 0;
+			infoHeader.lodCount = 0;
+			infoHeader.boneCount = oldInfoHeader.boneCount;
+			infoHeader.shapeCount = oldInfoHeader.shapeCount;
+			infoHeader.vertexBufferSize = oldInfoHeader.vertexBufferSize;
+			infoHeader.indexBufferSize = oldInfoHeader.indexBufferSize;
+			infoHeader.indexType = oldInfoHeader.indexType;
+			infoHeader.acmr = oldInfoHeader.acmr;
+			infoHeader.atvr = oldInfoHeader.atvr;
+			infoHeader.vertexFormat = oldInfoHeader.vertexFormat;
+			memcpy_s(infoHeader.positionScale, sizeof(infoHeader.positionScale), oldInfoHeader.positionScale, sizeof(oldInfoHeader.positionScale));
+			memcpy_s(infoHeader.positionOffset, sizeof(infoHeader.positionOffset), oldInfoHeader.positionOffset, sizeof(oldInfoHeader.positionOffset));
+		}
+		else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_2_0_0)
+		{
+			SkeletalMesh::File_InfoHeader_1_2_0_0 oldInfoHeader;
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_InfoHeader_1_2_0_0), &oldInfoHeader) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			infoHeader.flags = oldInfoHeader.flags;
+			infoHeader.polygonCount = oldInfoHeader.polygonCount;
+			infoHeader.materialCount = oldInfoHeader.materialCount;
+			infoHeader.debriVertexCount = oldInfoHeader.debriVertexCount;
+			infoHeader.colorSubsetCount = oldInfoHeader.colorSubsetCount;
+			infoHeader.clusterCount = 0;
+			infoHeader.lodCount = 0;
+			infoHeader.boneCount = oldInfoHeader.boneCount;
+			infoHeader.shapeCount = oldInfoHeader.shapeCount;
+			infoHeader.vertexBufferSize = oldInfoHeader.vertexBufferSize;
+			infoHeader.indexBufferSize = oldInfoHeader.indexBufferSize;
+			infoHeader.indexType = oldInfoHeader.indexType;
+			infoHeader.acmr = oldInfoHeader.acmr;
+			infoHeader.atvr = oldInfoHeader.atvr;
+			infoHeader.vertexFormat = SkeletalMesh::VERTEX_FORMAT_DEFAULT;
+			infoHeader.positionScale[0] = infoHeader.positionScale[1] = infoHeader.positionScale[2] = infoHeader.positionScale[3] = 1.0f;
+			infoHeader.positionOffset[0] = infoHeader.positionOffset[1] = infoHeader.positionOffset[2] = infoHeader.positionOffset[3] = 0.0f;
+		}
+		else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_1_0_0)
+		{
+			SkeletalMesh::File_InfoHeader_1_1_0_0 oldInfoHeader;
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_InfoHeader_1_1_0_0), &oldInfoHeader) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			infoHeader.flags = oldInfoHeader.flags;
+			infoHeader.polygonCount = oldInfoHeader.polygonCount;
+			infoHeader.materialCount = oldInfoHeader.materialCount;
+			infoHeader.debriVertexCount = oldInfoHeader.debriVertexCount;
+			infoHeader.colorSubsetCount = oldInfoHeader.colorSubsetCount;
+			infoHeader.clusterCount = 0;
+			infoHeader.lodCount = 0;
+			infoHeader.boneCount = oldInfoHeader.boneCount;
+			infoHeader.shapeCount = oldInfoHeader.shapeCount;
+			infoHeader.vertexBufferSize = oldInfoHeader.vertexBufferSize;
+			infoHeader.indexBufferSize = oldInfoHeader.indexBufferSize;
+			infoHeader.indexType = oldInfoHeader.indexType;
+			infoHeader.acmr = 0.0f;
+			infoHeader.atvr = 0.0f;
+			infoHeader.vertexFormat = SkeletalMesh::VERTEX_FORMAT_DEFAULT;
+			infoHeader.positionScale[0] = infoHeader.positionScale[1] = infoHeader.positionScale[2] = infoHeader.positionScale[3] = 1.0f;
+			infoHeader.positionOffset[0] = infoHeader.positionOffset[1] = infoHeader.positionOffset[2] = infoHeader.positionOffset[3] = 0.0f;
+		}
 		else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_0_0_0)
 		{
 			SkeletalMesh::File_InfoHeader_1_0_0_0 oldInfoHeader;
@@ -102,11 +334,18 @@ namespace ve {
 			infoHeader.materialCount = oldInfoHeader.materialCount;
 			infoHeader.debriVertexCount = oldInfoHeader.debriVertexCount;
 			infoHeader.colorSubsetCount = oldInfoHeader.colorSubsetCount;
+			infoHeader.clusterCount = 0;
+			infoHeader.lodCount = 0;
 			infoHeader.boneCount = oldInfoHeader.boneCount;
 			infoHeader.shapeCount = oldInfoHeader.shapeCount;
 			infoHeader.vertexBufferSize = oldInfoHeader.vertexBufferSize;
 			infoHeader.indexBufferSize = oldInfoHeader.indexBufferSize;
 			infoHeader.indexType = oldInfoHeader.indexType;
+			infoHeader.acmr = 0.0f;
+			infoHeader.atvr = 0.0f;
+			infoHeader.vertexFormat = SkeletalMesh::VERTEX_FORMAT_DEFAULT;
+			infoHeader.positionScale[0] = infoHeader.positionScale[1] = infoHeader.positionScale[2] = infoHeader.positionScale[3] = 1.0f;
+			infoHeader.positionOffset[0] = infoHeader.positionOffset[1] = infoHeader.positionOffset[2] = infoHeader.positionOffset[3] = 0.0f;
 		}
 		else
 		{
@@ -122,11 +361,17 @@ namespace ve {
 		m_CastShadow = (infoHeader.flags & SkeletalMesh::File_INFO_CAST_SHADOW) ? true : false;
 
 		m_PolygonCount = infoHeader.polygonCount;
+		m_ACMR = infoHeader.acmr;
+		m_ATVR = infoHeader.atvr;
 
+		m_VertexFormat = static_cast<SkeletalMesh::VERTEX_FORMAT>(infoHeader.vertexFormat);
 		m_VertexBufferSize = infoHeader.vertexBufferSize;
 		m_IndexBufferSize = infoHeader.indexBufferSize;
 		m_IndexType = static_cast<V3D_INDEX_TYPE>(infoHeader.indexType);
 
+		m_DequantizeUniform.positionScale = glm::vec4(infoHeader.positionScale[0], infoHeader.positionScale[1], infoHeader.positionScale[2], infoHeader.positionScale[3]);
+		m_DequantizeUniform.positionOffset = glm::vec4(infoHeader.positionOffset[0], infoHeader.positionOffset[1], infoHeader.positionOffset[2], infoHeader.positionOffset[3]);
+
 		// m_Bones.reserve
 		// m_Shapes.reserve
 		// m_WorldMatrices.resize
@@ -175,10 +420,61 @@ namespace ve {
 			collection::Vector<SkeletalMesh::File_ColorSubset> colorSubsets;
 			colorSubsets.resize(infoHeader.colorSubsetCount);
 
-			if (FileRead(fileHandle, sizeof(File_ColorSubset) * colorSubsets.size(), colorSubsets.data()) == false)
+			if (fileHeader.version == SkeletalMesh::CURRENT_VERSION)
 			{
-				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
-				return false;
+				if (FileRead(fileHandle, sizeof(File_ColorSubset) * colorSubsets.size(), colorSubsets.data()) == false)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+					return false;
+				}
+			}
+			else if (fileHeader.version == SkeletalMesh::OLD_VERSION_1_4_0_0)
+			{
+				collection::Vector<SkeletalMesh::File_ColorSubset_1_4_0_0> oldColorSubsets;
+				oldColorSubsets.resize(infoHeader.colorSubsetCount);
+
+				if (FileRead(fileHandle, sizeof(File_ColorSubset_1_4_0_0) * oldColorSubsets.size(), oldColorSubsets.data()) == false)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+					return false;
+				}
+
+				for (size_t i = 0; i < oldColorSubsets.size(); i++)
+				{
+					colorSubsets[i].materialIndex = oldColorSubsets[i].materialIndex;
+					colorSubsets[i].debriVertexCount = oldColorSubsets[i].debriVertexCount;
+					colorSubsets[i].firstDebriVertex = oldColorSubsets[i].firstDebriVertex;
+					colorSubsets[i].indexCount = oldColorSubsets[i].indexCount;
+					colorSubsets[i].firstIndex = oldColorSubsets[i].firstIndex;
+					colorSubsets[i].clusterCount = oldColorSubsets[i].clusterCount;
+					colorSubsets[i].firstCluster = oldColorSubsets[i].firstCluster;
+					colorSubsets[i].lodCount = 0;
+					colorSubsets[i].firstLod = 0;
+				}
+			}
+			else
+			{
+				collection::Vector<SkeletalMesh::File_ColorSubset_1_3_0_0> oldColorSubsets;
+				oldColorSubsets.resize(infoHeader.colorSubsetCount);
+
+				if (FileRead(fileHandle, sizeof(File_ColorSubset_1_3_0_0) * oldColorSubsets.size(), oldColorSubsets.data()) == false)
+				{
+					logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+					return false;
+				}
+
+				for (size_t i = 0; i < oldColorSubsets.size(); i++)
+				{
+					colorSubsets[i].materialIndex = oldColorSubsets[i].materialIndex;
+					colorSubsets[i].debriVertexCount = oldColorSubsets[i].debriVertexCount;
+					colorSubsets[i].firstDebriVertex = oldColorSubsets[i].firstDebriVertex;
+					colorSubsets[i].indexCount = oldColorSubsets[i].indexCount;
+					colorSubsets[i].firstIndex = oldColorSubsets[i].firstIndex;
+					colorSubsets[i].clusterCount = 0;
+					colorSubsets[i].firstCluster = 0;
+					colorSubsets[i].lodCount = 0;
+					colorSubsets[i].firstLod = 0;
+				}
 			}
 
 			auto it_cs_begin = colorSubsets.begin();
@@ -196,6 +492,10 @@ namespace ve {
 				dstColorSubset.materialIndex = srcColorSubset.materialIndex;
 				dstColorSubset.indexCount = srcColorSubset.indexCount;
 				dstColorSubset.firstIndex = srcColorSubset.firstIndex;
+				dstColorSubset.clusterCount = srcColorSubset.clusterCount;
+				dstColorSubset.firstCluster = srcColorSubset.firstCluster;
+				dstColorSubset.lodCount = srcColorSubset.lodCount;
+				dstColorSubset.firstLod = srcColorSubset.firstLod;
 				dstColorSubset.debriPolygon.reserve(srcColorSubset.debriVertexCount / 3);
 
 				for (uint32_t i = 0; i < srcColorSubset.debriVertexCount; i += 3)
@@ -230,6 +530,67 @@ namespace ve {
 
 			m_SelectSubset.indexCount = srcSelectSubset.indexCount;
 			m_SelectSubset.firstIndex = srcSelectSubset.firstIndex;
+
+			/**************/
+			/* NX^[ */
+			/**************/
+
+			collection::Vector<SkeletalMesh::File_Cluster> clusters;
+			clusters.resize(infoHeader.clusterCount);
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_Cluster) * clusters.size(), clusters.data()) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			m_Clusters.reserve(clusters.size());
+
+			auto it_cl_begin = clusters.begin();
+			auto it_cl_end = clusters.end();
+
+			for (auto it_cl = it_cl_begin; it_cl != it_cl_end; ++it_cl)
+			{
+				const SkeletalMesh::File_Cluster& srcCluster = (*it_cl);
+
+				MeshOptimizer::Cluster dstCluster;
+				dstCluster.center = glm::vec3(srcCluster.sphere[0], srcCluster.sphere[1], srcCluster.sphere[2]);
+				dstCluster.radius = srcCluster.sphere[3];
+				dstCluster.coneAxis = glm::vec3(srcCluster.cone[0], srcCluster.cone[1], srcCluster.cone[2]);
+				dstCluster.coneCutoff = srcCluster.cone[3];
+				dstCluster.indexCount = srcCluster.indexCount;
+				dstCluster.firstIndex = srcCluster.firstIndex;
+
+				m_Clusters.push_back(dstCluster);
+			}
+
+			/*******/
+			/* LOD */
+			/*******/
+
+			collection::Vector<SkeletalMesh::File_Lod> lods;
+			lods.resize(infoHeader.lodCount);
+
+			if (FileRead(fileHandle, sizeof(SkeletalMesh::File_Lod) * lods.size(), lods.data()) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to read the file");
+				return false;
+			}
+
+			m_Lods.reserve(lods.size());
+
+			auto it_lod_begin = lods.begin();
+			auto it_lod_end = lods.end();
+
+			for (auto it_lod = it_lod_begin; it_lod != it_lod_end; ++it_lod)
+			{
+				MeshOptimizer::Lod dstLod;
+				dstLod.indexCount = it_lod->indexCount;
+				dstLod.firstIndex = it_lod->firstIndex;
+				dstLod.error = it_lod->error;
+
+				m_Lods.push_back(dstLod);
+			}
 		}
 
 		// ----------------------------------------------------------------------------------------------------
@@ -337,6 +698,117 @@ namespace ve {
 				return false;
 			}
 
+			/************************************************************************/
+			/* Ât@C͒_LbV̓vANX^[ALOD ō쐬 */
+			/************************************************************************/
+
+			if (fileHeader.version != SkeletalMesh::CURRENT_VERSION)
+			{
+				collection::Vector<uint32_t> indices;
+
+				if (m_IndexType == V3D_INDEX_TYPE_UINT16)
+				{
+					const uint16_t* pIndex = reinterpret_cast<const uint16_t*>(srcIndexBuffer.data());
+					const uint16_t* pIndexEnd = pIndex + srcIndexBuffer.size() / sizeof(uint16_t);
+
+					indices.reserve(pIndexEnd - pIndex);
+
+					while (pIndex != pIndexEnd)
+					{
+						indices.push_back(*pIndex++);
+					}
+				}
+				else
+				{
+					indices.resize(srcIndexBuffer.size() / sizeof(uint32_t));
+					memcpy_s(indices.data(), sizeof(uint32_t) * indices.size(), srcIndexBuffer.data(), srcIndexBuffer.size());
+				}
+
+				uint32_t vertexCount = static_cast<uint32_t>(srcVertexBuffer.size() / GetVertexStride());
+
+				if ((fileHeader.version == SkeletalMesh::OLD_VERSION_1_0_0_0) || (fileHeader.version == SkeletalMesh::OLD_VERSION_1_1_0_0))
+				{
+					MeshOptimizer::AnalyzeVertexCache(indices.data(), static_cast<uint32_t>(indices.size()), vertexCount, m_ACMR, m_ATVR);
+				}
+
+				collection::Vector<glm::vec3> positions;
+				collection::Vector<glm::vec3> normals;
+				collection::Vector<uint32_t> boneIndices;
+				positions.reserve(vertexCount);
+				normals.reserve(vertexCount);
+				boneIndices.reserve(vertexCount);
+
+				if (m_VertexFormat == SkeletalMesh::VERTEX_FORMAT_PACKED)
+				{
+					const SkeletalMesh::PackedVertex* pVertex = reinterpret_cast<const SkeletalMesh::PackedVertex*>(srcVertexBuffer.data());
+					const SkeletalMesh::PackedVertex* pVertexEnd = pVertex + vertexCount;
+
+					glm::vec3 positionScale = glm::vec3(m_DequantizeUniform.positionScale) / 65535.0f;
+					glm::vec3 positionOffset = glm::vec3(m_DequantizeUniform.positionOffset);
+
+					while (pVertex != pVertexEnd)
+					{
+						positions.push_back(positionOffset + glm::vec3(pVertex->pos[0], pVertex->pos[1], pVertex->pos[2]) * positionScale);
+						normals.push_back(SkeletalMesh::DecodeOctahedron(glm::vec2(glm::unpackSnorm1x16(pVertex->tangentFrame[0]), glm::unpackSnorm1x16(pVertex->tangentFrame[1]))));
+						boneIndices.push_back(SkeletalMesh::GetDominantBoneIndex(
+							glm::ivec4(pVertex->indices[0], pVertex->indices[1], pVertex->indices[2], pVertex->indices[3]),
+							glm::vec4(pVertex->weights[0], pVertex->weights[1], pVertex->weights[2], pVertex->weights[3])));
+						pVertex++;
+					}
+				}
+				else
+				{
+					const SkeletalMesh::Vertex* pVertex = reinterpret_cast<const SkeletalMesh::Vertex*>(srcVertexBuffer.data());
+					const SkeletalMesh::Vertex* pVertexEnd = pVertex + vertexCount;
+
+					while (pVertex != pVertexEnd)
+					{
+						positions.push_back(pVertex->pos);
+						normals.push_back(pVertex->normal);
+						boneIndices.push_back(SkeletalMesh::GetDominantBoneIndex(pVertex->indices, pVertex->weights));
+						pVertex++;
+					}
+				}
+
+				if (fileHeader.version != SkeletalMesh::OLD_VERSION_1_4_0_0)
+				{
+					BuildClusters(positions.data(), normals.data(), vertexCount, indices.data());
+				}
+
+				BuildLods(positions.data(), boneIndices.data(), vertexCount, indices);
+
+				// LOD ̃CfbNXǉ̂ɒu
+				if (m_IndexType == V3D_INDEX_TYPE_UINT16)
+				{
+					srcIndexBuffer.resize(sizeof(uint16_t) * indices.size());
+
+					const uint32_t* pSrcIndex = indices.data();
+					const uint32_t* pSrcIndexEnd = pSrcIndex + indices.size();
+					uint16_t* pDstIndex = reinterpret_cast<uint16_t*>(srcIndexBuffer.data());
+
+					while (pSrcIndex != pSrcIndexEnd)
+					{
+						*pDstIndex++ = static_cast<uint16_t>(*pSrcIndex++);
+					}
+				}
+				else
+				{
+					srcIndexBuffer.resize(sizeof(uint32_t) * indices.size());
+					memcpy_s(srcIndexBuffer.data(), srcIndexBuffer.size(), indices.data(), sizeof(uint32_t) * indices.size());
+				}
+
+				m_IndexBufferSize = srcIndexBuffer.size();
+				infoHeader.indexBufferSize = m_IndexBufferSize;
+			}
+
+			/**************************************************/
+			/* ̃\[gŎgpCfbNXێ */
+			/**************************************************/
+
+			m_Geometry = std::make_shared<SkeletalMesh::Geometry>(m_DeviceContext);
+
+			KeepTransparencyIndices(srcIndexBuffer.data());
+
 			/****************/
 			/* Abv[h */
 			/****************/
@@ -351,7 +823,7 @@ namespace ve {
 				infoHeader.vertexBufferSize,
 				V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_VERTEX,
 				V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_VERTEX_READ,
-				&m_VertexBuffer.pResource, &m_VertexBuffer.resourceAllocation, VE_INTERFACE_DEBUG_NAME(L"VE_VertexBuffer"));
+				&m_Geometry->vertexBuffer.pResource, &m_Geometry->vertexBuffer.resourceAllocation, VE_INTERFACE_DEBUG_NAME(L"VE_VertexBuffer"));
 
 			if (uploadResult == false)
 			{
@@ -366,7 +838,7 @@ namespace ve {
 					infoHeader.indexBufferSize,
 					V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_INDEX,
 					V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ,
-					&m_IndexBuffer.pResource, &m_IndexBuffer.resourceAllocation, VE_INTERFACE_DEBUG_NAME(L"VE_IndexBuffer"));
+					&m_Geometry->indexBuffer.pResource, &m_Geometry->indexBuffer.resourceAllocation, VE_INTERFACE_DEBUG_NAME(L"VE_IndexBuffer"));
 			}
 
 			m_DeviceContext->GetImmediateContextPtr()->End();
@@ -438,6 +910,10 @@ namespace ve {
 				dstColorSubset.firstDebriVertex = static_cast<uint32_t>(firstDebriVertex);
 				dstColorSubset.indexCount = srcColorSubset.indexCount;
 				dstColorSubset.firstIndex = srcColorSubset.firstIndex;
+				dstColorSubset.clusterCount = srcColorSubset.clusterCount;
+				dstColorSubset.firstCluster = srcColorSubset.firstCluster;
+				dstColorSubset.lodCount = srcColorSubset.lodCount;
+				dstColorSubset.firstLod = srcColorSubset.firstLod;
 
 				colorSubsets.push_back(dstColorSubset);
 			}
@@ -446,6 +922,59 @@ namespace ve {
 			selectSubset.firstIndex = m_SelectSubset.firstIndex;
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// NX^[̃Xg쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<SkeletalMesh::File_Cluster> clusters;
+		clusters.reserve(m_Clusters.size());
+
+		{
+			auto it_begin = m_Clusters.begin();
+			auto it_end = m_Clusters.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				const MeshOptimizer::Cluster& srcCluster = (*it);
+
+				SkeletalMesh::File_Cluster dstCluster;
+				dstCluster.sphere[0] = srcCluster.center.x;
+				dstCluster.sphere[1] = srcCluster.center.y;
+				dstCluster.sphere[2] = srcCluster.center.z;
+				dstCluster.sphere[3] = srcCluster.radius;
+				dstCluster.cone[0] = srcCluster.coneAxis.x;
+				dstCluster.cone[1] = srcCluster.coneAxis.y;
+				dstCluster.cone[2] = srcCluster.coneAxis.z;
+				dstCluster.cone[3] = srcCluster.coneCutoff;
+				dstCluster.indexCount = srcCluster.indexCount;
+				dstCluster.firstIndex = srcCluster.firstIndex;
+
+				clusters.push_back(dstCluster);
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// LOD ̃Xg쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<SkeletalMesh::File_Lod> lods;
+		lods.reserve(m_Lods.size());
+
+		{
+			auto it_begin = m_Lods.begin();
+			auto it_end = m_Lods.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				SkeletalMesh::File_Lod dstLod;
+				dstLod.indexCount = it->indexCount;
+				dstLod.firstIndex = it->firstIndex;
+				dstLod.error = it->error;
+
+				lods.push_back(dstLod);
+			}
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// {[̃Xg쐬
 		// ----------------------------------------------------------------------------------------------------
@@ -551,11 +1080,24 @@ namespace ve {
 		infoHeader.materialCount = static_cast<uint32_t>(m_MaterialIndices.size());
 		infoHeader.debriVertexCount = static_cast<uint32_t>(debriVertices.size());
 		infoHeader.colorSubsetCount = static_cast<uint32_t>(colorSubsets.size());
+		infoHeader.clusterCount = static_cast<uint32_t>(clusters.size());
+		infoHeader.lodCount = static_cast<uint32_t>(lods.size());
 		infoHeader.boneCount = static_cast<uint32_t>(bones.size());
 		infoHeader.shapeCount = static_cast<uint32_t>(shapes.size());
 		infoHeader.vertexBufferSize = m_VertexBufferSize;
 		infoHeader.indexBufferSize = m_IndexBufferSize;
 		infoHeader.indexType = m_IndexType;
+		infoHeader.acmr = m_ACMR;
+		infoHeader.atvr = m_ATVR;
+		infoHeader.vertexFormat = m_VertexFormat;
+		infoHeader.positionScale[0] = m_DequantizeUniform.positionScale.x;
+		infoHeader.positionScale[1] = m_DequantizeUniform.positionScale.y;
+		infoHeader.positionScale[2] = m_DequantizeUniform.positionScale.z;
+		infoHeader.positionScale[3] = m_DequantizeUniform.positionScale.w;
+		infoHeader.positionOffset[0] = m_DequantizeUniform.positionOffset.x;
+		infoHeader.positionOffset[1] = m_DequantizeUniform.positionOffset.y;
+		infoHeader.positionOffset[2] = m_DequantizeUniform.positionOffset.z;
+		infoHeader.positionOffset[3] = m_DequantizeUniform.positionOffset.w;
 
 		if (FileWrite(fileHandle, sizeof(SkeletalMesh::File_InfoHeader), &infoHeader) == false)
 		{
@@ -603,6 +1145,32 @@ namespace ve {
 			return false;
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// NX^[
+		// ----------------------------------------------------------------------------------------------------
+
+		if (clusters.empty() == false)
+		{
+			if (FileWrite(fileHandle, sizeof(File_Cluster) * clusters.size(), clusters.data()) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to write the file");
+				return false;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// LOD 
+		// ----------------------------------------------------------------------------------------------------
+
+		if (lods.empty() == false)
+		{
+			if (FileWrite(fileHandle, sizeof(File_Lod) * lods.size(), lods.data()) == false)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Failed to write the file");
+				return false;
+			}
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// {[
 		// ----------------------------------------------------------------------------------------------------
@@ -640,7 +1208,7 @@ namespace ve {
 		ResourceAllocation hostVertexBufferAllocation;
 
 		m_DeviceContext->GetImmediateContextPtr()->Begin();
-		downloadResult = m_DeviceContext->GetImmediateContextPtr()->Download(V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_VERTEX_READ, m_VertexBuffer.pResource, &pHostVertexBuffer, &hostVertexBufferAllocation);
+		downloadResult = m_DeviceContext->GetImmediateContextPtr()->Download(V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_VERTEX_READ, m_Geometry->vertexBuffer.pResource, &pHostVertexBuffer, &hostVertexBufferAllocation);
 		m_DeviceContext->GetImmediateContextPtr()->End();
 
 		if (downloadResult == false)
@@ -681,7 +1249,7 @@ namespace ve {
 		ResourceAllocation hostIndexBufferAllocation;
 
 		m_DeviceContext->GetImmediateContextPtr()->Begin();
-		downloadResult = m_DeviceContext->GetImmediateContextPtr()->Download(V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, m_IndexBuffer.pResource, &pHostIndexBuffer, &hostIndexBufferAllocation);
+		downloadResult = m_DeviceContext->GetImmediateContextPtr()->Download(V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, m_Geometry->indexBuffer.pResource, &pHostIndexBuffer, &hostIndexBufferAllocation);
 		m_DeviceContext->GetImmediateContextPtr()->End();
 
 		if (downloadResult == false)
@@ -722,6 +1290,9 @@ namespace ve {
 	{
 		size_t worldMatrixCount = (boneCount > 0) ? boneCount : 1;
 
+		// VF[_[ worldMatrices ̓{[pbg̗vfɐ؂グĂ
+		m_UniformMatrixCount = (boneCount > 0) ? GraphicsFactory::GetBonePaletteSize(boneCount) : 1;
+
 		// ----------------------------------------------------------------------------------------------------
 		// jtH[obt@[쐬
 		// ----------------------------------------------------------------------------------------------------
@@ -730,7 +1301,8 @@ namespace ve {
 		VE_DEBUG_CODE(StringW debugName = StringW(L"SkeletalMesh_") + std::to_wstring(m_ID));
 		VE_DEBUG_CODE(pDebugName = debugName.c_str());
 
-		m_pUniformBuffer = DynamicBuffer::Create(m_DeviceContext, V3D_BUFFER_USAGE_UNIFORM, sizeof(glm::mat4) * worldMatrixCount + sizeof(uint32_t), V3D_PIPELINE_STAGE_VERTEX_SHADER, V3D_ACCESS_UNIFORM_READ, pDebugName);
+		// worldMatrices[m_UniformMatrixCount] key ( vec4 ɃAC ) positionScale positionOffset
+		m_pUniformBuffer = DynamicBuffer::Create(m_DeviceContext, V3D_BUFFER_USAGE_UNIFORM, sizeof(glm::mat4) * m_UniformMatrixCount + sizeof(glm::vec4) + sizeof(MeshDequantizeUniform), V3D_PIPELINE_STAGE_VERTEX_SHADER, V3D_ACCESS_UNIFORM_READ, pDebugName);
 		if (m_pUniformBuffer == nullptr)
 		{
 			return false;
@@ -805,52 +1377,184 @@ namespace ve {
 
 	bool SkeletalMesh::BuildVertexIndexData(
 		LoggerPtr logger,
-		collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount,
+		const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+		const collection::Vector<IModelSource::Polygon>& srcPolygons, uint32_t firstPolygon, uint32_t polygonCount,
 		const ModelRendererConfig& config,
-		int32_t id, int32_t lastID)
+		int32_t id, int32_t lastID,
+		BackgroundJobHandlePtr handle)
 	{
-		m_PolygonCount = polygonCount;
-
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		m_PolygonCount = polygonCount;
+
 		// ----------------------------------------------------------------------------------------------------
 		// |S}eAPʂŃ\[g
 		// ----------------------------------------------------------------------------------------------------
 
-		auto it_polygon_begin = polygons.begin() + firstPolygon;
-		auto it_polygon_end = it_polygon_begin + polygonCount;
+		// \[X͑̃bVƋLĂ邽߁Am[h̃|S ( CfbNX̂ ) Rs[Ȃ\[g
+		// }eA̐͏Ȃ̂ŁA}eAƂɃ|S𐔂ĕz ( Ȃ̂ŁA}eÃ|S̓\[X̏Ԃۂ )
+
+		const IModelSource::Polygon* pSrcPolygonBegin = srcPolygons.data() + firstPolygon;
+		const IModelSource::Polygon* pSrcPolygonEnd = pSrcPolygonBegin + polygonCount;
+
+		collection::Vector<IModelSource::Polygon> polygons;
+
+		if (polygonCount > 0)
+		{
+			int32_t minMaterialIndex = pSrcPolygonBegin->materialIndex;
+			int32_t maxMaterialIndex = pSrcPolygonBegin->materialIndex;
+
+			for (const IModelSource::Polygon* pSrcPolygon = pSrcPolygonBegin; pSrcPolygon != pSrcPolygonEnd; ++pSrcPolygon)
+			{
+				minMaterialIndex = std::min(minMaterialIndex, pSrcPolygon->materialIndex);
+				maxMaterialIndex = std::max(maxMaterialIndex, pSrcPolygon->materialIndex);
+			}
+
+			// }eAƂ̃|S̐𐔂āAz̐擪ɕϊ
+			collection::Vector<uint32_t> materialOffsets(static_cast<size_t>(maxMaterialIndex - minMaterialIndex) + 1, 0);
+
+			for (const IModelSource::Polygon* pSrcPolygon = pSrcPolygonBegin; pSrcPolygon != pSrcPolygonEnd; ++pSrcPolygon)
+			{
+				materialOffsets[pSrcPolygon->materialIndex - minMaterialIndex]++;
+			}
+
+			uint32_t materialOffset = 0;
+
+			auto it_begin = materialOffsets.begin();
+			auto it_end = materialOffsets.end();
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				uint32_t count = (*it);
+				(*it) = materialOffset;
+				materialOffset += count;
+			}
+
+			// z
+			polygons.resize(polygonCount);
 
-		std::sort(it_polygon_begin, it_polygon_end, [](const IModelSource::Polygon& rhs, const IModelSource::Polygon& lhs) { return rhs.materialIndex < lhs.materialIndex; });
+			for (const IModelSource::Polygon* pSrcPolygon = pSrcPolygonBegin; pSrcPolygon != pSrcPolygonEnd; ++pSrcPolygon)
+			{
+				polygons[materialOffsets[pSrcPolygon->materialIndex - minMaterialIndex]++] = *pSrcPolygon;
+			}
+		}
 
 		// ----------------------------------------------------------------------------------------------------
 		// TuZbgAo[ebNXXgACfbNXXg쐬
 		// ----------------------------------------------------------------------------------------------------
 
-		collection::Vector<SkeletalMesh::Vertex> vertices;
-		vertices.reserve(polygonCount * 3);
+		collection::Vector<SkeletalMesh::Vertex>& vertices = m_BuildVertices;
+		vertices.clear();
+		vertices.reserve(vertexCount);
 
-		collection::Vector<uint32_t> indices;
-		indices.reserve(polygonCount);
+		collection::Vector<uint32_t>& indices = m_BuildIndices;
+		indices.clear();
+		indices.reserve(polygonCount * 3);
 
 		if (config.optimizeEnable == true)
 		{
-			OptimizeVertexIndexData(logger, polygons, firstPolygon, polygonCount, config.smoosingEnable, config.smoosingCos, lastID, vertices, indices);
+			// i̓TuZbgƂɉ
+			if (OptimizeVertexIndexData(logger, srcVertices, firstVertex, vertexCount, polygons, config.smoosingEnable, config.smoosingCos, lastID, vertices, indices, handle) == false)
+			{
+				return false;
+			}
 		}
 		else
 		{
-			NotOptimizeVertexIndexData(logger, polygons, firstPolygon, polygonCount, lastID, vertices, indices);
+			NotOptimizeVertexIndexData(logger, srcVertices, firstVertex, vertexCount, polygons, lastID, vertices, indices);
+			handle->AddProgress(polygonCount);
 		}
 
 		m_SelectSubset.indexCount = static_cast<uint32_t>(indices.size());
 		m_SelectSubset.firstIndex = 0;
 
-		m_VertexBufferSize = sizeof(SkeletalMesh::Vertex) * vertices.size();
+		MeshOptimizer::AnalyzeVertexCache(indices.data(), static_cast<uint32_t>(indices.size()), static_cast<uint32_t>(vertices.size()), m_ACMR, m_ATVR);
+
+		// ----------------------------------------------------------------------------------------------------
+		// NX^[ALOD 쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		if (handle->IsCancelRequested() == true)
+		{
+			return false;
+		}
+
+		{
+			collection::Vector<glm::vec3> positions;
+			collection::Vector<glm::vec3> normals;
+			collection::Vector<uint32_t> boneIndices;
+			positions.reserve(vertices.size());
+			normals.reserve(vertices.size());
+			boneIndices.reserve(vertices.size());
+
+			auto it_begin = vertices.begin();
+			auto it_end = vertices.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				positions.push_back(it->pos);
+				normals.push_back(it->normal);
+				boneIndices.push_back(SkeletalMesh::GetDominantBoneIndex(it->indices, it->weights));
+			}
+
+			BuildClusters(positions.data(), normals.data(), static_cast<uint32_t>(vertices.size()), indices.data());
+
+			logger->PrintA(Logger::TYPE_INFO, "Build Clusters[%d/%d] : ClusterCount[%u]", id, lastID, static_cast<uint32_t>(m_Clusters.size()));
+
+			uint32_t lod0IndexCount = static_cast<uint32_t>(indices.size());
+
+			// LOD ̃CfbNX indices ̌ɒǉ
+			BuildLods(positions.data(), boneIndices.data(), static_cast<uint32_t>(vertices.size()), indices);
+
+			logger->PrintA(Logger::TYPE_INFO, "Build Lods[%d/%d] : LodCount[%u] IndexCount[%u -> %u]", id, lastID, static_cast<uint32_t>(m_Lods.size()), lod0IndexCount, static_cast<uint32_t>(indices.size()));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// o[ebNXʎq
+		// ----------------------------------------------------------------------------------------------------
+
+		m_VertexFormat = SkeletalMesh::VERTEX_FORMAT_DEFAULT;
+		m_DequantizeUniform.positionScale = glm::vec4(1.0f);
+		m_DequantizeUniform.positionOffset = glm::vec4(0.0f);
+
+		if (config.packedVertexEnable == true)
+		{
+			if (m_WorldMatrices.size() <= SkeletalMesh::PACKED_VERTEX_MAX_BONE_COUNT)
+			{
+				PackVertices(vertices, m_BuildPackedVertices, m_DequantizeUniform);
+				m_VertexFormat = SkeletalMesh::VERTEX_FORMAT_PACKED;
+
+				logger->PrintA(Logger::TYPE_INFO, "Pack Mesh[%d/%d] : VertexSize[%u -> %u]", id, lastID, static_cast<uint32_t>(sizeof(SkeletalMesh::Vertex)), static_cast<uint32_t>(sizeof(SkeletalMesh::PackedVertex)));
+			}
+			else
+			{
+				logger->PrintA(Logger::TYPE_WARNING, "Pack Mesh[%d/%d] : Skipped because there are too many bones : BoneCount[%u/%u]", id, lastID, static_cast<uint32_t>(m_WorldMatrices.size()), static_cast<uint32_t>(SkeletalMesh::PACKED_VERTEX_MAX_BONE_COUNT));
+			}
+		}
+
+		m_VertexBufferSize = GetVertexStride() * vertices.size();
 
 		m_IndexType = (indices.size() <= USHRT_MAX) ? V3D_INDEX_TYPE_UINT16 : V3D_INDEX_TYPE_UINT32;
 		m_IndexBufferSize = (m_IndexType == V3D_INDEX_TYPE_UINT16) ? (sizeof(uint16_t) * indices.size()) : (sizeof(uint32_t) * indices.size());
 
+		// ----------------------------------------------------------------------------------------------------
+
+		return true;
+	}
+
+	bool SkeletalMesh::UploadVertexIndexData()
+	{
+		const collection::Vector<SkeletalMesh::Vertex>& vertices = m_BuildVertices;
+		const collection::Vector<uint32_t>& indices = m_BuildIndices;
+
 		// ----------------------------------------------------------------------------------------------------
 		// Abv[h
 		// ----------------------------------------------------------------------------------------------------
 
+		m_Geometry = std::make_shared<SkeletalMesh::Geometry>(m_DeviceContext);
+
 		bool uploadResult;
 
 		m_DeviceContext->GetImmediateContextPtr()->Begin();
@@ -859,9 +1563,12 @@ namespace ve {
 		/* o[ebNXobt@[ */
 		/**************************/
 
+		const void* pVertices = (m_VertexFormat == SkeletalMesh::VERTEX_FORMAT_PACKED) ? static_cast<const void*>(m_BuildPackedVertices.data()) : static_cast<const void*>(vertices.data());
+		VE_ASSERT(m_VertexBufferSize == GetVertexStride() * vertices.size());
+
 		uploadResult = m_DeviceContext->GetImmediateContextPtr()->Upload(
-			vertices.data(), sizeof(SkeletalMesh::Vertex) * vertices.size(),
-			V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_VERTEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_VERTEX_READ, &m_VertexBuffer.pResource, &m_VertexBuffer.resourceAllocation,
+			pVertices, m_VertexBufferSize,
+			V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_VERTEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_VERTEX_READ, &m_Geometry->vertexBuffer.pResource, &m_Geometry->vertexBuffer.resourceAllocation,
 			VE_INTERFACE_DEBUG_NAME(L"VE_VertexBuffer"));
 
 		/**************************/
@@ -884,20 +1591,31 @@ namespace ve {
 
 				uploadResult = m_DeviceContext->GetImmediateContextPtr()->Upload(
 					nweIndices.data(), sizeof(uint16_t) * nweIndices.size(),
-					V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_INDEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, &m_IndexBuffer.pResource, &m_IndexBuffer.resourceAllocation,
+					V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_INDEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, &m_Geometry->indexBuffer.pResource, &m_Geometry->indexBuffer.resourceAllocation,
 					VE_INTERFACE_DEBUG_NAME(L"VE_IndexBuffer"));
+
+				// ̃\[gŎgp邽߁ALOD 0 ͈͎̔͂cĂ
+				KeepTransparencyIndices(nweIndices.data());
 			}
 			else
 			{
 				uploadResult = m_DeviceContext->GetImmediateContextPtr()->Upload(
 					indices.data(), sizeof(uint32_t) * indices.size(),
-					V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_INDEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, &m_IndexBuffer.pResource, &m_IndexBuffer.resourceAllocation,
+					V3D_BUFFER_USAGE_TRANSFER_SRC | V3D_BUFFER_USAGE_INDEX, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, &m_Geometry->indexBuffer.pResource, &m_Geometry->indexBuffer.resourceAllocation,
 					VE_INTERFACE_DEBUG_NAME(L"VE_IndexBuffer"));
+
+				// ̃\[gŎgp邽߁ALOD 0 ͈͎̔͂cĂ
+				KeepTransparencyIndices(indices.data());
 			}
 		}
 
 		m_DeviceContext->GetImmediateContextPtr()->End();
 
+		// 쐬Xg͕svɂȂ̂ŉĂ
+		collection::Vector<SkeletalMesh::Vertex>().swap(m_BuildVertices);
+		collection::Vector<SkeletalMesh::PackedVertex>().swap(m_BuildPackedVertices);
+		collection::Vector<uint32_t>().swap(m_BuildIndices);
+
 		if (uploadResult == false)
 		{
 			return false;
@@ -908,6 +1626,28 @@ namespace ve {
 		return true;
 	}
 
+	uint64_t SkeletalMesh::EstimateBuildMemorySize(uint32_t vertexCount, uint32_t polygonCount, const ModelRendererConfig& config)
+	{
+		// \[g|S̃Rs[ACfbNXXg ( LOD ܂߂ LOD 0 ̔{ )
+		uint64_t size = static_cast<uint64_t>(polygonCount) * (sizeof(IModelSource::Polygon) + sizeof(uint32_t) * 3 * 2);
+
+		// o[ebNXXgANX^[ALOD ̍쐬ɎgpʒuA@A{[
+		size += static_cast<uint64_t>(vertexCount) * (sizeof(SkeletalMesh::Vertex) + sizeof(glm::vec3) * 2 + sizeof(uint32_t));
+
+		if (config.optimizeEnable == true)
+		{
+			// _̃O[vAnځALbV̍œKɎgpe[u
+			size += static_cast<uint64_t>(vertexCount) * sizeof(uint32_t) * 4;
+		}
+
+		if (config.packedVertexEnable == true)
+		{
+			size += static_cast<uint64_t>(vertexCount) * sizeof(SkeletalMesh::PackedVertex);
+		}
+
+		return size;
+	}
+
 	void SkeletalMesh::AddShape(const glm::vec3& center, const glm::vec3& xAxis, const glm::vec3& yAxis, const glm::vec3& zAxis, const glm::vec3& halfExtent)
 	{
 		SkeletalMesh::Shape shape;
@@ -955,87 +1695,333 @@ namespace ve {
 	}
 
 	void SkeletalMesh::Draw(
-		const Plane& nearPlane,
+		const Frustum& frustum,
 		uint32_t frameIndex,
 		collection::Vector<MaterialPtr>& materials,
 		collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
 		collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets)
 	{
+		const Plane& nearPlane = frustum.GetPlane(Frustum::PLANE_TYPE_NEAR);
+
+		// ----------------------------------------------------------------------------------------------------
+		// NX^[̃JȌ
+		// ----------------------------------------------------------------------------------------------------
+
+		const glm::mat4& worldMatrix = m_WorldMatrices[0];
+		glm::mat3 normalMatrix = worldMatrix;
+
+		float scaleX = glm::length(normalMatrix[0]);
+		float scaleY = glm::length(normalMatrix[1]);
+		float scaleZ = glm::length(normalMatrix[2]);
+
+		float minScale = std::min(scaleX, std::min(scaleY, scaleZ));
+		float maxScale = std::max(scaleX, std::max(scaleY, scaleZ));
+
+		float radiusScale = maxScale;
+
+		// {[ŕό`郁bV̓NX^[̋EςĂ܂߁ATuZbgPʂŕ`悷
+		bool clusterCullingEnable = (m_Bones.empty() == true) && (m_Clusters.empty() == false);
+
+		// sψȃXP[A]ĂƖ@R[̂܂܎gȂ߁Awʂ̃JO͂Ȃ
+		bool coneCullingEnable = (clusterCullingEnable == true) && (minScale > VE_FLOAT_EPSILON) && ((maxScale - minScale) <= (maxScale * 0.001f)) && (glm::determinant(normalMatrix) > 0.0f);
+
+		// ----------------------------------------------------------------------------------------------------
+		// LOD ̑Ȉ
+		// ----------------------------------------------------------------------------------------------------
+
+		// LOD ̌덷 (  ) ɂƃXN[̃sNZɂȂW ( _bV̓ɂꍇ LOD gpȂ )
+		float lodErrorScale = 0.0f;
+
+		if (m_Lods.empty() == false)
+		{
+			const glm::vec3& eyePos = frustum.GetEyePos();
+			float distance = glm::distance(eyePos, glm::clamp(eyePos, m_AABB.minimum, m_AABB.maximum));
+
+			if (distance > VE_FLOAT_EPSILON)
+			{
+				lodErrorScale = maxScale * frustum.GetPixelScale() / distance;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// `Zbgǉ
+		// ----------------------------------------------------------------------------------------------------
+
 		size_t subsetCount = m_ColorSubsets.size();
 
 		SkeletalMesh::ColorSubset* pSubset = m_ColorSubsets.data();
 		SkeletalMesh::ColorSubset* pSubsetEnd = pSubset + subsetCount;
 
+		bool transparencyEnable = false;
+
 		while (pSubset != pSubsetEnd)
 		{
 			Material* pMaterial = materials[pSubset->materialIndex].get();
 			BLEND_MODE blendMode = pMaterial->GetBlendMode();
 
-			if (pMaterial->GetBlendMode() == BLEND_MODE_COPY)
-			{
-				OpacityDrawSet* pDrawSet = *opacityDrawSets.Add(1);
+			// ̓fu|SƃCfbNXΉĂ邽߁A LOD 0 ŕ`悷
+			const MeshOptimizer::Lod* pLod = (blendMode == BLEND_MODE_COPY) ? SelectLod(pSubset, lodErrorScale) : nullptr;
 
-				pDrawSet->sortKey = pMaterial->GetKey();
-				pDrawSet->pPipeline = pSubset->pipelineHandle->GetPtr();
-				pDrawSet->descriptorSet[0] = m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR];
-				pDrawSet->descriptorSet[1] = pMaterial->GetNativeDescriptorSetPtr(Material::DST_COLOR);
-				pDrawSet->dynamicOffsets[0] = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
-				pDrawSet->dynamicOffsets[1] = pMaterial->GetDynamicOffset() * frameIndex;
-				pDrawSet->pVertexBuffer = m_VertexBuffer.pResource;
-				pDrawSet->pIndexBuffer = m_IndexBuffer.pResource;
-				pDrawSet->indexType = m_IndexType;
-				pDrawSet->indexCount = pSubset->indexCount;
-				pDrawSet->firstIndex = pSubset->firstIndex;
+			if (pLod != nullptr)
+			{
+				// NX^[ LOD 0 ̂̂Ȃ̂ŁALOD gpꍇ̓TuZbgPʂŕ`悷
+				AddOpacityDrawSet(pSubset, pMaterial, frameIndex, pLod->firstIndex, pLod->indexCount, opacityDrawSets);
 			}
-			else
+			else if ((pMaterial->GetBlendMode() == BLEND_MODE_COPY) && (clusterCullingEnable == true) && (pSubset->clusterCount > 0))
 			{
-				size_t debriPolygonCount = pSubset->debriPolygon.size();
-				SkeletalMesh::DebriPolygon* pDebriPolygon = pSubset->debriPolygon.data();
-				SkeletalMesh::DebriPolygon* pDebriPolygonEnd = pDebriPolygon + debriPolygonCount;
+				// ĂNX^[̂ACfbNXAĂ̂͂܂Ƃ߂ĕ`悷
+
+				bool subsetConeCullingEnable = (coneCullingEnable == true) && (pMaterial->GetCullMode() == V3D_CULL_MODE_BACK);
 
-				TransparencyDrawSet** ppDrawSet = transparencyDrawSets.Add(debriPolygonCount);
+				const MeshOptimizer::Cluster* pCluster = &m_Clusters[pSubset->firstCluster];
+				const MeshOptimizer::Cluster* pClusterEnd = pCluster + pSubset->clusterCount;
 
-				uint32_t firstIndex = pSubset->firstIndex;
+				uint32_t firstIndex = 0;
+				uint32_t indexCount = 0;
 
-				while (pDebriPolygon != pDebriPolygonEnd)
+				while (pCluster != pClusterEnd)
 				{
-					SkeletalMesh::DebriVertex* pDebriVertex = &pDebriPolygon->vertices[0];
-					SkeletalMesh::DebriVertex* pDebriVertexEnd = pDebriVertex + 3;
+					Sphere sphere(worldMatrix * glm::vec4(pCluster->center, 1.0f), pCluster->radius * radiusScale);
+
+					bool visible = frustum.Contains(sphere);
+
+					if ((visible == true) && (subsetConeCullingEnable == true))
+					{
+						glm::vec3 coneAxis = glm::normalize(normalMatrix * pCluster->coneAxis);
+						glm::vec3 eyeToCenter = sphere.center - frustum.GetEyePos();
 
-					float sortKey = +VE_FLOAT_MAX;
-					glm::vec3 worldPos;
+						// NX^[̑SẴgCAOwʂĂ
+						if (glm::dot(eyeToCenter, coneAxis) >= (pCluster->coneCutoff * glm::length(eyeToCenter) + sphere.radius))
+						{
+							visible = false;
+						}
+					}
 
-					while (pDebriVertex != pDebriVertexEnd)
+					if (visible == true)
 					{
-						worldPos = *pDebriVertex->pWorldMatrix * pDebriVertex->pos;					
-						sortKey = std::min(sortKey, glm::dot(nearPlane.normal, worldPos) + nearPlane.d);
+						if ((indexCount > 0) && ((firstIndex + indexCount) == pCluster->firstIndex))
+						{
+							indexCount += pCluster->indexCount;
+						}
+						else
+						{
+							if (indexCount > 0)
+							{
+								AddOpacityDrawSet(pSubset, pMaterial, frameIndex, firstIndex, indexCount, opacityDrawSets);
+							}
 
-						pDebriVertex++;
+							firstIndex = pCluster->firstIndex;
+							indexCount = pCluster->indexCount;
+						}
 					}
 
-					TransparencyDrawSet* pDrawSet = *ppDrawSet;
-					
-					pDrawSet->sortKey = sortKey;
-					pDrawSet->pPipeline = pSubset->pipelineHandle->GetPtr();
-					pDrawSet->descriptorSet[0] = m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR];
-					pDrawSet->descriptorSet[1] = pMaterial->GetNativeDescriptorSetPtr(Material::DST_COLOR);
-					pDrawSet->dynamicOffsets[0] = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
-					pDrawSet->dynamicOffsets[1] = pMaterial->GetDynamicOffset() * frameIndex;
-					pDrawSet->pVertexBuffer = m_VertexBuffer.pResource;
-					pDrawSet->pIndexBuffer = m_IndexBuffer.pResource;
-					pDrawSet->indexType = m_IndexType;
-					pDrawSet->indexCount = 3;
-					pDrawSet->firstIndex = firstIndex;
-
-					firstIndex += 3;
-					pDebriPolygon++;
-
-					ppDrawSet++;
+					pCluster++;
+				}
+
+				if (indexCount > 0)
+				{
+					AddOpacityDrawSet(pSubset, pMaterial, frameIndex, firstIndex, indexCount, opacityDrawSets);
 				}
 			}
+			else if (pMaterial->GetBlendMode() == BLEND_MODE_COPY)
+			{
+				AddOpacityDrawSet(pSubset, pMaterial, frameIndex, pSubset->firstIndex, pSubset->indexCount, opacityDrawSets);
+			}
+			else
+			{
+				transparencyEnable = true;
+			}
 
 			pSubset++;
 		}
+
+		if (transparencyEnable == true)
+		{
+			DrawTransparency(nearPlane, frameIndex, materials, transparencyDrawSets);
+		}
+	}
+
+	void SkeletalMesh::AddOpacityDrawSet(
+		const SkeletalMesh::ColorSubset* pSubset, Material* pMaterial,
+		uint32_t frameIndex,
+		uint32_t firstIndex, uint32_t indexCount,
+		collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets)
+	{
+		OpacityDrawSet* pDrawSet = *opacityDrawSets.Add(1);
+
+		pDrawSet->sortKey = pMaterial->GetKey();
+		pDrawSet->pPipeline = pSubset->pipelineHandle->GetPtr();
+		pDrawSet->descriptorSet[0] = m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR];
+		pDrawSet->descriptorSet[1] = pMaterial->GetNativeDescriptorSetPtr(Material::DST_COLOR);
+		pDrawSet->dynamicOffsets[0] = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
+		pDrawSet->dynamicOffsets[1] = pMaterial->GetDynamicOffset() * frameIndex;
+		pDrawSet->pVertexBuffer = m_Geometry->vertexBuffer.pResource;
+		pDrawSet->pIndexBuffer = m_Geometry->indexBuffer.pResource;
+		pDrawSet->indexType = m_IndexType;
+		pDrawSet->indexCount = indexCount;
+		pDrawSet->firstIndex = firstIndex;
+		pDrawSet->pInstancingPipeline = (pSubset->instancingPipelineHandle != nullptr) ? pSubset->instancingPipelineHandle->GetPtr() : nullptr;
+		pDrawSet->pWorldMatrix = &m_WorldMatrices[0];
+		pDrawSet->key = m_Uniform.key;
+		pDrawSet->instanceCount = 1;
+		pDrawSet->instanceOffset = 0;
+	}
+
+	void SkeletalMesh::DrawTransparency(
+		const Plane& nearPlane,
+		uint32_t frameIndex,
+		collection::Vector<MaterialPtr>& materials,
+		collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// \[gL[߂
+		// ----------------------------------------------------------------------------------------------------
+
+		m_TransparencyPolygons.clear();
+
+		uint32_t subsetCount = static_cast<uint32_t>(m_ColorSubsets.size());
+
+		for (uint32_t subsetIndex = 0; subsetIndex < subsetCount; subsetIndex++)
+		{
+			const SkeletalMesh::ColorSubset& subset = m_ColorSubsets[subsetIndex];
+			Material* pMaterial = materials[subset.materialIndex].get();
+
+			if (pMaterial->GetBlendMode() == BLEND_MODE_COPY)
+			{
+				continue;
+			}
+
+			const SkeletalMesh::DebriPolygon* pDebriPolygon = subset.debriPolygon.data();
+			const SkeletalMesh::DebriPolygon* pDebriPolygonEnd = pDebriPolygon + subset.debriPolygon.size();
+
+			uint32_t firstIndex = subset.firstIndex;
+
+			while (pDebriPolygon != pDebriPolygonEnd)
+			{
+				const SkeletalMesh::DebriVertex* pDebriVertex = &pDebriPolygon->vertices[0];
+				const SkeletalMesh::DebriVertex* pDebriVertexEnd = pDebriVertex + 3;
+
+				float sortKey = +VE_FLOAT_MAX;
+				glm::vec3 worldPos;
+
+				while (pDebriVertex != pDebriVertexEnd)
+				{
+					worldPos = *pDebriVertex->pWorldMatrix * pDebriVertex->pos;
+					sortKey = std::min(sortKey, glm::dot(nearPlane.normal, worldPos) + nearPlane.d);
+
+					pDebriVertex++;
+				}
+
+				SkeletalMesh::TransparencyPolygon polygon;
+				polygon.sortKey = sortKey;
+				polygon.subsetIndex = subsetIndex;
+				polygon.firstIndex = firstIndex;
+				m_TransparencyPolygons.push_back(polygon);
+
+				firstIndex += 3;
+				pDebriPolygon++;
+			}
+		}
+
+		if (m_TransparencyPolygons.empty() == true)
+		{
+			return;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// OɃ\[gāACfbNX
+		// ----------------------------------------------------------------------------------------------------
+
+		IV3DBuffer* pIndexBuffer;
+		uint32_t baseIndex;
+
+		// ɂ΂ŃCfbNXobt@[Ȃꍇ\[gȂ
+		bool sortEnable = (m_pTransparencyIndexBuffer != nullptr) && (m_TransparencyPolygons.size() * 3 <= m_TransparencyIndexCapacity);
+
+		if (sortEnable == true)
+		{
+			std::sort(m_TransparencyPolygons.begin(), m_TransparencyPolygons.end(), [](const SkeletalMesh::TransparencyPolygon& lh, const SkeletalMesh::TransparencyPolygon& rh) { return lh.sortKey > rh.sortKey; });
+
+			// ێĂCfbNX̓bṼCfbNX̌^Ȃ̂ŁA|SPʂł̂܂܃Rs[
+			uint32_t indexSize = (m_IndexType == V3D_INDEX_TYPE_UINT16) ? sizeof(uint16_t) : sizeof(uint32_t);
+			uint32_t polygonSize = indexSize * 3;
+
+			const SkeletalMesh::TransparencyPolygon* pPolygon = m_TransparencyPolygons.data();
+			const SkeletalMesh::TransparencyPolygon* pPolygonEnd = pPolygon + m_TransparencyPolygons.size();
+
+			const uint8_t* pSrcIndices = m_Geometry->transparencyIndices.data();
+			uint8_t* pDstIndex = static_cast<uint8_t*>(m_pTransparencyIndexBuffer->Map());
+
+			while (pPolygon != pPolygonEnd)
+			{
+				memcpy_s(pDstIndex, polygonSize, pSrcIndices + indexSize * pPolygon->firstIndex, polygonSize);
+				pDstIndex += polygonSize;
+				pPolygon++;
+			}
+
+			m_pTransparencyIndexBuffer->Unmap();
+
+			// foCX̃obt@[̓t[Ƃɗ̈悪Ă
+			pIndexBuffer = m_pTransparencyIndexBuffer->GetNativeBufferPtr();
+			baseIndex = m_pTransparencyIndexBuffer->GetNativeRangeSize() * frameIndex / indexSize;
+		}
+		else
+		{
+			// \[głȂꍇ́ATuZbgPʂŌ̃CfbNX`悷
+			pIndexBuffer = m_Geometry->indexBuffer.pResource;
+			baseIndex = 0;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// `Zbgǉ
+		// ----------------------------------------------------------------------------------------------------
+
+		// TuZbg̃|SAĂ͈͂܂Ƃ߂ĕ`悷
+		// \[gL[ɂ͔͈͂̐擪 ( ԉ ) ̃|Ŝ̂gp邽߁AbV̕`揇̓V[̃\[gۂ
+
+		const SkeletalMesh::TransparencyPolygon* pPolygon = m_TransparencyPolygons.data();
+		const SkeletalMesh::TransparencyPolygon* pPolygonEnd = pPolygon + m_TransparencyPolygons.size();
+		uint32_t polygonIndex = 0;
+
+		while (pPolygon != pPolygonEnd)
+		{
+			const SkeletalMesh::TransparencyPolygon* pRunPolygon = pPolygon;
+			uint32_t runPolygonCount = 0;
+
+			while ((pPolygon != pPolygonEnd) && (pPolygon->subsetIndex == pRunPolygon->subsetIndex))
+			{
+				runPolygonCount++;
+				pPolygon++;
+			}
+
+			const SkeletalMesh::ColorSubset& subset = m_ColorSubsets[pRunPolygon->subsetIndex];
+			Material* pMaterial = materials[subset.materialIndex].get();
+
+			TransparencyDrawSet* pDrawSet = *transparencyDrawSets.Add(1);
+
+			pDrawSet->sortKey = pRunPolygon->sortKey;
+			pDrawSet->pPipeline = subset.pipelineHandle->GetPtr();
+			pDrawSet->descriptorSet[0] = m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR];
+			pDrawSet->descriptorSet[1] = pMaterial->GetNativeDescriptorSetPtr(Material::DST_COLOR);
+			pDrawSet->dynamicOffsets[0] = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
+			pDrawSet->dynamicOffsets[1] = pMaterial->GetDynamicOffset() * frameIndex;
+			pDrawSet->pVertexBuffer = m_Geometry->vertexBuffer.pResource;
+			pDrawSet->pIndexBuffer = pIndexBuffer;
+			pDrawSet->indexType = m_IndexType;
+
+			if (sortEnable == true)
+			{
+				pDrawSet->indexCount = runPolygonCount * 3;
+				pDrawSet->firstIndex = baseIndex + polygonIndex * 3;
+			}
+			else
+			{
+				pDrawSet->indexCount = subset.indexCount;
+				pDrawSet->firstIndex = subset.firstIndex;
+			}
+
+			polygonIndex += runPolygonCount;
+		}
 	}
 
 	void SkeletalMesh::DrawShadow(
@@ -1064,8 +2050,8 @@ namespace ve {
 				pDrawSet->descriptorSet[1] = pMaterial->GetNativeDescriptorSetPtr(Material::DST_SHADOW);
 				pDrawSet->dynamicOffsets[0] = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
 				pDrawSet->dynamicOffsets[1] = pMaterial->GetDynamicOffset() * frameIndex;
-				pDrawSet->pVertexBuffer = m_VertexBuffer.pResource;
-				pDrawSet->pIndexBuffer = m_IndexBuffer.pResource;
+				pDrawSet->pVertexBuffer = m_Geometry->vertexBuffer.pResource;
+				pDrawSet->pIndexBuffer = m_Geometry->indexBuffer.pResource;
 				pDrawSet->indexType = m_IndexType;
 				pDrawSet->indexCount = pSubset->indexCount;
 				pDrawSet->firstIndex = pSubset->firstIndex;
@@ -1088,6 +2074,8 @@ namespace ve {
 
 	void SkeletalMesh::Dispose()
 	{
+		SetAabbTree(nullptr);
+
 		DeleteDeviceChild(m_DeviceContext->GetDeletingQueuePtr(), &m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR]);
 		DeleteDeviceChild(m_DeviceContext->GetDeletingQueuePtr(), &m_pNativeDescriptorSet[SkeletalMesh::DST_SHADOW]);
 
@@ -1097,8 +2085,15 @@ namespace ve {
 			m_pUniformBuffer = nullptr;
 		}
 
-		DeleteResource(m_DeviceContext->GetDeletingQueuePtr(), &m_VertexBuffer.pResource, &m_VertexBuffer.resourceAllocation);
-		DeleteResource(m_DeviceContext->GetDeletingQueuePtr(), &m_IndexBuffer.pResource, &m_IndexBuffer.resourceAllocation);
+		if (m_pTransparencyIndexBuffer != nullptr)
+		{
+			m_pTransparencyIndexBuffer->Destroy();
+			m_pTransparencyIndexBuffer = nullptr;
+			m_TransparencyIndexCapacity = 0;
+		}
+
+		// ̃bVƋLĂꍇ́AŌɎQƂƂɍ폜
+		m_Geometry = nullptr;
 	}
 
 	/***************************/
@@ -1120,6 +2115,16 @@ namespace ve {
 		return static_cast<uint32_t>(m_Bones.size());
 	}
 
+	float SkeletalMesh::GetACMR() const
+	{
+		return m_ACMR;
+	}
+
+	float SkeletalMesh::GetATVR() const
+	{
+		return m_ATVR;
+	}
+
 	uint32_t SkeletalMesh::GetMaterialCount() const
 	{
 		return static_cast<uint32_t>(m_MaterialIndices.size());
@@ -1219,6 +2224,22 @@ namespace ve {
 
 		m_AABB.UpdateCenterAndPoints();
 
+		// ----------------------------------------------------------------------------------------------------
+		// V[ AABB c[XV ( LEɎ܂Ăꍇ͓ȂȂ )
+		// ----------------------------------------------------------------------------------------------------
+
+		if (m_pAabbTree != nullptr)
+		{
+			if (m_AabbTreeProxy == AabbTree::NULL_PROXY)
+			{
+				m_AabbTreeProxy = m_pAabbTree->Add(m_AABB.minimum, m_AABB.maximum, static_cast<NodeAttribute*>(this));
+			}
+			else
+			{
+				m_pAabbTree->Move(m_AabbTreeProxy, m_AABB.minimum, m_AABB.maximum);
+			}
+		}
+
 		// ----------------------------------------------------------------------------------------------------
 		// jtH[obt@[XV
 		// ----------------------------------------------------------------------------------------------------
@@ -1226,10 +2247,14 @@ namespace ve {
 		uint8_t* pMemory = static_cast<uint8_t*>(m_pUniformBuffer->Map());
 		VE_ASSERT(pMemory != nullptr);
 
-		size_t worldMatricesSize = sizeof(glm::mat4) * m_WorldMatrices.size();
-		memcpy_s(pMemory, m_pUniformBuffer->GetNativeRangeSize(), m_WorldMatrices.data(), worldMatricesSize);
+		// {[pbg̎gpĂȂvf͏܂Ȃ
+		size_t worldMatricesSize = sizeof(glm::mat4) * m_UniformMatrixCount;
+		memcpy_s(pMemory, m_pUniformBuffer->GetNativeRangeSize(), m_WorldMatrices.data(), sizeof(glm::mat4) * m_WorldMatrices.size());
 		memcpy_s(pMemory + worldMatricesSize, m_pUniformBuffer->GetNativeRangeSize() - worldMatricesSize, &m_Uniform.key, sizeof(uint32_t));
 
+		size_t dequantizeOffset = worldMatricesSize + sizeof(glm::vec4);
+		memcpy_s(pMemory + dequantizeOffset, m_pUniformBuffer->GetNativeRangeSize() - dequantizeOffset, &m_DequantizeUniform, sizeof(MeshDequantizeUniform));
+
 		m_pUniformBuffer->Unmap();
 	}
 
@@ -1241,32 +2266,60 @@ namespace ve {
 	{
 		SkeletalMesh::ColorSubset& colorSubset = m_ColorSubsets[subsetIndex];
 
+		uint32_t shaderFlags = MATERIAL_SHADER_SKELETAL | pMaterial->GetShaderFlags();
+		if (m_VertexFormat == SkeletalMesh::VERTEX_FORMAT_PACKED)
+		{
+			shaderFlags |= MATERIAL_SHADER_PACKED_VERTEX;
+		}
+
+		uint32_t vertexStride = GetVertexStride();
+
 		colorSubset.pipelineHandle = m_DeviceContext->GetGraphicsFactoryPtr()->GetPipelineHandle(
 			GraphicsFactory::MPT_COLOR,
-			MATERIAL_SHADER_SKELETAL | pMaterial->GetShaderFlags(),
+			shaderFlags,
 			m_Bones.size(),
-			sizeof(SkeletalMesh::Vertex),
+			vertexStride,
 			pMaterial->GetPolygonMode(), pMaterial->GetCullMode(),
 			pMaterial->GetBlendMode());
 
 		colorSubset.shadowPipelineHandle = m_DeviceContext->GetGraphicsFactoryPtr()->GetPipelineHandle(
 			GraphicsFactory::MPT_SHADOW,
-			MATERIAL_SHADER_SKELETAL | pMaterial->GetShaderFlags(),
+			shaderFlags,
 			m_Bones.size(),
-			sizeof(SkeletalMesh::Vertex),
+			vertexStride,
 			pMaterial->GetPolygonMode(), pMaterial->GetCullMode(),
 			pMaterial->GetBlendMode());
 
-		if (m_SelectSubset.pipelineHandle == nullptr)
+		// {[̖sȃTuZbǵAbVQƂm[h܂Ƃ߂ĕ`ł悤ɂĂ
+		if ((m_Bones.empty() == true) && (pMaterial->GetBlendMode() == BLEND_MODE_COPY))
+		{
+			colorSubset.instancingPipelineHandle = m_DeviceContext->GetGraphicsFactoryPtr()->GetPipelineHandle(
+				GraphicsFactory::MPT_COLOR,
+				shaderFlags | MATERIAL_SHADER_INSTANCING,
+				m_Bones.size(),
+				vertexStride,
+				pMaterial->GetPolygonMode(), pMaterial->GetCullMode(),
+				pMaterial->GetBlendMode());
+		}
+		else
+		{
+			colorSubset.instancingPipelineHandle = nullptr;
+		}
+
+		if (m_SelectSubset.pipelineHandle == nullptr)
 		{
 			m_SelectSubset.pipelineHandle = m_DeviceContext->GetGraphicsFactoryPtr()->GetPipelineHandle(
 				GraphicsFactory::MPT_SELECT,
-				MATERIAL_SHADER_SKELETAL | pMaterial->GetShaderFlags(),
+				shaderFlags,
 				m_Bones.size(),
-				sizeof(SkeletalMesh::Vertex),
+				vertexStride,
 				pMaterial->GetPolygonMode(), pMaterial->GetCullMode(),
 				pMaterial->GetBlendMode());
 		}
+
+		// ̓t[ƂɃ\[gCfbNXŕ`悷邽߁Aݐ̃CfbNXobt@[쐬Ă
+		colorSubset.transparency = (pMaterial->GetBlendMode() != BLEND_MODE_COPY);
+		UpdateTransparencyIndexBuffer();
 	}
 
 	/*****************************/
@@ -1288,356 +2341,535 @@ namespace ve {
 		drawSet.pPipeline = m_SelectSubset.pipelineHandle->GetPtr();
 		drawSet.pDescriptorSet = m_pNativeDescriptorSet[SkeletalMesh::DST_COLOR];
 		drawSet.dynamicOffset = m_pUniformBuffer->GetNativeRangeSize() * frameIndex;
-		drawSet.pVertexBuffer = m_VertexBuffer.pResource;
-		drawSet.pIndexBuffer = m_IndexBuffer.pResource;
+		drawSet.pVertexBuffer = m_Geometry->vertexBuffer.pResource;
+		drawSet.pIndexBuffer = m_Geometry->indexBuffer.pResource;
 		drawSet.indexType = m_IndexType;
 		drawSet.indexCount = m_SelectSubset.indexCount;
 		drawSet.firstIndex = m_SelectSubset.firstIndex;
 	}
 
+	bool SkeletalMesh::Draw(
+		const Frustum& frustum,
+		uint32_t frameIndex,
+		collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
+		collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets)
+	{
+		// E̓V[ AABB c[Ŕ肳Ă
+		if (m_Visible == false)
+		{
+			return false;
+		}
+
+		ModelPtr model = m_OwnerModel.lock();
+		if (model == nullptr)
+		{
+			return false;
+		}
+
+		Draw(
+			frustum,
+			frameIndex,
+			static_cast<SkeletalModel*>(model.get())->GetDrawMaterials(),
+			opacityDrawSets,
+			transparencyDrawSets);
+
+		return true;
+	}
+
+	void SkeletalMesh::DrawShadow(
+		const Sphere& sphere,
+		uint32_t frameIndex,
+		collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
+		AABB& aabb)
+	{
+		// E̓V[ AABB c[Ŕ肳Ă
+		if ((m_Visible == false) || (m_CastShadow == false))
+		{
+			return;
+		}
+
+		ModelPtr model = m_OwnerModel.lock();
+		if (model == nullptr)
+		{
+			return;
+		}
+
+		// `ZbgW
+		DrawShadow(frameIndex, static_cast<SkeletalModel*>(model.get())->GetDrawMaterials(), shadowDrawSets);
+
+		// AABB 
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			if (aabb.minimum[i] > m_AABB.minimum[i]) { aabb.minimum[i] = m_AABB.minimum[i]; }
+			if (aabb.maximum[i] < m_AABB.maximum[i]) { aabb.maximum[i] = m_AABB.maximum[i]; }
+		}
+
+		aabb.center = (aabb.minimum + aabb.maximum) * 0.5f;
+	}
+
+	void SkeletalMesh::SetAabbTree(AabbTree* pAabbTree)
+	{
+		if (m_AabbTreeProxy != AabbTree::NULL_PROXY)
+		{
+			m_pAabbTree->Remove(m_AabbTreeProxy);
+			m_AabbTreeProxy = AabbTree::NULL_PROXY;
+		}
+
+		m_pAabbTree = pAabbTree;
+
+		// ܂E߂ĂȂꍇ́AUpdate œo^
+		if ((m_pAabbTree != nullptr) && (m_AABB.minimum.x <= m_AABB.maximum.x))
+		{
+			m_AabbTreeProxy = m_pAabbTree->Add(m_AABB.minimum, m_AABB.maximum, static_cast<NodeAttribute*>(this));
+		}
+	}
+
 	/**************************/
 	/* private - SkeletalMesh */
 	/**************************/
 
-	void SkeletalMesh::OptimizeVertexIndexData(
+	bool SkeletalMesh::OptimizeVertexIndexData(
 		LoggerPtr logger,
-		collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount,
+		const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+		const collection::Vector<IModelSource::Polygon>& polygons,
 		bool smoosingEnable, float smoosingCos,
 		int32_t lastID,
-		collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices)
+		collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices,
+		BackgroundJobHandlePtr handle)
 	{
 		// ----------------------------------------------------------------------------------------------------
-		// |SWJ
+		// }eA̒PʂŃTuZbgɕ
 		// ----------------------------------------------------------------------------------------------------
 
-		collection::Vector<IModelSource::Vertex> optVertices;
-		collection::Vector<SkeletalMesh::Optimize_Face> optFaces;
 		collection::Vector<SkeletalMesh::Optimize_Subset> optSubsets;
 
 		{
-			optVertices.resize(polygonCount * 3);
-			optFaces.resize(polygonCount);
-
-			IModelSource::Polygon* pPolygon = &polygons[firstPolygon];
-			IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+			const IModelSource::Polygon* pPolygon = polygons.data();
+			const IModelSource::Polygon* pPolygonEnd = pPolygon + polygons.size();
 
-			SkeletalMesh::Optimize_Subset dummySubset{};
-			dummySubset.materialIndex = ~0U;
-			dummySubset.firstIndex = 0;
-			dummySubset.indexCount = 0;
-			dummySubset.firstFace = 0;
-			dummySubset.faceCount = 0;
-
-			IModelSource::Vertex* pVertex = optVertices.data();
-			SkeletalMesh::Optimize_Face* pFace = optFaces.data();
-			SkeletalMesh::Optimize_Subset* pSubset = &dummySubset;
+			SkeletalMesh::Optimize_Subset* pSubset = nullptr;
+			uint32_t faceIndex = 0;
 
 			while (pPolygon != pPolygonEnd)
 			{
-				if (pSubset->materialIndex != pPolygon->materialIndex)
+				if ((pSubset == nullptr) || (pSubset->materialIndex != static_cast<uint32_t>(pPolygon->materialIndex)))
 				{
-					SkeletalMesh::Optimize_Subset preSubset = *pSubset;
-
 					optSubsets.push_back(SkeletalMesh::Optimize_Subset{});
 					pSubset = &optSubsets.back();
 
 					pSubset->materialIndex = pPolygon->materialIndex;
-					pSubset->firstIndex = preSubset.firstIndex + preSubset.indexCount;
-					pSubset->indexCount = 0;
-					pSubset->firstFace = preSubset.firstFace + preSubset.faceCount;
+					pSubset->firstFace = faceIndex;
 					pSubset->faceCount = 0;
 				}
 
-				*pVertex++ = pPolygon->vertices[0];
-				*pVertex++ = pPolygon->vertices[1];
-				*pVertex++ = pPolygon->vertices[2];
-
-				pFace->indices[0] = pSubset->indexCount++;
-				pFace->indices[1] = pSubset->indexCount++;
-				pFace->indices[2] = pSubset->indexCount++;
-				pFace++;
-
 				pSubset->faceCount++;
 
+				faceIndex++;
 				pPolygon++;
 			}
 		}
 
+		// ----------------------------------------------------------------------------------------------------
+		// TuZbgƂɒ_Ao[ebNXACfbNX̃Xg쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// \[X̒_̓CfbNXŎQƂ܂܌𒲂ׁARs[̂͌̒_ɂ
+
+		collection::Vector<uint32_t> localIndices(vertexCount, ~0U); // \[X̒_ ( firstVertex  ) TuZbg̒_ւ̃CfbNX
+		collection::Vector<uint32_t> localVertices; // TuZbg̒_QƂ\[X̒_̃CfbNX
+		collection::Vector<SkeletalMesh::Optimize_Face> optFaces;
+
+		collection::Vector<SkeletalMesh::Optimize_Key> keys;
+		collection::Vector<SkeletalMesh::Optimize_Group> groups;
+		collection::Vector<uint32_t> combineIndices; // TuZbg̒_猋_ւ̃CfbNX
+		collection::Vector<uint32_t> rootIndices; // ̋N_ɂȂTuZbg̒_猋_ւ̃CfbNX
+		collection::Vector<SkeletalMesh::Vertex> combineVertices;
+		collection::Vector<uint32_t> combineRemap;
+
+		std::vector<SkeletalMesh::Optimize_Index> indexOpts;
+		collection::Vector<uint32_t> subsetIndices;
+
+		uint32_t indexOffset = static_cast<uint32_t>(vertices.size());
+		uint32_t newIndex = 0;
+
+		uint32_t subseMax = static_cast<uint32_t>(optSubsets.size());
+		uint32_t subseCount = 1;
+
+		auto it_subset_begin = optSubsets.begin();
+		auto it_subset_end = optSubsets.end();
+
+		for (auto it_subset = it_subset_begin; it_subset != it_subset_end; ++it_subset)
 		{
-			SkeletalMesh::Optimize_Subset* pSubset = optSubsets.data();
-			SkeletalMesh::Optimize_Subset* pSubsetEnd = pSubset + optSubsets.size();
+			const SkeletalMesh::Optimize_Subset& subset = (*it_subset);
 
-			while (pSubset != pSubsetEnd)
+			if (handle->IsCancelRequested() == true)
 			{
-				pSubset->vertices.reserve(pSubset->indexCount);
-				pSubset->indices.reserve(pSubset->indexCount);
+				return false;
+			}
+
+			logger->PrintA(Logger::TYPE_INFO, "Optimize Mesh[%d/%d] : Subset[%u/%u] FaceCount[%u]", m_ID, lastID, subseCount, subseMax, subset.faceCount);
+
+			auto startClock = std::chrono::high_resolution_clock::now();
+
+			/********************************************************/
+			/* TuZbgQƂ\[X̒_ɃCfbNXU */
+			/********************************************************/
+
+			// TuZbg̒_͍ŏɎQƂꂽgCAȌԂɕ
 
-				for (uint32_t i = 0; i < pSubset->indexCount; i++)
+			localVertices.clear();
+			optFaces.resize(subset.faceCount);
+
+			{
+				const IModelSource::Polygon* pPolygon = polygons.data() + subset.firstFace;
+				const IModelSource::Polygon* pPolygonEnd = pPolygon + subset.faceCount;
+				SkeletalMesh::Optimize_Face* pFace = optFaces.data();
+
+				while (pPolygon != pPolygonEnd)
 				{
-					pSubset->vertices.push_back(optVertices[pSubset->firstIndex + i]);
-					pSubset->indices.push_back(i);
+					for (uint32_t i = 0; i < 3; i++)
+					{
+						uint32_t srcIndex = pPolygon->indices[i];
+						VE_ASSERT((firstVertex <= srcIndex) && (srcIndex < (firstVertex + vertexCount)));
+
+						uint32_t& localIndex = localIndices[srcIndex - firstVertex];
+						if (localIndex == ~0U)
+						{
+							localIndex = static_cast<uint32_t>(localVertices.size());
+							localVertices.push_back(srcIndex);
+						}
+
+						pFace->indices[i] = localIndex;
+					}
+
+					pFace++;
+					pPolygon++;
 				}
+			}
+
+			uint32_t localVertexCount = static_cast<uint32_t>(localVertices.size());
+
+			/******************************************************/
+			/* ʒu UV ̃nbVŃ\[gA܂Ƃ߂ */
+			/******************************************************/
 
-				pSubset++;
+			// ͈ʒu UV SɈv钸_Ɍ邽߁AnbV_𒲂ׂ΂悢
+			// nbV_̓CfbNX̏ɕԂ̂ŁǍʂ͑SĂ̒_𒲂ׂꍇƕςȂ
+
+			keys.resize(localVertexCount);
+			groups.resize(localVertexCount);
+
+			for (uint32_t i = 0; i < localVertexCount; i++)
+			{
+				keys[i].hash = SkeletalMesh::Optimize_GetHash(srcVertices[localVertices[i]]);
+				keys[i].index = i;
 			}
-		}
 
-		// ----------------------------------------------------------------------------------------------------
-		// \ȂΒ_AVCfbNXU
-		// ----------------------------------------------------------------------------------------------------
+			std::sort(keys.begin(), keys.end(), [](const SkeletalMesh::Optimize_Key& lhs, const SkeletalMesh::Optimize_Key& rhs)
+			{
+				return (lhs.hash != rhs.hash) ? (lhs.hash < rhs.hash) : (lhs.index < rhs.index);
+			});
 
-		{
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset_begin = optSubsets.begin();
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset_end = optSubsets.end();
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset;
+			for (uint32_t first = 0; first < localVertexCount;)
+			{
+				uint32_t last = first + 1;
+				while ((last < localVertexCount) && (keys[last].hash == keys[first].hash))
+				{
+					last++;
+				}
+
+				for (uint32_t i = first; i < last; i++)
+				{
+					groups[keys[i].index].first = first;
+					groups[keys[i].index].count = last - first;
+				}
+
+				first = last;
+			}
 
-			std::vector<IModelSource::Vertex*> combineVertices;
-			uint32_t subseMax = static_cast<uint32_t>(optSubsets.size());
-			uint32_t subseCount = 1;
+			/************/
+			/*  */
+			/************/
 
-			for (it_subset = it_subset_begin; it_subset != it_subset_end; ++it_subset)
+			// Ɍꂽ_ƂĒׁAvΌォ璲ׂ_̌Ɉp
+			// ̋N_ɂȂ_́A@Ȃǂ̂̂Ɣׂ
+
+			combineIndices.assign(localVertexCount, ~0U);
+			rootIndices.assign(localVertexCount, ~0U);
+			combineVertices.clear();
+
+			for (uint32_t i = 0; i < localVertexCount; i++)
 			{
-				SkeletalMesh::Optimize_Subset* pSubset = &(*it_subset);
-				size_t vertexCount = pSubset->vertices.size();
+				if (((i % SkeletalMesh::CANCEL_CHECK_INTERVAL) == 0) && (handle->IsCancelRequested() == true))
+				{
+					return false;
+				}
 
-				SkeletalMesh::Optimize_Face* pFace = optFaces.data() + pSubset->firstFace;
-				SkeletalMesh::Optimize_Face* pFaceEnd = pFace + pSubset->faceCount;
+				if (combineIndices[i] != ~0U)
+				{
+					// VCfbNXUĂ̂ŒׂȂ
+					continue;
+				}
 
-				logger->PrintA(Logger::TYPE_INFO, "Optimize Mesh[%d/%d] : Subset[%u/%u] FaceCount[%u]", m_ID, lastID, subseCount, subseMax, pSubset->faceCount);
+				uint32_t combineIndex = static_cast<uint32_t>(combineVertices.size());
+				const IModelSource::Vertex& srcVertex = srcVertices[localVertices[i]];
 
-				uint32_t combineVertexCount = 0;
+				glm::vec3 combineNormal = srcVertex.normal;
+				glm::vec3 combineTangent = srcVertex.tangent;
+				glm::vec3 combineBinormal = srcVertex.binormal;
+				uint32_t combineCount = 1;
 
-				while (pFace != pFaceEnd)
+				combineIndices[i] = combineIndex;
+
+				// ̒_T
+				const SkeletalMesh::Optimize_Group& group = groups[i];
+				const SkeletalMesh::Optimize_Key* pKey = keys.data() + group.first;
+				const SkeletalMesh::Optimize_Key* pKeyEnd = pKey + group.count;
+
+				for (; pKey != pKeyEnd; ++pKey)
 				{
-					uint32_t* pIndex = &pFace->indices[0];
-					uint32_t* pIndexEnd = pIndex + 3;
+					uint32_t j = pKey->index;
 
-					while (pIndex != pIndexEnd)
+					if (j == i)
 					{
-						if (pSubset->indices[*pIndex] != *pIndex)
-						{
-							// VCfbNXUĂ̂ŒׂȂ
-							pIndex++;
-							continue;
-						}
+						// 
+						continue;
+					}
 
-						uint32_t newIndex = static_cast<uint32_t>(pSubset->vertices.size());
-						IModelSource::Vertex* pSrcVertex = &(pSubset->vertices[*pIndex]);
+					const IModelSource::Vertex& dstVertex = srcVertices[localVertices[j]];
 
-						combineVertices.clear();
-						combineVertices.push_back(pSrcVertex);
+					if ((srcVertex.pos == dstVertex.pos) &&
+						(srcVertex.uv == dstVertex.uv))
+					{
+						const glm::vec3* pDstNormal = &dstVertex.normal;
+						const glm::vec3* pDstTangent = &dstVertex.tangent;
+						const glm::vec3* pDstBinormal = &dstVertex.binormal;
 
-						// ̒_T
-						for (size_t i = 0; i < vertexCount; i++)
+						if (rootIndices[j] != ~0U)
 						{
-							if (i == *pIndex)
-							{
-								// 
-								continue;
-							}
+							const SkeletalMesh::Vertex& rootVertex = combineVertices[rootIndices[j]];
+							pDstNormal = &rootVertex.normal;
+							pDstTangent = &rootVertex.tangent;
+							pDstBinormal = &rootVertex.binormal;
+						}
 
-							IModelSource::Vertex* pDstVertex = &(pSubset->vertices[i]);
+						bool combine;
 
-							if ((pSrcVertex->pos == pDstVertex->pos) &&
-								(pSrcVertex->uv == pDstVertex->uv))
-							{
-								if (smoosingEnable == true)
-								{
-									float normalCos = glm::dot(pSrcVertex->normal, pDstVertex->normal);
-
-									if (smoosingCos <= normalCos)
-									{
-										// ɐVKCfbNXUA钸_ǉ
-										pSubset->indices[i] = newIndex;
-										combineVertices.push_back(pDstVertex);
-									}
-								}
-								else
-								{
-									if (pSrcVertex->normal == pDstVertex->normal)
-									{
-										//ɐVKCfbNXUA钸_ǉ
-										pSubset->indices[i] = newIndex;
-										combineVertices.push_back(pDstVertex);
-									}
-								}
-							}
+						if (smoosingEnable == true)
+						{
+							combine = (smoosingCos <= glm::dot(srcVertex.normal, *pDstNormal));
 						}
-
-						if (combineVertices.size() > 1)
+						else
 						{
-							// Ƒ̂ꂩ̒_̌vĂ
-							IModelSource::Vertex** ppCombineVertex = combineVertices.data();
-
-							if (smoosingEnable == true)
-							{
-								size_t combineVertexCount = combineVertices.size();
-
-								IModelSource::Vertex** ppVertex = ppCombineVertex;
-								IModelSource::Vertex** ppVertexEnd = ppVertex + combineVertexCount;
-
-								glm::vec3 combineNormal = glm::vec3(0.0f);
-								glm::vec3 combineTangent = glm::vec3(0.0f);
-								glm::vec3 combineBinormal = glm::vec3(0.0f);
-
-								while (ppVertex != ppVertexEnd)
-								{
-									combineNormal += (*ppVertex)->normal;
-									combineTangent += (*ppVertex)->tangent;
-									combineBinormal += (*ppVertex)->binormal;
-									ppVertex++;
-								}
-
-								(*ppCombineVertex)->normal = glm::normalize(combineNormal);
-								(*ppCombineVertex)->tangent = glm::normalize(combineTangent);
-								(*ppCombineVertex)->binormal = glm::normalize(combineBinormal);
-							}
-
-							// ̐VKCfbNXU
-							pSubset->indices[*pIndex] = newIndex;
+							combine = (srcVertex.normal == *pDstNormal);
+						}
 
-							// _ǉ
-							pSubset->vertices.push_back(**ppCombineVertex);
+						if (combine == true)
+						{
+							// ɐVKCfbNXU ( ς݂̏ꍇ͈p )
+							combineIndices[j] = combineIndex;
 
-							combineVertexCount += static_cast<uint32_t>(combineVertices.size() - 1);
+							combineNormal += *pDstNormal;
+							combineTangent += *pDstTangent;
+							combineBinormal += *pDstBinormal;
+							combineCount++;
 						}
-
-						pIndex++;
 					}
-
-					pFace++;
 				}
 
-				uint32_t afterVertexCount = static_cast<uint32_t>(vertexCount) - combineVertexCount;
+				rootIndices[i] = combineIndex;
+
+				SkeletalMesh::Vertex dstVertex;
+				SkeletalMesh::Optimize_ToVertex(srcVertex, dstVertex);
 
-				logger->PrintA(Logger::TYPE_INFO, "  VertexCount[%u/%u]", afterVertexCount, vertexCount);
+				if ((smoosingEnable == true) && (combineCount > 1))
+				{
+					dstVertex.normal = glm::normalize(combineNormal);
+					dstVertex.tangent = glm::normalize(combineTangent);
+					dstVertex.binormal = glm::normalize(combineBinormal);
+				}
 
-				subseCount++;
+				combineVertices.push_back(dstVertex);
 			}
-		}
 
-		// ----------------------------------------------------------------------------------------------------
-		// o[ebNXACfbNX̃Xg쐬
-		// ----------------------------------------------------------------------------------------------------
+			// ׂĂ̒_𑼂̒_ɈpāAQƂȂȂ̒_菜
 
-		{
-			uint32_t newIndex = 0;
+			combineRemap.assign(combineVertices.size(), ~0U);
+
+			for (uint32_t i = 0; i < localVertexCount; i++)
+			{
+				combineRemap[combineIndices[i]] = 0;
+			}
 
-			std::vector<SkeletalMesh::Optimize_Index> indexOpts;
+			uint32_t combineVertexCount = 0;
 
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset_begin = optSubsets.begin();
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset_end = optSubsets.end();
-			std::vector<SkeletalMesh::Optimize_Subset>::iterator it_subset;
+			for (size_t i = 0; i < combineRemap.size(); i++)
+			{
+				if (combineRemap[i] != ~0U)
+				{
+					combineRemap[i] = combineVertexCount;
+					combineVertices[combineVertexCount] = combineVertices[i];
+					combineVertexCount++;
+				}
+			}
 
-			uint32_t indexOffset = static_cast<uint32_t>(vertices.size());
+			combineVertices.resize(combineVertexCount);
 
-			for (it_subset = it_subset_begin; it_subset != it_subset_end; ++it_subset)
+			for (uint32_t i = 0; i < localVertexCount; i++)
 			{
-				SkeletalMesh::Optimize_Subset* pSubset = &(*it_subset);
+				combineIndices[i] = combineRemap[combineIndices[i]];
+			}
 
-				indexOpts.clear();
-				indexOpts.resize(pSubset->vertices.size());
+			auto endClock = std::chrono::high_resolution_clock::now();
+			long long elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(endClock - startClock).count();
 
-				SkeletalMesh::Optimize_Face* pFace = optFaces.data() + pSubset->firstFace;
-				SkeletalMesh::Optimize_Face* pFaceEnd = pFace + pSubset->faceCount;
+			logger->PrintA(Logger::TYPE_INFO, "  VertexCount[%u/%u] Time[%lldms]", combineVertexCount, localVertexCount, elapsedTime);
 
-				uint32_t firstIndex = static_cast<uint32_t>(indices.size());
+			// ̃TuZbĝ߂ɃCfbNX߂Ă
+			{
+				auto it_begin = localVertices.begin();
+				auto it_end = localVertices.end();
 
-				while (pFace != pFaceEnd)
+				for (auto it = it_begin; it != it_end; ++it)
 				{
-					uint32_t* pIndex = &pFace->indices[0];
-					uint32_t* pIndexEnd = pIndex + 3;
+					localIndices[(*it) - firstVertex] = ~0U;
+				}
+			}
 
-					while (pIndex != pIndexEnd)
-					{
-						uint32_t oldIndex = pSubset->indices[*pIndex];
-						SkeletalMesh::Optimize_Index* pOptIndex = &indexOpts[oldIndex];
+			/****************************************************/
+			/* _LbVlăgCAOёւ */
+			/****************************************************/
 
-						if (pOptIndex->assigned == false)
-						{
-							const IModelSource::Vertex& srcVertex = pSubset->vertices[oldIndex];
-							SkeletalMesh::Vertex dstVertex;
-
-							dstVertex.pos = srcVertex.pos;
-							dstVertex.uv = srcVertex.uv;
-							dstVertex.normal = srcVertex.normal;
-							dstVertex.tangent = srcVertex.tangent;
-							dstVertex.binormal = srcVertex.binormal;
-							dstVertex.indices.x = srcVertex.indices[0];
-							dstVertex.indices.y = srcVertex.indices[1];
-							dstVertex.indices.z = srcVertex.indices[2];
-							dstVertex.indices.w = srcVertex.indices[3];
-							dstVertex.weights.x = srcVertex.weights[0];
-							dstVertex.weights.y = srcVertex.weights[1];
-							dstVertex.weights.z = srcVertex.weights[2];
-							dstVertex.weights.w = srcVertex.weights[3];
-
-							pOptIndex->index = newIndex;
-							pOptIndex->assigned = true;
-
-							vertices.push_back(dstVertex);
-							indices.push_back(indexOffset + newIndex);
-
-							newIndex++;
-						}
-						else
-						{
-							indices.push_back(indexOffset + pOptIndex->index);
-						}
+			if (handle->IsCancelRequested() == true)
+			{
+				return false;
+			}
 
-						pIndex++;
-					}
+			subsetIndices.clear();
+			subsetIndices.reserve(subset.faceCount * 3);
+
+			{
+				const SkeletalMesh::Optimize_Face* pFace = optFaces.data();
+				const SkeletalMesh::Optimize_Face* pFaceEnd = pFace + subset.faceCount;
 
+				while (pFace != pFaceEnd)
+				{
+					subsetIndices.push_back(combineIndices[pFace->indices[0]]);
+					subsetIndices.push_back(combineIndices[pFace->indices[1]]);
+					subsetIndices.push_back(combineIndices[pFace->indices[2]]);
 					pFace++;
 				}
+			}
 
-				m_ColorSubsets.push_back(SkeletalMesh::ColorSubset{});
+			uint32_t subsetIndexCount = static_cast<uint32_t>(subsetIndices.size());
+			float beforeACMR;
+			float beforeATVR;
+			float afterACMR;
+			float afterATVR;
+
+			startClock = std::chrono::high_resolution_clock::now();
+
+			MeshOptimizer::AnalyzeVertexCache(subsetIndices.data(), subsetIndexCount, combineVertexCount, beforeACMR, beforeATVR);
+			MeshOptimizer::OptimizeVertexCache(subsetIndices.data(), subsetIndexCount, combineVertexCount);
+			MeshOptimizer::AnalyzeVertexCache(subsetIndices.data(), subsetIndexCount, combineVertexCount, afterACMR, afterATVR);
+
+			endClock = std::chrono::high_resolution_clock::now();
+			elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(endClock - startClock).count();
+
+			logger->PrintA(Logger::TYPE_INFO, "Optimize Mesh[%d/%d] : Subset[%u/%u] ACMR[%.3f/%.3f] ATVR[%.3f/%.3f] Time[%lldms]", m_ID, lastID, subseCount, subseMax, afterACMR, beforeACMR, afterATVR, beforeATVR, elapsedTime);
+
+			/********************************************************/
+			/* _ŏɎgp鏇ԂɕׂăCfbNX쐬 */
+			/********************************************************/
 
-				SkeletalMesh::ColorSubset& dstSubset = m_ColorSubsets.back();
-				dstSubset.materialIndex = pSubset->materialIndex;
-				dstSubset.indexCount = static_cast<uint32_t>(indices.size()) - firstIndex;
-				dstSubset.firstIndex = firstIndex;
+			indexOpts.clear();
+			indexOpts.resize(combineVertexCount);
 
-				uint32_t debriPolygonCount = dstSubset.indexCount / 3;
-				dstSubset.debriPolygon.resize(debriPolygonCount);
+			uint32_t firstIndex = static_cast<uint32_t>(indices.size());
 
-				for (uint32_t i = 0; i < debriPolygonCount; i++)
+			{
+				uint32_t* pIndex = subsetIndices.data();
+				uint32_t* pIndexEnd = pIndex + subsetIndexCount;
+
+				while (pIndex != pIndexEnd)
 				{
-					SkeletalMesh::DebriPolygon& dstDebriPolygon = dstSubset.debriPolygon[i];
-					uint32_t baseIndex = dstSubset.firstIndex + i * 3;
+					uint32_t oldIndex = *pIndex;
+					SkeletalMesh::Optimize_Index* pOptIndex = &indexOpts[oldIndex];
 
-					for (uint32_t j = 0; j < 3; j++)
+					if (pOptIndex->assigned == false)
 					{
-						const SkeletalMesh::Vertex& srcVertex = vertices[indices[baseIndex + j]];
-						SkeletalMesh::DebriVertex& dstDebriVertex = dstDebriPolygon.vertices[j];
+						pOptIndex->index = newIndex;
+						pOptIndex->assigned = true;
 
-						dstDebriVertex.pos = glm::vec4(srcVertex.pos, 1.0f);
-						dstDebriVertex.worldMatrixIndex = srcVertex.indices[0];
-						dstDebriVertex.pWorldMatrix = &m_WorldMatrices[dstDebriVertex.worldMatrixIndex];
+						vertices.push_back(combineVertices[oldIndex]);
+						indices.push_back(indexOffset + newIndex);
+
+						newIndex++;
+					}
+					else
+					{
+						indices.push_back(indexOffset + pOptIndex->index);
 					}
+
+					pIndex++;
+				}
+			}
+
+			m_ColorSubsets.push_back(SkeletalMesh::ColorSubset{});
+
+			SkeletalMesh::ColorSubset& dstSubset = m_ColorSubsets.back();
+			dstSubset.materialIndex = subset.materialIndex;
+			dstSubset.indexCount = static_cast<uint32_t>(indices.size()) - firstIndex;
+			dstSubset.firstIndex = firstIndex;
+
+			uint32_t debriPolygonCount = dstSubset.indexCount / 3;
+			dstSubset.debriPolygon.resize(debriPolygonCount);
+
+			for (uint32_t i = 0; i < debriPolygonCount; i++)
+			{
+				SkeletalMesh::DebriPolygon& dstDebriPolygon = dstSubset.debriPolygon[i];
+				uint32_t baseIndex = dstSubset.firstIndex + i * 3;
+
+				for (uint32_t j = 0; j < 3; j++)
+				{
+					const SkeletalMesh::Vertex& srcVertex = vertices[indices[baseIndex + j]];
+					SkeletalMesh::DebriVertex& dstDebriVertex = dstDebriPolygon.vertices[j];
+
+					dstDebriVertex.pos = glm::vec4(srcVertex.pos, 1.0f);
+					dstDebriVertex.worldMatrixIndex = srcVertex.indices[0];
+					dstDebriVertex.pWorldMatrix = &m_WorldMatrices[dstDebriVertex.worldMatrixIndex];
 				}
 			}
+
+			handle->AddProgress(subset.faceCount);
+
+			subseCount++;
 		}
+
+		return true;
 	}
 
 	void SkeletalMesh::NotOptimizeVertexIndexData(
 		LoggerPtr logger,
-		collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount,
+		const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+		const collection::Vector<IModelSource::Polygon>& polygons,
 		int32_t lastID,
 		collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices)
 	{
-		const IModelSource::Polygon* pPolygon = &polygons[firstPolygon];
-		const IModelSource::Polygon* pPolygonEnd = pPolygon + polygonCount;
+		// \[X̒_ ( firstVertex  ) o[ebNXXgւ̃CfbNX
+		// o[ebNXXg̓TuZbg̏ԂɐLтĂ߁Ã݂TuZbg̐擪OwĂꍇ͖蓖ĂƂ݂Ȃ
+		collection::Vector<uint32_t> localIndices(vertexCount, ~0U);
+
+		const IModelSource::Polygon* pPolygon = polygons.data();
+		const IModelSource::Polygon* pPolygonEnd = pPolygon + polygons.size();
 
 		m_ColorSubsets.push_back(SkeletalMesh::ColorSubset{});
 
 		SkeletalMesh::ColorSubset* pColorSubset = &m_ColorSubsets.back();
 		pColorSubset->materialIndex = pPolygon->materialIndex;
-		pColorSubset->firstIndex = 0;
+		pColorSubset->firstIndex = static_cast<uint32_t>(indices.size());
 
-		uint32_t index = 0;
-
-		logger->PrintA(Logger::TYPE_INFO, "NotOptimize Mesh[%d/%d] : FaceCount[%u] VertexCount[%u]", m_ID, lastID, polygonCount, polygonCount * 3);
+		uint32_t subsetFirstVertex = static_cast<uint32_t>(vertices.size());
 
 		while (pPolygon != pPolygonEnd)
 		{
@@ -1647,52 +2879,454 @@ namespace ve {
 				newSubset.materialIndex = pPolygon->materialIndex;
 				newSubset.indexCount = 0;
 				newSubset.firstIndex = pColorSubset->firstIndex + pColorSubset->indexCount;
+				newSubset.clusterCount = 0;
+				newSubset.firstCluster = 0;
+				newSubset.lodCount = 0;
+				newSubset.firstLod = 0;
+				newSubset.transparency = false;
 
 				m_ColorSubsets.push_back(newSubset);
 				pColorSubset = &m_ColorSubsets.back();
+
+				subsetFirstVertex = static_cast<uint32_t>(vertices.size());
 			}
 
 			pColorSubset->indexCount += 3;
 
-			const IModelSource::Vertex* pSrcVertex = &pPolygon->vertices[0];
-			const IModelSource::Vertex* pSrcVertexEnd = pSrcVertex + 3;
-
 			pColorSubset->debriPolygon.push_back(SkeletalMesh::DebriPolygon{});
 			SkeletalMesh::DebriVertex* pDebriVertex = &(pColorSubset->debriPolygon.back().vertices[0]);
 
-			while (pSrcVertex != pSrcVertexEnd)
+			for (uint32_t i = 0; i < 3; i++)
 			{
-				SkeletalMesh::Vertex vertex;
+				uint32_t srcIndex = pPolygon->indices[i];
+				VE_ASSERT((firstVertex <= srcIndex) && (srcIndex < (firstVertex + vertexCount)));
 
-				vertex.pos = pSrcVertex->pos;
-				vertex.uv = pSrcVertex->uv;
-				vertex.normal = pSrcVertex->normal;
-				vertex.tangent = pSrcVertex->tangent;
-				vertex.binormal = pSrcVertex->binormal;
-				vertex.indices.x = pSrcVertex->indices[0];
-				vertex.indices.y = pSrcVertex->indices[1];
-				vertex.indices.z = pSrcVertex->indices[2];
-				vertex.indices.w = pSrcVertex->indices[3];
-				vertex.weights.x = pSrcVertex->weights[0];
-				vertex.weights.y = pSrcVertex->weights[1];
-				vertex.weights.z = pSrcVertex->weights[2];
-				vertex.weights.w = pSrcVertex->weights[3];
+				const IModelSource::Vertex& srcVertex = srcVertices[srcIndex];
+				uint32_t& localIndex = localIndices[srcIndex - firstVertex];
 
-				vertices.push_back(vertex);
+				if ((localIndex == ~0U) || (localIndex < subsetFirstVertex))
+				{
+					SkeletalMesh::Vertex vertex;
+					SkeletalMesh::Optimize_ToVertex(srcVertex, vertex);
+
+					localIndex = static_cast<uint32_t>(vertices.size());
+					vertices.push_back(vertex);
+				}
 
-				pDebriVertex->pos = glm::vec4(pSrcVertex->pos, 1.0f);
-				pDebriVertex->worldMatrixIndex = pSrcVertex->indices[0];
+				indices.push_back(localIndex);
+
+				pDebriVertex->pos = glm::vec4(srcVertex.pos, 1.0f);
+				pDebriVertex->worldMatrixIndex = srcVertex.indices[0];
 				pDebriVertex->pWorldMatrix = &m_WorldMatrices[pDebriVertex->worldMatrixIndex];
 
-				pSrcVertex++;
 				pDebriVertex++;
 			}
 
-			indices.push_back(index++);
-			indices.push_back(index++);
-			indices.push_back(index++);
-
 			pPolygon++;
 		}
+
+		logger->PrintA(Logger::TYPE_INFO, "NotOptimize Mesh[%d/%d] : FaceCount[%u] VertexCount[%u]", m_ID, lastID, static_cast<uint32_t>(polygons.size()), static_cast<uint32_t>(vertices.size()));
+	}
+
+	uint64_t SkeletalMesh::Optimize_GetHash(const IModelSource::Vertex& vertex)
+	{
+		// ̔Ɏgpʒu UV ݂̂nbV߂ ( FNV-1a )
+		// +0.0f  -0.0f ͓Ƃ݂Ȃ邽߁Arbg𑵂Ă
+
+		const float values[5] = { vertex.pos.x, vertex.pos.y, vertex.pos.z, vertex.uv.x, vertex.uv.y };
+
+		uint64_t hash = 14695981039346656037ULL;
+
+		for (uint32_t i = 0; i < 5; i++)
+		{
+			uint32_t bits = 0;
+
+			if (values[i] != 0.0f)
+			{
+				memcpy(&bits, &values[i], sizeof(uint32_t));
+			}
+
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				hash ^= (bits >> (j * 8)) & 0xFF;
+				hash *= 1099511628211ULL;
+			}
+		}
+
+		return hash;
 	}
+
+	void SkeletalMesh::Optimize_ToVertex(const IModelSource::Vertex& srcVertex, SkeletalMesh::Vertex& dstVertex)
+	{
+		dstVertex.pos = srcVertex.pos;
+		dstVertex.uv = srcVertex.uv;
+		dstVertex.normal = srcVertex.normal;
+		dstVertex.tangent = srcVertex.tangent;
+		dstVertex.binormal = srcVertex.binormal;
+		dstVertex.indices.x = srcVertex.indices[0];
+		dstVertex.indices.y = srcVertex.indices[1];
+		dstVertex.indices.z = srcVertex.indices[2];
+		dstVertex.indices.w = srcVertex.indices[3];
+		dstVertex.weights.x = srcVertex.weights[0];
+		dstVertex.weights.y = srcVertex.weights[1];
+		dstVertex.weights.z = srcVertex.weights[2];
+		dstVertex.weights.w = srcVertex.weights[3];
+	}
+
+	void SkeletalMesh::PackVertices(const collection::Vector<SkeletalMesh::Vertex>& srcVertices, collection::Vector<SkeletalMesh::PackedVertex>& dstVertices, MeshDequantizeUniform& dequantize)
+	{
+		dstVertices.clear();
+
+		if (srcVertices.empty() == true)
+		{
+			dequantize.positionScale = glm::vec4(1.0f);
+			dequantize.positionOffset = glm::vec4(0.0f);
+			return;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ʒu𐳋K͈͂߂
+		// ----------------------------------------------------------------------------------------------------
+
+		glm::vec3 minimum(+VE_FLOAT_MAX);
+		glm::vec3 maximum(-VE_FLOAT_MAX);
+
+		const SkeletalMesh::Vertex* pSrcVertex = srcVertices.data();
+		const SkeletalMesh::Vertex* pSrcVertexEnd = pSrcVertex + srcVertices.size();
+
+		while (pSrcVertex != pSrcVertexEnd)
+		{
+			minimum = glm::min(minimum, pSrcVertex->pos);
+			maximum = glm::max(maximum, pSrcVertex->pos);
+			pSrcVertex++;
+		}
+
+		glm::vec3 extent = maximum - minimum;
+		glm::vec3 invExtent;
+		invExtent.x = (extent.x > VE_FLOAT_EPSILON) ? (1.0f / extent.x) : 0.0f;
+		invExtent.y = (extent.y > VE_FLOAT_EPSILON) ? (1.0f / extent.y) : 0.0f;
+		invExtent.z = (extent.z > VE_FLOAT_EPSILON) ? (1.0f / extent.z) : 0.0f;
+
+		dequantize.positionScale = glm::vec4(extent, 0.0f);
+		dequantize.positionOffset = glm::vec4(minimum, 0.0f);
+
+		// ----------------------------------------------------------------------------------------------------
+		// ʎq
+		// ----------------------------------------------------------------------------------------------------
+
+		dstVertices.resize(srcVertices.size());
+
+		SkeletalMesh::PackedVertex* pDstVertex = dstVertices.data();
+
+		pSrcVertex = srcVertices.data();
+
+		while (pSrcVertex != pSrcVertexEnd)
+		{
+			/********/
+			/* ʒu */
+			/********/
+
+			glm::vec3 normalizedPos = glm::clamp((pSrcVertex->pos - minimum) * invExtent, 0.0f, 1.0f);
+
+			pDstVertex->pos[0] = static_cast<uint16_t>(normalizedPos.x * 65535.0f + 0.5f);
+			pDstVertex->pos[1] = static_cast<uint16_t>(normalizedPos.y * 65535.0f + 0.5f);
+			pDstVertex->pos[2] = static_cast<uint16_t>(normalizedPos.z * 65535.0f + 0.5f);
+
+			// oCm[}͖@Ɛڐ̊Oς畜邽߁AcĂ
+			pDstVertex->pos[3] = (glm::dot(glm::cross(pSrcVertex->normal, pSrcVertex->tangent), pSrcVertex->binormal) < 0.0f) ? 0 : 65535;
+
+			/******/
+			/* UV */
+			/******/
+
+			pDstVertex->uv[0] = glm::packHalf1x16(pSrcVertex->uv.x);
+			pDstVertex->uv[1] = glm::packHalf1x16(pSrcVertex->uv.y);
+
+			/**************/
+			/* @Aڐ */
+			/**************/
+
+			glm::vec2 normal = SkeletalMesh::EncodeOctahedron(pSrcVertex->normal);
+			glm::vec2 tangent = SkeletalMesh::EncodeOctahedron(pSrcVertex->tangent);
+
+			pDstVertex->tangentFrame[0] = static_cast<int16_t>(glm::packSnorm1x16(normal.x));
+			pDstVertex->tangentFrame[1] = static_cast<int16_t>(glm::packSnorm1x16(normal.y));
+			pDstVertex->tangentFrame[2] = static_cast<int16_t>(glm::packSnorm1x16(tangent.x));
+			pDstVertex->tangentFrame[3] = static_cast<int16_t>(glm::packSnorm1x16(tangent.y));
+
+			/********************/
+			/* {[̃EFCg */
+			/********************/
+
+			// v 255 ɂȂ悤ɁA덷ł傫EFCgɊ񂹂
+
+			uint32_t weightSum = 0;
+			uint32_t maxWeightIndex = 0;
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				VE_ASSERT((pSrcVertex->indices[i] >= 0) && (pSrcVertex->indices[i] < static_cast<int32_t>(SkeletalMesh::PACKED_VERTEX_MAX_BONE_COUNT)));
+
+				pDstVertex->indices[i] = static_cast<uint8_t>(pSrcVertex->indices[i]);
+				pDstVertex->weights[i] = static_cast<uint8_t>(glm::clamp(pSrcVertex->weights[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+
+				weightSum += pDstVertex->weights[i];
+
+				if (pDstVertex->weights[maxWeightIndex] < pDstVertex->weights[i])
+				{
+					maxWeightIndex = i;
+				}
+			}
+
+			if (weightSum > 0)
+			{
+				int32_t weight = static_cast<int32_t>(pDstVertex->weights[maxWeightIndex]) + (255 - static_cast<int32_t>(weightSum));
+				pDstVertex->weights[maxWeightIndex] = static_cast<uint8_t>(glm::clamp(weight, 0, 255));
+			}
+
+			pDstVertex++;
+			pSrcVertex++;
+		}
+	}
+
+	glm::vec2 SkeletalMesh::EncodeOctahedron(const glm::vec3& vector)
+	{
+		float length = fabs(vector.x) + fabs(vector.y) + fabs(vector.z);
+		if (length <= VE_FLOAT_EPSILON)
+		{
+			return glm::vec2(0.0f);
+		}
+
+		glm::vec3 n = vector / length;
+
+		if (n.z < 0.0f)
+		{
+			return glm::vec2(
+				(1.0f - fabs(n.y)) * ((n.x >= 0.0f) ? 1.0f : -1.0f),
+				(1.0f - fabs(n.x)) * ((n.y >= 0.0f) ? 1.0f : -1.0f));
+		}
+
+		return glm::vec2(n.x, n.y);
+	}
+
+	glm::vec3 SkeletalMesh::DecodeOctahedron(const glm::vec2& value)
+	{
+		glm::vec3 v(value.x, value.y, 1.0f - fabs(value.x) - fabs(value.y));
+
+		if (v.z < 0.0f)
+		{
+			float x = v.x;
+			v.x = (1.0f - fabs(v.y)) * ((x >= 0.0f) ? 1.0f : -1.0f);
+			v.y = (1.0f - fabs(x)) * ((v.y >= 0.0f) ? 1.0f : -1.0f);
+		}
+
+		return glm::normalize(v);
+	}
+
+	uint32_t SkeletalMesh::GetDominantBoneIndex(const glm::ivec4& indices, const glm::vec4& weights)
+	{
+		uint32_t dominant = 0;
+
+		for (uint32_t i = 1; i < 4; i++)
+		{
+			if (weights[dominant] < weights[i])
+			{
+				dominant = i;
+			}
+		}
+
+		return static_cast<uint32_t>(indices[dominant]);
+	}
+
+	uint32_t SkeletalMesh::GetVertexStride() const
+	{
+		return (m_VertexFormat == SkeletalMesh::VERTEX_FORMAT_PACKED) ? static_cast<uint32_t>(sizeof(SkeletalMesh::PackedVertex)) : static_cast<uint32_t>(sizeof(SkeletalMesh::Vertex));
+	}
+
+	void SkeletalMesh::BuildClusters(const glm::vec3* pPositions, const glm::vec3* pNormals, uint32_t vertexCount, const uint32_t* pIndices)
+	{
+		m_Clusters.clear();
+
+		float frontFaceSign = MeshOptimizer::GetFrontFaceSign(pPositions, pNormals, pIndices, m_SelectSubset.firstIndex + m_SelectSubset.indexCount);
+
+		auto it_begin = m_ColorSubsets.begin();
+		auto it_end = m_ColorSubsets.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			SkeletalMesh::ColorSubset& subset = (*it);
+
+			subset.firstCluster = static_cast<uint32_t>(m_Clusters.size());
+
+			MeshOptimizer::BuildClusters(
+				pPositions, vertexCount,
+				&pIndices[subset.firstIndex], subset.firstIndex, subset.indexCount,
+				frontFaceSign,
+				m_Clusters);
+
+			subset.clusterCount = static_cast<uint32_t>(m_Clusters.size()) - subset.firstCluster;
+		}
+	}
+
+	void SkeletalMesh::BuildLods(const glm::vec3* pPositions, const uint32_t* pBoneIndices, uint32_t vertexCount, collection::Vector<uint32_t>& indices)
+	{
+		m_Lods.clear();
+
+		collection::Vector<uint32_t> srcIndices;
+		collection::Vector<uint32_t> dstIndices;
+
+		auto it_begin = m_ColorSubsets.begin();
+		auto it_end = m_ColorSubsets.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			SkeletalMesh::ColorSubset& subset = (*it);
+
+			subset.firstLod = static_cast<uint32_t>(m_Lods.size());
+			subset.lodCount = 0;
+
+			if ((subset.indexCount / 3) < SkeletalMesh::LOD_MIN_TRIANGLE_COUNT)
+			{
+				continue;
+			}
+
+			// O LOD ȗāAgCAO̐𔼕ɂĂ
+			// 덷͈O LOD ̂̂Ȃ̂ŁAݐςČ̃bV̌덷ɂ
+
+			srcIndices.assign(indices.begin() + subset.firstIndex, indices.begin() + subset.firstIndex + subset.indexCount);
+
+			float error = 0.0f;
+
+			for (uint32_t i = 0; i < SkeletalMesh::LOD_MAX_COUNT; i++)
+			{
+				uint32_t srcIndexCount = static_cast<uint32_t>(srcIndices.size());
+				uint32_t targetIndexCount = (srcIndexCount / 6) * 3;
+
+				dstIndices.resize(srcIndexCount);
+
+				float lodError;
+				uint32_t dstIndexCount = MeshOptimizer::Simplify(
+					pPositions, (m_WorldMatrices.size() > 1) ? pBoneIndices : nullptr, vertexCount,
+					srcIndices.data(), srcIndexCount,
+					targetIndexCount,
+					dstIndices.data(), lodError);
+
+				// pڂȂǂłقƂǌ点ȂȂł؂
+				if ((dstIndexCount == 0) || (dstIndexCount > (srcIndexCount / 10) * 9))
+				{
+					break;
+				}
+
+				dstIndices.resize(dstIndexCount);
+				MeshOptimizer::OptimizeVertexCache(dstIndices.data(), dstIndexCount, vertexCount);
+
+				error += lodError;
+
+				MeshOptimizer::Lod lod;
+				lod.indexCount = dstIndexCount;
+				lod.firstIndex = static_cast<uint32_t>(indices.size());
+				lod.error = error;
+				m_Lods.push_back(lod);
+
+				indices.insert(indices.end(), dstIndices.begin(), dstIndices.end());
+
+				srcIndices.swap(dstIndices);
+			}
+
+			subset.lodCount = static_cast<uint32_t>(m_Lods.size()) - subset.firstLod;
+		}
+	}
+
+	const MeshOptimizer::Lod* SkeletalMesh::SelectLod(const SkeletalMesh::ColorSubset* pSubset, float lodErrorScale) const
+	{
+		if ((pSubset->lodCount == 0) || (lodErrorScale <= 0.0f))
+		{
+			return nullptr;
+		}
+
+		// 덷XN[ŋe͈͂Ɏ܂Ałe LOD I
+		const MeshOptimizer::Lod* pLod = &m_Lods[pSubset->firstLod];
+		const MeshOptimizer::Lod* pLodEnd = pLod + pSubset->lodCount;
+		const MeshOptimizer::Lod* pSelectLod = nullptr;
+
+		while ((pLod != pLodEnd) && ((pLod->error * lodErrorScale) <= SkeletalMesh::LOD_PIXEL_ERROR))
+		{
+			pSelectLod = pLod;
+			pLod++;
+		}
+
+		return pSelectLod;
+	}
+
+	void SkeletalMesh::KeepTransparencyIndices(const void* pIndices)
+	{
+		size_t indexSize = (m_IndexType == V3D_INDEX_TYPE_UINT16) ? sizeof(uint16_t) : sizeof(uint32_t);
+		const uint8_t* pSrcIndices = static_cast<const uint8_t*>(pIndices);
+
+		m_Geometry->transparencyIndices.assign(pSrcIndices, pSrcIndices + indexSize * m_SelectSubset.indexCount);
+	}
+
+	void SkeletalMesh::UpdateTransparencyIndexBuffer()
+	{
+		if (m_Geometry->transparencyIndices.empty() == true)
+		{
+			return;
+		}
+
+		uint32_t indexCount = 0;
+
+		auto it_begin = m_ColorSubsets.begin();
+		auto it_end = m_ColorSubsets.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			if (it->transparency == true)
+			{
+				indexCount += it->indexCount;
+			}
+		}
+
+		// ȂȂƂ쐬Ȃ ( Âobt@[͕`悵IĂj )
+		if (indexCount <= m_TransparencyIndexCapacity)
+		{
+			return;
+		}
+
+		if (m_pTransparencyIndexBuffer != nullptr)
+		{
+			m_pTransparencyIndexBuffer->Destroy();
+			m_pTransparencyIndexBuffer = nullptr;
+			m_TransparencyIndexCapacity = 0;
+		}
+
+		const wchar_t* pDebugName = nullptr;
+		VE_DEBUG_CODE(StringW debugName = StringW(L"SkeletalMesh_TransparencyIndex_") + std::to_wstring(m_ID));
+		VE_DEBUG_CODE(pDebugName = debugName.c_str());
+
+		uint64_t indexSize = (m_IndexType == V3D_INDEX_TYPE_UINT16) ? sizeof(uint16_t) : sizeof(uint32_t);
+
+		m_pTransparencyIndexBuffer = DynamicBuffer::Create(m_DeviceContext, V3D_BUFFER_USAGE_INDEX, indexSize * indexCount, V3D_PIPELINE_STAGE_VERTEX_INPUT, V3D_ACCESS_INDEX_READ, pDebugName);
+		if (m_pTransparencyIndexBuffer != nullptr)
+		{
+			m_TransparencyIndexCapacity = indexCount;
+		}
+	}
+
+	/************************************/
+	/* private - SkeletalMesh::Geometry */
+	/************************************/
+
+	SkeletalMesh::Geometry::Geometry(DeviceContextPtr deviceContext) :
+		deviceContext(deviceContext),
+		vertexBuffer({}),
+		indexBuffer({})
+	{
+	}
+
+	SkeletalMesh::Geometry::~Geometry()
+	{
+		DeleteResource(deviceContext->GetDeletingQueuePtr(), &vertexBuffer.pResource, &vertexBuffer.resourceAllocation);
+		DeleteResource(deviceContext->GetDeletingQueuePtr(), &indexBuffer.pResource, &indexBuffer.resourceAllocation);
+	}
+
 }
\ No newline at end of file
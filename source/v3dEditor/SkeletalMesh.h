@@ -3,6 +3,7 @@
 #include "IMesh.h"
 #include "IModelSource.h"
 #include "GraphicsFactory.h"
+#include "MeshOptimizer.h"
 #include "DynamicContainer.h"
 #include "Plane.h"
 #include "Node.h"
@@ -13,6 +14,7 @@ namespace ve {
 	class Node;
 	class Material;
 	class DebugRenderer;
+	class AabbTree;
 
 	class SkeletalMesh final : public IMesh
 	{
@@ -28,7 +30,20 @@ namespace ve {
 			glm::vec4 weights;
 		};
 
+		// ʎqo[ebNX ( 28Byte )
+		struct PackedVertex
+		{
+			uint16_t pos[4]; // xyz : bV͈̔͂ŐKʒu ( unorm16 ) w : oCm[}̌ ( 0 or 65535 )
+			uint16_t uv[2]; // half
+			int16_t tangentFrame[4]; // xy : @ zw : ڐ ( IN^wh snorm16 )
+			uint8_t indices[4];
+			uint8_t weights[4]; // unorm8
+		};
+
 		static SkeletalMeshPtr Create(DeviceContextPtr deviceContext, int32_t id);
+		// source ƃWIg ( o[ebNXobt@[ACfbNXobt@[ ) L郁bV쐬
+		// {[ pModel ̃m[hQƂAjtH[obt@[AAABB ̓bVƂɎ
+		static SkeletalMeshPtr CreateInstance(SkeletalMeshPtr source, IModel* pModel);
 
 		SkeletalMesh();
 		virtual ~SkeletalMesh();
@@ -40,7 +55,19 @@ namespace ve {
 
 		bool Preparation(size_t boneCount);
 		void AssignMaterials(const collection::Vector<int32_t>& materialIndices);
-		bool BuildVertexIndexData(LoggerPtr logger, collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount, const ModelRendererConfig& config, int32_t id, int32_t lastID);
+		// ʂ̃bVƂ͕Ɏsł ( foCXɂ͐GȂ )
+		// 쐬|S̐iɉALZꂽꍇ͓r false Ԃ
+		bool BuildVertexIndexData(
+			LoggerPtr logger,
+			const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+			const collection::Vector<IModelSource::Polygon>& srcPolygons, uint32_t firstPolygon, uint32_t polygonCount,
+			const ModelRendererConfig& config,
+			int32_t id, int32_t lastID,
+			BackgroundJobHandlePtr handle);
+		// BuildVertexIndexData ō쐬Xgobt@[ɃAbv[h
+		bool UploadVertexIndexData();
+		// BuildVertexIndexData  UploadVertexIndexData ܂łɊmۂ郁̌ς ( oCg )
+		static uint64_t EstimateBuildMemorySize(uint32_t vertexCount, uint32_t polygonCount, const ModelRendererConfig& config);
 		void AddShape(const glm::vec3& center, const glm::vec3& xAxis, const glm::vec3& yAxis, const glm::vec3& zAxis, const glm::vec3& halfExtent);
 		void AddBone(NodePtr node, const glm::mat4& offsetMatrix);
 
@@ -50,7 +77,7 @@ namespace ve {
 		void SetOwnerModel(ModelPtr model);
 
 		void Draw(
-			const Plane& nearPlane,
+			const Frustum& frustum,
 			uint32_t frameIndex,
 			collection::Vector<MaterialPtr>& materials,
 			collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
@@ -75,6 +102,8 @@ namespace ve {
 
 		uint32_t GetPolygonCount() const override;
 		uint32_t GetBoneCount() const override;
+		float GetACMR() const override;
+		float GetATVR() const override;
 		uint32_t GetMaterialCount() const override;
 		MaterialPtr GetMaterial(uint32_t materialIndex) override;
 		const AABB& GetAABB() const override;
@@ -106,11 +135,49 @@ namespace ve {
 		void SetSelectKey(uint32_t key) override;
 		void DrawSelect(uint32_t frameIndex, SelectDrawSet& drawSet) override;
 
+		// V[ AABB c[ŋEƔ肳ꂽƂɁA`ZbgW
+		bool Draw(
+			const Frustum& frustum,
+			uint32_t frameIndex,
+			collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
+			collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets) override;
+
+		void DrawShadow(
+			const Sphere& sphere,
+			uint32_t frameIndex,
+			collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
+			AABB& aabb) override;
+
+		void SetAabbTree(AabbTree* pAabbTree) override;
+
 	private:
 		// ----------------------------------------------------------------------------------------------------
 
 		static constexpr uint32_t OLD_VERSION_1_0_0_0 = 0x01000000;
-		static constexpr uint32_t CURRENT_VERSION = 0x01010000;
+		static constexpr uint32_t OLD_VERSION_1_1_0_0 = 0x01010000;
+		static constexpr uint32_t OLD_VERSION_1_2_0_0 = 0x01020000;
+		static constexpr uint32_t OLD_VERSION_1_3_0_0 = 0x01030000;
+		static constexpr uint32_t OLD_VERSION_1_4_0_0 = 0x01040000;
+		static constexpr uint32_t CURRENT_VERSION = 0x01050000;
+
+		// ʎqo[ebNXň{[̍ő吔 ( CfbNX uint8_t )
+		static constexpr size_t PACKED_VERTEX_MAX_BONE_COUNT = 256;
+
+		// TuZbgƂɍ쐬 LOD ̍ő吔 ( LOD 0 ͊܂܂Ȃ )
+		static constexpr uint32_t LOD_MAX_COUNT = 3;
+		// LOD 쐬TuZbg̃gCAO̍ŏ
+		static constexpr uint32_t LOD_MIN_TRIANGLE_COUNT = 64;
+		// LOD IƂɋeXN[̌덷 ( sNZ )
+		static constexpr float LOD_PIXEL_ERROR = 1.0f;
+
+		// _ƂɃLZ𒲂ׂԊu ( _̐ )
+		static constexpr uint32_t CANCEL_CHECK_INTERVAL = 65536;
+
+		enum VERTEX_FORMAT
+		{
+			VERTEX_FORMAT_DEFAULT = 0, // SkeletalMesh::Vertex
+			VERTEX_FORMAT_PACKED = 1, // SkeletalMesh::PackedVertex
+		};
 
 		enum File_INFO_FLAGS
 		{
@@ -139,6 +206,75 @@ namespace ve {
 			uint32_t indexType;
 		};
 
+		struct File_InfoHeader_1_1_0_0
+		{
+			uint32_t flags;
+			uint32_t polygonCount;
+			uint32_t materialCount;
+			uint32_t debriVertexCount;
+			uint32_t colorSubsetCount;
+			uint32_t boneCount;
+			uint32_t shapeCount;
+			uint64_t vertexBufferSize;
+			uint64_t indexBufferSize;
+			uint32_t indexType;
+		};
+
+		struct File_InfoHeader_1_2_0_0
+		{
+			uint32_t flags;
+			uint32_t polygonCount;
+			uint32_t materialCount;
+			uint32_t debriVertexCount;
+			uint32_t colorSubsetCount;
+			uint32_t boneCount;
+			uint32_t shapeCount;
+			uint64_t vertexBufferSize;
+			uint64_t indexBufferSize;
+			uint32_t indexType;
+			float acmr;
+			float atvr;
+		};
+
+		struct File_InfoHeader_1_3_0_0
+		{
+			uint32_t flags;
+			uint32_t polygonCount;
+			uint32_t materialCount;
+			uint32_t debriVertexCount;
+			uint32_t colorSubsetCount;
+			uint32_t boneCount;
+			uint32_t shapeCount;
+			uint64_t vertexBufferSize;
+			uint64_t indexBufferSize;
+			uint32_t indexType;
+			float acmr;
+			float atvr;
+			uint32_t vertexFormat;
+			float positionScale[4];
+			float positionOffset[4];
+		};
+
+		struct File_InfoHeader_1_4_0_0
+		{
+			uint32_t flags;
+			uint32_t polygonCount;
+			uint32_t materialCount;
+			uint32_t debriVertexCount;
+			uint32_t colorSubsetCount;
+			uint32_t clusterCount;
+			uint32_t boneCount;
+			uint32_t shapeCount;
+			uint64_t vertexBufferSize;
+			uint64_t indexBufferSize;
+			uint32_t indexType;
+			float acmr;
+			float atvr;
+			uint32_t vertexFormat;
+			float positionScale[4];
+			float positionOffset[4];
+		};
+
 		struct File_InfoHeader
 		{
 			uint32_t flags;
@@ -146,11 +282,18 @@ namespace ve {
 			uint32_t materialCount;
 			uint32_t debriVertexCount;
 			uint32_t colorSubsetCount;
+			uint32_t clusterCount;
+			uint32_t lodCount;
 			uint32_t boneCount;
 			uint32_t shapeCount;
 			uint64_t vertexBufferSize;
 			uint64_t indexBufferSize;
 			uint32_t indexType;
+			float acmr;
+			float atvr;
+			uint32_t vertexFormat;
+			float positionScale[4];
+			float positionOffset[4];
 		};
 
 		struct File_DebriVertex
@@ -159,6 +302,26 @@ namespace ve {
 			uint32_t worldMatrixIndex;
 		};
 
+		struct File_ColorSubset_1_3_0_0
+		{
+			uint32_t materialIndex;
+			uint32_t debriVertexCount;
+			uint32_t firstDebriVertex;
+			uint32_t indexCount;
+			uint32_t firstIndex;
+		};
+
+		struct File_ColorSubset_1_4_0_0
+		{
+			uint32_t materialIndex;
+			uint32_t debriVertexCount;
+			uint32_t firstDebriVertex;
+			uint32_t indexCount;
+			uint32_t firstIndex;
+			uint32_t clusterCount;
+			uint32_t firstCluster;
+		};
+
 		struct File_ColorSubset
 		{
 			uint32_t materialIndex;
@@ -166,6 +329,25 @@ namespace ve {
 			uint32_t firstDebriVertex;
 			uint32_t indexCount;
 			uint32_t firstIndex;
+			uint32_t clusterCount;
+			uint32_t firstCluster;
+			uint32_t lodCount;
+			uint32_t firstLod;
+		};
+
+		struct File_Cluster
+		{
+			float sphere[4]; // xyz : center w : radius
+			float cone[4]; // xyz : axis w : cutoff
+			uint32_t indexCount;
+			uint32_t firstIndex;
+		};
+
+		struct File_Lod
+		{
+			uint32_t indexCount;
+			uint32_t firstIndex;
+			float error;
 		};
 
 		struct File_SelectSubset
@@ -200,13 +382,8 @@ namespace ve {
 		{
 			uint32_t materialIndex;
 
-			uint32_t firstIndex;
-			uint32_t indexCount;
-
 			uint32_t firstFace;
 			uint32_t faceCount;
-			std::vector<IModelSource::Vertex> vertices;
-			std::vector<uint32_t> indices;
 		};
 
 		struct Optimize_Index
@@ -215,6 +392,18 @@ namespace ve {
 			bool assigned;
 		};
 
+		struct Optimize_Key
+		{
+			uint64_t hash;
+			uint32_t index;
+		};
+
+		struct Optimize_Group
+		{
+			uint32_t first;
+			uint32_t count;
+		};
+
 		// ----------------------------------------------------------------------------------------------------
 
 		enum DESCRIPTOR_SET_TYPE
@@ -242,13 +431,30 @@ namespace ve {
 
 			PipelineHandlePtr pipelineHandle;
 			PipelineHandlePtr shadowPipelineHandle;
+			PipelineHandlePtr instancingPipelineHandle; // {[̖sȃTuZbĝ ( ȊO nullptr )
 
 			uint32_t indexCount;
 			uint32_t firstIndex;
 
+			uint32_t clusterCount;
+			uint32_t firstCluster;
+
+			uint32_t lodCount;
+			uint32_t firstLod;
+
+			bool transparency; // UpdatePipeline Őݒ肷 ( ̃CfbNXobt@[̃TCY߂邽 )
+
 			collection::Vector<DebriPolygon> debriPolygon;
 		};
 
+		// ̃\[gŎgp|S
+		struct TransparencyPolygon
+		{
+			float sortKey;
+			uint32_t subsetIndex;
+			uint32_t firstIndex; // Geometry::transparencyIndices QƂŏ̃CfbNX
+		};
+
 		struct SelectSubset
 		{
 			PipelineHandlePtr pipelineHandle;
@@ -270,6 +476,20 @@ namespace ve {
 			glm::vec3 halfExtent;
 		};
 
+		// CX^XԂŋLWIg ( QƂĂ郁bVׂĔjꂽƂɍ폜 )
+		struct Geometry
+		{
+			DeviceContextPtr deviceContext;
+			Buffer vertexBuffer;
+			Buffer indexBuffer;
+
+			// ̃|St[ƂɃ\[gďނ߂̂ ( bṼCfbNX̌^ŁAׂẴTuZbg LOD 0 ͈̔͂̃Rs[ )
+			collection::Vector<uint8_t> transparencyIndices;
+
+			Geometry(DeviceContextPtr deviceContext);
+			~Geometry();
+		};
+
 		// ----------------------------------------------------------------------------------------------------
 
 		DeviceContextPtr m_DeviceContext;
@@ -277,46 +497,99 @@ namespace ve {
 		int32_t m_ID;
 
 		MeshUniform m_Uniform;
+		MeshDequantizeUniform m_DequantizeUniform;
 		DynamicBuffer* m_pUniformBuffer;
+		size_t m_UniformMatrixCount;
 		IV3DDescriptorSet* m_pNativeDescriptorSet[2];
 
-		uint64_t m_VertexBufferSize;
-		Buffer m_VertexBuffer;
+		SharedPtr<SkeletalMesh::Geometry> m_Geometry;
 
+		SkeletalMesh::VERTEX_FORMAT m_VertexFormat;
+		uint64_t m_VertexBufferSize;
 		uint64_t m_IndexBufferSize;
-		Buffer m_IndexBuffer;
 		V3D_INDEX_TYPE m_IndexType;
 
 		uint32_t m_PolygonCount;
+		float m_ACMR;
+		float m_ATVR;
 		collection::Vector<SkeletalMesh::ColorSubset> m_ColorSubsets;
+		collection::Vector<MeshOptimizer::Cluster> m_Clusters;
+		collection::Vector<MeshOptimizer::Lod> m_Lods;
 		SkeletalMesh::SelectSubset m_SelectSubset;
 
 		collection::Vector<uint32_t> m_MaterialIndices;
 
+		collection::Vector<SkeletalMesh::Vertex> m_BuildVertices;
+		collection::Vector<SkeletalMesh::PackedVertex> m_BuildPackedVertices;
+		collection::Vector<uint32_t> m_BuildIndices;
+
+		// ̃|St[ƂɃ\[gďނ߂̂
+		collection::Vector<SkeletalMesh::TransparencyPolygon> m_TransparencyPolygons;
+		DynamicBuffer* m_pTransparencyIndexBuffer;
+		uint32_t m_TransparencyIndexCapacity;
+
 		collection::Vector<SkeletalMesh::Bone> m_Bones;
 		collection::Vector<SkeletalMesh::Shape> m_Shapes;
 		collection::Vector<glm::mat4> m_WorldMatrices;
 
 		AABB m_AABB;
 
+		// Update ŋE߂邽тɍXV
+		AabbTree* m_pAabbTree;
+		int32_t m_AabbTreeProxy;
+
 		bool m_Visible;
 		bool m_CastShadow;
 
 		// ----------------------------------------------------------------------------------------------------
 
-		void OptimizeVertexIndexData(
+		bool OptimizeVertexIndexData(
 			LoggerPtr logger,
-			collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount,
+			const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+			const collection::Vector<IModelSource::Polygon>& polygons,
 			bool smoosingEnable, float smoosingCos,
 			int32_t lastID,
-			collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices);
+			collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices,
+			BackgroundJobHandlePtr handle);
 
 		void NotOptimizeVertexIndexData(
 			LoggerPtr logger,
-			collection::Vector<IModelSource::Polygon>& polygons, uint32_t firstPolygon, uint32_t polygonCount,
+			const collection::Vector<IModelSource::Vertex>& srcVertices, uint32_t firstVertex, uint32_t vertexCount,
+			const collection::Vector<IModelSource::Polygon>& polygons,
 			int32_t lastID,
 			collection::Vector<SkeletalMesh::Vertex>& vertices, collection::Vector<uint32_t>& indices);
 
+		static uint64_t Optimize_GetHash(const IModelSource::Vertex& vertex);
+		static void Optimize_ToVertex(const IModelSource::Vertex& srcVertex, SkeletalMesh::Vertex& dstVertex);
+
+		static void PackVertices(const collection::Vector<SkeletalMesh::Vertex>& srcVertices, collection::Vector<SkeletalMesh::PackedVertex>& dstVertices, MeshDequantizeUniform& dequantize);
+		static glm::vec2 EncodeOctahedron(const glm::vec3& vector);
+		static glm::vec3 DecodeOctahedron(const glm::vec2& value);
+		static uint32_t GetDominantBoneIndex(const glm::ivec4& indices, const glm::vec4& weights);
+
+		uint32_t GetVertexStride() const;
+
+		void BuildClusters(const glm::vec3* pPositions, const glm::vec3* pNormals, uint32_t vertexCount, const uint32_t* pIndices);
+		// 쐬 LOD ̃CfbNX indices ̌ɒǉ
+		void BuildLods(const glm::vec3* pPositions, const uint32_t* pBoneIndices, uint32_t vertexCount, collection::Vector<uint32_t>& indices);
+		const MeshOptimizer::Lod* SelectLod(const SkeletalMesh::ColorSubset* pSubset, float lodErrorScale) const;
+
+		// pIndices ̓bṼCfbNX̌^ŁALOD 0 ͈̔͂܂ނ
+		void KeepTransparencyIndices(const void* pIndices);
+		void UpdateTransparencyIndexBuffer();
+
+		void AddOpacityDrawSet(
+			const SkeletalMesh::ColorSubset* pSubset, Material* pMaterial,
+			uint32_t frameIndex,
+			uint32_t firstIndex, uint32_t indexCount,
+			collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets);
+
+		void DrawTransparency(
+			const Plane& nearPlane,
+			uint32_t frameIndex,
+			collection::Vector<MaterialPtr>& materials,
+			collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets);
+
 		static inline void UpdateAABB(const SkeletalMesh::Shape* pShape, const glm::mat4& worldMatrix, AABB& aabb)
 		{
 			glm::mat3 normalMatrix = worldMatrix;
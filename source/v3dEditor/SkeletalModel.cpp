@@ -8,9 +8,14 @@
 #include "DynamicBuffer.h"
 #include "Node.h"
 #include "Texture.h"
+#include "TextureLoader.h"
 #include "Material.h"
 #include "SkeletalMesh.h"
 #include "IModelSource.h"
+#include "BackgroundQueue.h"
+#include "ParallelTask.h"
+#include <mutex>
+#include <condition_variable>
 
 namespace ve {
 
@@ -26,27 +31,94 @@ namespace ve {
 		return std::move(modelRenderer);
 	}
 
-	SkeletalModel::SkeletalModel() :
-		m_PolygonCount(0)
+	SkeletalModelPtr SkeletalModel::CreateInstance(LoggerPtr logger, SkeletalModelPtr source)
 	{
-	}
+		SkeletalModelPtr model = SkeletalModel::Create(source->m_DeviceContext);
 
-	SkeletalModel::~SkeletalModel()
-	{
-		if(m_Meshes.empty() == false)
+		model->m_FilePath = source->m_FilePath;
+
+		// ----------------------------------------------------------------------------------------------------
+		// m[h𕡐 ( ID ̓m[h̃CfbNX )
+		// ----------------------------------------------------------------------------------------------------
+
+		model->m_Nodes.reserve(source->m_Nodes.size());
+
+		auto it_node_begin = source->m_Nodes.begin();
+		auto it_node_end = source->m_Nodes.end();
+
+		for (auto it_node = it_node_begin; it_node != it_node_end; ++it_node)
 		{
-			auto it_begin = m_Meshes.begin();
-			auto it_end = m_Meshes.end();
+			Node* pSrcNode = it_node->get();
 
-			for (auto it = it_begin; it != it_end; ++it)
+			NodePtr dstNode = Node::Create(pSrcNode->GetID());
+
+			dstNode->SetName(pSrcNode->GetName());
+			dstNode->SetLocalTransform(pSrcNode->GetLocalTransform());
+
+			NodePtr parentNode = pSrcNode->GetParent();
+			if (parentNode != nullptr)
 			{
-				(*it)->DisconnectMaterials(m_Materials);
-				(*it)->Dispose();
+				Node::AddChild(model->m_Nodes[parentNode->GetID()], dstNode);
 			}
+
+			model->m_Nodes.push_back(dstNode);
 		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// }eAL
+		// ----------------------------------------------------------------------------------------------------
+
+		model->m_Materials = source->m_Materials;
+
+		// eNX`ǂݍݏIƂɁAǂ̃fłv[Xz_[Ɠւ悤ɂ
+		std::atomic_store(&model->m_TextureLoader, std::atomic_load(&source->m_TextureLoader));
+
+		// ----------------------------------------------------------------------------------------------------
+		// bV쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		model->m_Meshes.reserve(source->m_Meshes.size());
+
+		auto it_mesh_begin = source->m_Meshes.begin();
+		auto it_mesh_end = source->m_Meshes.end();
+
+		for (auto it_mesh = it_mesh_begin; it_mesh != it_mesh_end; ++it_mesh)
+		{
+			SkeletalMeshPtr srcMesh = (*it_mesh);
+
+			SkeletalMeshPtr dstMesh = SkeletalMesh::CreateInstance(srcMesh, model.get());
+			if (dstMesh == nullptr)
+			{
+				logger->PrintA(Logger::TYPE_ERROR, "Mesh preparation failed");
+				return nullptr;
+			}
+
+			dstMesh->ConnectMaterials(model->m_Materials);
+
+			Node::SetAttribute(model->m_Nodes[srcMesh->GetOwner()->GetID()], dstMesh);
+			dstMesh->SetOwnerModel(model);
+
+			model->m_Meshes.push_back(dstMesh);
+		}
+
+		model->m_PolygonCount = source->m_PolygonCount;
+
+		// ----------------------------------------------------------------------------------------------------
+
+		return std::move(model);
 	}
 
-	bool SkeletalModel::Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config)
+	SkeletalModel::SkeletalModel() :
+		m_PolygonCount(0)
+	{
+	}
+
+	SkeletalModel::~SkeletalModel()
+	{
+		Clear();
+	}
+
+	bool SkeletalModel::Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config, BackgroundJobHandlePtr handle)
 	{
 		// ----------------------------------------------------------------------------------------------------
 		// t@CpX
@@ -58,6 +130,11 @@ namespace ve {
 		// }eA쐬
 		// ----------------------------------------------------------------------------------------------------
 
+		// eNX`͓ǂݍ݂\񂷂邾ŁALoadTextures ł܂Ƃ߂ēǂݍ
+
+		TextureLoaderPtr textureLoader = TextureLoader::Create(m_DeviceContext);
+		std::atomic_store(&m_TextureLoader, textureLoader);
+
 		{
 			auto materials = source->GetMaterials();
 
@@ -93,7 +170,7 @@ namespace ve {
 						filePath = srcMaterial.diffuseTexture;
 					}
 
-					dstMaterial->SetDiffuseTexture(Texture::Create(m_DeviceContext, filePath.c_str()));
+					dstMaterial->SetDiffuseTexture(textureLoader->Add(filePath.c_str()));
 				}
 
 				if (srcMaterial.specularTexture.empty() == false)
@@ -110,7 +187,7 @@ namespace ve {
 						filePath = srcMaterial.specularTexture;
 					}
 
-					dstMaterial->SetSpecularTexture(Texture::Create(m_DeviceContext, filePath.c_str()));
+					dstMaterial->SetSpecularTexture(textureLoader->Add(filePath.c_str()));
 				}
 
 				if (srcMaterial.bumpTexture.empty() == false)
@@ -127,7 +204,7 @@ namespace ve {
 						filePath = srcMaterial.bumpTexture;
 					}
 
-					dstMaterial->SetBumpTexture(Texture::Create(m_DeviceContext, filePath.c_str()));
+					dstMaterial->SetBumpTexture(textureLoader->Add(filePath.c_str()));
 				}
 
 				m_Materials.push_back(dstMaterial);
@@ -138,13 +215,12 @@ namespace ve {
 		// m[hc[\z
 		// ----------------------------------------------------------------------------------------------------
 
-		collection::Vector<IModelSource::Polygon> polygons(source->GetPolygons().begin(), source->GetPolygons().end());
+		collection::Vector<SkeletalModel::Build_Mesh> buildMeshes;
 
 		const auto& nodes = source->GetNodes();
 
 		if (nodes.empty() == false)
 		{
-			int32_t lastMeshID = static_cast<int32_t>(source->GetMeshNodeCount()) - 1;
 			int32_t meshID = 0;
 			int32_t nodeID = 0;
 
@@ -173,12 +249,6 @@ namespace ve {
 					mesh->AssignMaterials(srcNode.materialIndices);
 					mesh->Preparation(srcNode.bones.size());
 
-					// o[ebNXACfbNXf[^쐬
-					if (mesh->BuildVertexIndexData(logger, polygons, srcNode.firstPolygonIndex, srcNode.polygonCount, config, meshID, lastMeshID) == false)
-					{
-						return nullptr;
-					}
-
 					// VFCvǉ
 					auto it_shape_begin = srcNode.boxes.begin();
 					auto it_shape_end = srcNode.boxes.end();
@@ -187,28 +257,239 @@ namespace ve {
 						mesh->AddShape(it_shape->center, it_shape->axis[0], it_shape->axis[1], it_shape->axis[2], it_shape->halfExtent);
 					}
 
+					// o[ebNXACfbNXf[^͌ł܂Ƃ߂č쐬
+					SkeletalModel::Build_Mesh buildMesh;
+					buildMesh.mesh = mesh;
+					buildMesh.node = dstNode;
+					buildMesh.firstVertex = srcNode.firstVertexIndex;
+					buildMesh.vertexCount = srcNode.vertexCount;
+					buildMesh.firstPolygon = srcNode.firstPolygonIndex;
+					buildMesh.polygonCount = srcNode.polygonCount;
+					buildMesh.logger = Logger::Create();
+					buildMesh.memorySize = 0;
+					buildMesh.built = false;
+					buildMesh.result = false;
+
+					buildMeshes.push_back(buildMesh);
+					meshID++;
+				}
+
+				m_Nodes.push_back(dstNode);
+				nodeID++;
+			}
+		}
+		else
+		{
+logger->PrintA(Logger::TYPE_ERROR, "The node does not exist");
+return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// bV쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		if (buildMeshes.empty() == false)
+		{
+			// [J[XbhbV̏ԂŃo[ebNXACfbNXf[^쐬AĂяõXbh쐬IbV珇ɃAbv[h
+			// Abv[hbV͍쐬ɎgpXg邽߁A쐬̃bVgp郁̍v𒴂Ȃ悤ɍ쐬Jn
+			// \[X̒_A|S̓t@CŜň̃XgɂȂĂāAׂẴbV쐬I܂ŉłȂ߁Aɂ͊܂߂Ȃ
+			// O̓bVƂɗ߂ĂAAbv[hƂɃbV̏Ԃŏo͂
+
+			// LZꂽꍇA쐬̃bV͎sƂĕԂĂ邽߁AAbv[hŒf
+
+			int32_t lastMeshID = static_cast<int32_t>(buildMeshes.size()) - 1;
+			uint64_t memoryBudget = static_cast<uint64_t>(config.memoryBudget) * 1024 * 1024;
+			uint64_t totalPolygonCount = 0;
+
+			{
+				auto it_begin = buildMeshes.begin();
+				auto it_end = buildMeshes.end();
+
+				for (auto it = it_begin; it != it_end; ++it)
+				{
+					it->memorySize = SkeletalMesh::EstimateBuildMemorySize(it->vertexCount, it->polygonCount, config);
+					totalPolygonCount += it->polygonCount;
+				}
+			}
+
+			handle->BeginStage(BACKGROUND_JOB_STAGE_BUILD_MESH, totalPolygonCount);
+
+			std::mutex buildMutex;
+			std::condition_variable buildCondition;
+			size_t nextBuildMesh = 0;
+			size_t builtMeshCount = 0;
+			uint64_t buildMemorySize = 0;
+			bool buildAbort = false;
+
+			const collection::Vector<IModelSource::Vertex>& srcVertices = source->GetVertices();
+			const collection::Vector<IModelSource::Polygon>& srcPolygons = source->GetPolygons();
+
+			/***************************/
+			/* 쐬 ( vf[T[ ) */
+			/***************************/
+
+			// \[X̒_A|S͓ǂݎ邾Ȃ̂ŁA[J[Xbhŕɍ쐬ł
+
+			// 쐬JnbV쐬
+			auto buildMeshFunc = [&](size_t buildMeshIndex)
+			{
+				SkeletalModel::Build_Mesh& buildMesh = buildMeshes[buildMeshIndex];
+				bool result = buildMesh.mesh->BuildVertexIndexData(
+					buildMesh.logger,
+					srcVertices, buildMesh.firstVertex, buildMesh.vertexCount,
+					srcPolygons, buildMesh.firstPolygon, buildMesh.polygonCount,
+					config, buildMesh.mesh->GetID(), lastMeshID,
+					handle);
+
+				{
+					std::unique_lock<std::mutex> lock(buildMutex);
+					buildMesh.result = result;
+					buildMesh.built = true;
+					builtMeshCount++;
+				}
+
+				buildCondition.notify_all();
+			};
+
+			auto buildFunc = [&]()
+			{
+				for (;;)
+				{
+					size_t buildMeshIndex;
+
+					{
+						std::unique_lock<std::mutex> lock(buildMutex);
+
+						// 𒴂郁bVłA쐬̃bV΍쐬Jn
+						buildCondition.wait(lock, [&]()
+						{
+							return (buildAbort == true) ||
+								(nextBuildMesh >= buildMeshes.size()) ||
+								(memoryBudget == 0) ||
+								(buildMemorySize == 0) ||
+								(buildMemorySize + buildMeshes[nextBuildMesh].memorySize <= memoryBudget);
+						});
+
+						if ((buildAbort == true) || (nextBuildMesh >= buildMeshes.size()))
+						{
+							return;
+						}
+
+						buildMeshIndex = nextBuildMesh++;
+						buildMemorySize += buildMeshes[buildMeshIndex].memorySize;
+					}
+
+					buildMeshFunc(buildMeshIndex);
+				}
+			};
+
+			// 쐬͋L̃[J[XbhōsAĂяõXbh̓Abv[hs
+			ParallelTask task;
+			task.Start(buildMeshes.size() + 1, buildFunc);
+
+			/***********************************/
+			/* Abv[h ( RV[}[ ) */
+			/***********************************/
+
+			bool sourceReleased = false;
+			bool result = true;
+
+			auto it_begin = buildMeshes.begin();
+			auto it_end = buildMeshes.end();
+
+			for (auto it = it_begin; (it != it_end) && (result == true); ++it)
+			{
+				SkeletalModel::Build_Mesh& buildMesh = (*it);
+				SkeletalMeshPtr mesh = buildMesh.mesh;
+
+				// [J[Xbh͂ق̃^XNƋLĂ邽߁ÃbV̍쐬n܂ĂȂΌĂяõXbhō쐬
+				// ( ÕbV̓Abv[hIĂ邽߁Ȁɂ炸쐬Jnł )
+				{
+					size_t buildMeshIndex = static_cast<size_t>(it - it_begin);
+					bool buildEnable = false;
+
+					{
+						std::unique_lock<std::mutex> lock(buildMutex);
+
+						if (nextBuildMesh == buildMeshIndex)
+						{
+							nextBuildMesh++;
+							buildMemorySize += buildMesh.memorySize;
+							buildEnable = true;
+						}
+					}
+
+					if (buildEnable == true)
+					{
+						buildMeshFunc(buildMeshIndex);
+					}
+				}
+
+				{
+					std::unique_lock<std::mutex> lock(buildMutex);
+					buildCondition.wait(lock, [&buildMesh]() { return buildMesh.built; });
+
+					// ׂẴbV쐬IA\[X̒_A|S͕svɂȂ
+					if ((sourceReleased == false) && (builtMeshCount == buildMeshes.size()))
+					{
+						source->ReleaseGeometry();
+						sourceReleased = true;
+					}
+				}
+
+				// ߂ĂOo
+				size_t itemCount;
+				if (buildMesh.logger->BeginItem(itemCount) == true)
+				{
+					for (size_t i = 0; i < itemCount; i++)
+					{
+						const Logger::Item& item = buildMesh.logger->GetItem(i);
+						logger->PrintA(item.type, "%s", item.message.c_str());
+					}
+				}
+				buildMesh.logger->EndItem();
+
+				// o[ebNXACfbNXf[^Abv[h ( 쐬Xg͂ŉ )
+				if ((buildMesh.result == false) || (mesh->UploadVertexIndexData() == false))
+				{
+					if (handle->IsCancelRequested() == false)
+					{
+						logger->PrintA(Logger::TYPE_ERROR, "Failed to build the mesh : Mesh[%d/%d]", mesh->GetID(), lastMeshID);
+					}
+
+					result = false;
+				}
+
+				{
+					std::unique_lock<std::mutex> lock(buildMutex);
+					buildMemorySize -= buildMesh.memorySize;
+					buildAbort = (result == false);
+				}
+
+				buildCondition.notify_all();
+
+				if (result == true)
+				{
 					// }eAɐڑ
 					mesh->ConnectMaterials(m_Materials);
 
 					// m[hɐݒ
-					Node::SetAttribute(dstNode, mesh);
+					Node::SetAttribute(buildMesh.node, mesh);
 
 					// bVXgɒǉ
 					m_Meshes.push_back(mesh);
-					meshID++;
 
 					m_PolygonCount += mesh->GetPolygonCount();
 				}
+			}
 
-				m_Nodes.push_back(dstNode);
-				nodeID++;
+			task.Wait();
+
+			if (result == false)
+			{
+				return false;
 			}
 		}
-		else
-		{
-logger->PrintA(Logger::TYPE_ERROR, "The node does not exist");
-return false;
-		}
 
 		// ----------------------------------------------------------------------------------------------------
 		// {[ݒ
@@ -283,6 +564,9 @@ return false;
 
 		CloseHandle(fileHandle);
 
+		// vWFNgǂݍޏꍇ̓obNOEh̃Wu߁AŃeNX`ǂݍ
+		LoadTextures(logger, nullptr);
+
 		return true;
 	}
 
@@ -328,9 +612,9 @@ return false;
 		logger->PrintA(Logger::TYPE_INFO, "Loading Completed!");
 	}
 
-	/************************************/
+	/***************************/
 	/* public override - Model */
-	/************************************/
+	/***************************/
 
 	const wchar_t* SkeletalModel::GetFilePath() const
 	{
@@ -377,107 +661,138 @@ return false;
 		return m_PolygonCount;
 	}
 
-	/**************************/
-	/* public override - Node */
-	/**************************/
+	/************************/
+	/* public - ImportCache */
+	/************************/
 
-	NodeAttribute::TYPE SkeletalModel::GetType() const
+	bool SkeletalModel::LoadCache(LoggerPtr logger, const wchar_t* pCacheFilePath, const wchar_t* pSourceFilePath)
 	{
-		return NodeAttribute::TYPE_MODEL;
-	}
+		HANDLE fileHandle = CreateFile(pCacheFilePath, GENERIC_READ, 0, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
 
-	void SkeletalModel::Update(const glm::mat4& worldMatrix)
-	{
-		m_Nodes[0]->Update(worldMatrix);
-	}
+		RemoveFileExtensionW(pSourceFilePath, m_FilePath);
 
-	/*****************************/
-	/* protected - NodeAttribute */
-	/*****************************/
+		StringW dirPath;
+		if (RemoveFileSpecW(m_FilePath.c_str(), dirPath) == false)
+		{
+			CloseHandle(fileHandle);
+			return false;
+		}
 
-	bool SkeletalModel::Draw(
-		const Frustum& frustum,
-		uint32_t frameIndex,
-		collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
-		collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets)
-	{
-		auto it_mesh_begin = m_Meshes.begin();
-		auto it_mesh_end = m_Meshes.end();
+		if (Load(logger, fileHandle, dirPath.c_str()) == false)
+		{
+			// ă\[Xt@C쐬ł悤ɁAr܂œǂݍ񂾂̂j
+			Clear();
 
-		const Plane& nearPlane = frustum.GetPlane(Frustum::PLANE_TYPE_NEAR);
+			CloseHandle(fileHandle);
+			return false;
+		}
 
-		uint32_t count = 0;
+		CloseHandle(fileHandle);
 
-		for (auto it_mesh = it_mesh_begin; it_mesh != it_mesh_end; ++it_mesh)
-		{
-			SkeletalMesh* pMesh = it_mesh->get();
+		return true;
+	}
 
-			if ((pMesh->GetVisible() == false) ||
-				(frustum.Contains(pMesh->GetAABB()) == false))
-			{
-				continue;
-			}
+	bool SkeletalModel::SaveCache(LoggerPtr logger, const wchar_t* pCacheFilePath)
+	{
+		HANDLE fileHandle = CreateFile(pCacheFilePath, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
 
-			pMesh->Draw(
-				nearPlane,
-				frameIndex,
-				m_Materials,
-				opacityDrawSets,
-				transparencyDrawSets);
+		// eNX`̃pX̓\[Xt@C̃fBNg̑΃pXŏ
+		StringW dirPath;
+		if (RemoveFileSpecW(m_FilePath.c_str(), dirPath) == false)
+		{
+			CloseHandle(fileHandle);
+			return false;
+		}
 
-			count++;
+		if (Save(logger, fileHandle, dirPath.c_str()) == false)
+		{
+			CloseHandle(fileHandle);
+			return false;
 		}
 
-		return (count > 0);
+		CloseHandle(fileHandle);
+
+		return true;
 	}
 
-	void SkeletalModel::DrawShadow(
-		const Sphere& sphere,
-		uint32_t frameIndex,
-		collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
-		AABB& aabb)
+	bool SkeletalModel::LoadTextures(LoggerPtr logger, BackgroundJobHandlePtr handle)
 	{
-		auto it_mesh_begin = m_Meshes.begin();
-		auto it_mesh_end = m_Meshes.end();
+		TextureLoaderPtr textureLoader = std::atomic_load(&m_TextureLoader);
 
-		for (auto it_mesh = it_mesh_begin; it_mesh != it_mesh_end; ++it_mesh)
+		if (textureLoader == nullptr)
 		{
-			SkeletalMesh* pMesh = it_mesh->get();
-			if ((pMesh->GetVisible() == false) || (pMesh->GetCastShadow() == false))
-			{
-				continue;
-			}
+			return true;
+		}
 
-			// E
-			const AABB& srcAabb = pMesh->GetAABB();
-			if (sphere.Contains(srcAabb) == false)
-			{
-				continue;
-			}
+		return textureLoader->Load(logger, handle);
+	}
+
+	collection::Vector<MaterialPtr>& SkeletalModel::GetDrawMaterials()
+	{
+		TextureLoaderPtr textureLoader = std::atomic_load(&m_TextureLoader);
 
-			// `ZbgW
-			pMesh->DrawShadow(frameIndex, m_Materials, shadowDrawSets);
+		if ((textureLoader != nullptr) && (textureLoader->IsFinished() == true))
+		{
+			auto it_material_begin = m_Materials.begin();
+			auto it_material_end = m_Materials.end();
 
-			// AABB 
-			for (uint32_t i = 0; i < 3; i++)
+			for (auto it_material = it_material_begin; it_material != it_material_end; ++it_material)
 			{
-				if (aabb.minimum[i] > srcAabb.minimum[i]) { aabb.minimum[i] = srcAabb.minimum[i]; }
-				if (aabb.maximum[i] < srcAabb.maximum[i]) { aabb.maximum[i] = srcAabb.maximum[i]; }
+				(*it_material)->RebindTextures();
 			}
 
-			aabb.center = (aabb.minimum + aabb.maximum) * 0.5f;
+			std::atomic_store(&m_TextureLoader, TextureLoaderPtr());
 		}
+
+		return m_Materials;
 	}
 
-	void SkeletalModel::DebugDraw(uint32_t flags, DebugRenderer* pDebugRenderer)
+	/**************************/
+	/* public override - Node */
+	/**************************/
+
+	NodeAttribute::TYPE SkeletalModel::GetType() const
 	{
-		auto it_mesh_begin = m_Meshes.begin();
-		auto it_mesh_end = m_Meshes.end();
+		return NodeAttribute::TYPE_MODEL;
+	}
 
-		for (auto it_mesh = it_mesh_begin; it_mesh != it_mesh_end; ++it_mesh)
+	void SkeletalModel::Update(const glm::mat4& worldMatrix)
+	{
+		m_Nodes[0]->Update(worldMatrix);
+	}
+
+	/***************************/
+	/* private - SkeletalModel */
+	/***************************/
+
+	void SkeletalModel::Clear()
+	{
+		if(m_Meshes.empty() == false)
 		{
-			(*it_mesh)->DebugDraw(flags, pDebugRenderer);
+			auto it_begin = m_Meshes.begin();
+			auto it_end = m_Meshes.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				(*it)->DisconnectMaterials(m_Materials);
+				(*it)->Dispose();
+			}
 		}
+
+		m_Meshes.clear();
+		m_Materials.clear();
+		m_Nodes.clear();
+		m_PolygonCount = 0;
+
+		std::atomic_store(&m_TextureLoader, TextureLoaderPtr());
 	}
 
 	bool SkeletalModel::Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath)
@@ -591,11 +906,14 @@ return false;
 
 		m_Materials.reserve(infoHeader.materialCount);
 
+		TextureLoaderPtr textureLoader = TextureLoader::Create(m_DeviceContext);
+		std::atomic_store(&m_TextureLoader, textureLoader);
+
 		for (uint32_t i = 0; i < infoHeader.materialCount; i++)
 		{
 			MaterialPtr material = Material::Create(m_DeviceContext);
 
-			if (material->Load(logger, fileHandle, pDirPath) == false)
+			if (material->Load(logger, fileHandle, pDirPath, textureLoader) == false)
 			{
 				return false;
 			}
@@ -10,6 +10,9 @@ namespace ve {
 	{
 	public:
 		static SkeletalModelPtr Create(DeviceContextPtr deviceContext);
+		// source ƓAZbgQƂ郂f쐬
+		// bṼWIgA}eA source ƋLAm[h ( gXtH[ )AbṼjtH[̓fƂɎ
+		static SkeletalModelPtr CreateInstance(LoggerPtr logger, SkeletalModelPtr source);
 
 		SkeletalModel();
 		~SkeletalModel();
@@ -20,7 +23,7 @@ namespace ve {
 		/* Model */
 		/******************/
 
-		bool Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config) override;
+		bool Load(LoggerPtr logger, ModelSourcePtr source, const ModelRendererConfig& config, BackgroundJobHandlePtr handle) override;
 		bool Load(LoggerPtr logger, const wchar_t* pFilePath) override;
 		bool Save(LoggerPtr logger) override;
 
@@ -39,6 +42,25 @@ namespace ve {
 
 		uint32_t GetPolygonCount() const override;
 
+		/******************/
+		/* ImportCache */
+		/******************/
+
+		// C|[gLbVǂݍ
+		// t@CpX̓\[Xt@C烍[hꍇƓɂȂAeNX`̑΃pX̓\[Xt@C̃fBNg
+		bool LoadCache(LoggerPtr logger, const wchar_t* pCacheFilePath, const wchar_t* pSourceFilePath);
+		// C|[gLbVɏ
+		bool SaveCache(LoggerPtr logger, const wchar_t* pCacheFilePath);
+
+		/***********/
+		/* Texture */
+		/***********/
+
+		// ǂݍݒ̃eNX`ǂݍ ( }eA͕`掞Ƀv[Xz_[ւALZꂽꍇ false Ԃ )
+		bool LoadTextures(LoggerPtr logger, BackgroundJobHandlePtr handle);
+		// bV`悷Ƃ̃}eA ( eNX`ǂݍݏIĂ΁Av[Xz_[ƓւĂԂ )
+		collection::Vector<MaterialPtr>& GetDrawMaterials();
+
 		/******************/
 		/* NodeAttribute */
 		/******************/
@@ -48,21 +70,6 @@ namespace ve {
 
 		VE_DECLARE_ALLOCATOR
 
-	protected:
-		bool Draw(
-			const Frustum& frustum,
-			uint32_t frameIndex,
-			collection::DynamicContainer<OpacityDrawSet>& opacityDrawSets,
-			collection::DynamicContainer<TransparencyDrawSet>& transparencyDrawSets) override;
-
-		void DrawShadow(
-			const Sphere& sphere,
-			uint32_t frameIndex,
-			collection::DynamicContainer<ShadowDrawSet>& shadowDrawSets,
-			AABB& aabb) override;
-
-		void DebugDraw(uint32_t flags, DebugRenderer* pDebugRenderer) override;
-
 	private:
 		// ----------------------------------------------------------------------------------------------------
 
@@ -93,6 +100,22 @@ namespace ve {
 
 		// ----------------------------------------------------------------------------------------------------
 
+		struct Build_Mesh
+		{
+			SkeletalMeshPtr mesh;
+			NodePtr node;
+			uint32_t firstVertex;
+			uint32_t vertexCount;
+			uint32_t firstPolygon;
+			uint32_t polygonCount;
+			uint64_t memorySize; // 쐬Abv[h܂łɎgp郁̌ς
+			LoggerPtr logger;
+			bool built;
+			bool result;
+		};
+
+		// ----------------------------------------------------------------------------------------------------
+
 		DeviceContextPtr m_DeviceContext;
 
 		StringW m_FilePath;
@@ -104,6 +127,11 @@ namespace ve {
 		collection::Vector<SkeletalMeshPtr> m_Meshes;
 		uint32_t m_PolygonCount;
 
+		// }eÃeNX`ǂݍݏI܂ŕێ ( ǂݍރXbhƕ`悷XbhQƂ邽߁Astd::atomic_loadAstd::atomic_store ŃANZX )
+		TextureLoaderPtr m_TextureLoader;
+
+		void Clear();
+
 		bool Load(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath);
 		bool Save(LoggerPtr logger, HANDLE fileHandle, const wchar_t* pDirPath);
 	};
@@ -38,4 +38,57 @@ namespace ve {
 		return (glm::length2(vec) <= (radius * radius));
 	}
 
+	void Sphere::ContainsBatch(const AABBArray& aabbs, uint32_t count, uint8_t* pResults) const
+	{
+		float radiusSq = radius * radius;
+		uint32_t index = 0;
+
+#ifdef VE_SIMD_SSE
+		/************************/
+		/* 4  AABB  */
+		/************************/
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		const __m128 sx = _mm_set1_ps(center.x);
+		const __m128 sy = _mm_set1_ps(center.y);
+		const __m128 sz = _mm_set1_ps(center.z);
+		const __m128 rr = _mm_set1_ps(radiusSq);
+
+		uint32_t simdCount = count & ~static_cast<uint32_t>(3);
+
+		for (; index < simdCount; index += 4)
+		{
+			// SԂ̋ extent ̂Ae̍ł߂_܂ł̋ɂȂ
+			__m128 dx = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(aabbs.pCenterX + index), sx)), _mm_loadu_ps(aabbs.pExtentX + index)), zero);
+			__m128 dy = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(aabbs.pCenterY + index), sy)), _mm_loadu_ps(aabbs.pExtentY + index)), zero);
+			__m128 dz = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(aabbs.pCenterZ + index), sz)), _mm_loadu_ps(aabbs.pExtentZ + index)), zero);
+
+			__m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+
+			int insideMask = _mm_movemask_ps(_mm_cmple_ps(distSq, rr));
+
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				pResults[index + j] = (insideMask & (1 << j)) ? 1 : 0;
+			}
+		}
+#endif //VE_SIMD_SSE
+
+		/**********************/
+		/* c AABB 𔻒 */
+		/**********************/
+
+		for (; index < count; index++)
+		{
+			glm::vec3 distance;
+			distance.x = std::max(fabsf(aabbs.pCenterX[index] - center.x) - aabbs.pExtentX[index], 0.0f);
+			distance.y = std::max(fabsf(aabbs.pCenterY[index] - center.y) - aabbs.pExtentY[index], 0.0f);
+			distance.z = std::max(fabsf(aabbs.pCenterZ[index] - center.z) - aabbs.pExtentZ[index], 0.0f);
+
+			pResults[index] = (glm::length2(distance) <= radiusSq) ? 1 : 0;
+		}
+	}
+
 }
@@ -15,6 +15,8 @@ namespace ve {
 		Sphere(const glm::vec3& center, float radius);
 
 		bool Contains(const AABB& aabb) const;
+		// count  AABB ܂Ƃ߂Ĕ肵Aꍇ pResults  1 AȌꍇ 0 
+		void ContainsBatch(const AABBArray& aabbs, uint32_t count, uint8_t* pResults) const;
 	};
 
 }
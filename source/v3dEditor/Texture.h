@@ -13,6 +13,9 @@ namespace ve {
 
 		const wchar_t* GetFilePath();
 
+		// TextureLoader œǂݍݒǂ ( ǂݍݒ̓v[Xz_[̃C[WԂ )
+		bool IsPending() const;
+
 		const V3DImageDesc& GetNativeDesc() const;
 		IV3DImageView* GetNativeImageViewPtr();
 
@@ -21,6 +24,8 @@ namespace ve {
 	private:
 		struct Impl;
 		Impl* impl;
+
+		friend class TextureLoader;
 	};
 
 }
\ No newline at end of file
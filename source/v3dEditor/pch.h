@@ -60,6 +60,15 @@ inline HFONT GetWindowFont(HWND hWnd)
 #include <crtdbg.h>
 #endif //_DEBUG
 
+// SSE ( x64 ł͏Ɏgpł )
+#if defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define VE_SIMD_SSE
+#include <xmmintrin.h>
+#endif //defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+
+// NɎ̔̃x`}[NsāAʂOɏo͂
+//#define VE_BENCHMARK_FRUSTUM
+
 namespace ve {
 
 	void Initialize();
@@ -339,6 +348,7 @@ namespace ve {
 	class Camera;
 	class Material;
 	class Texture;
+	class TextureLoader;
 	class Light;
 	class MainLight;
 	class IModelSource;
@@ -364,6 +374,7 @@ namespace ve {
 	typedef SharedPtr<Camera> CameraPtr;
 	typedef SharedPtr<Material> MaterialPtr;
 	typedef SharedPtr<Texture> TexturePtr;
+	typedef SharedPtr<TextureLoader> TextureLoaderPtr;
 	typedef SharedPtr<Light> LightPtr;
 	typedef SharedPtr<IModelSource> ModelSourcePtr;
 	typedef SharedPtr<IMaterialContainer> MaterialContainerPtr;
@@ -399,9 +410,11 @@ namespace ve {
 		MATERIAL_SHADER_TRANSPARENCY = 0x00000010,
 
 		MATERIAL_SHADER_SHADOW = 0x00000020,
+		MATERIAL_SHADER_PACKED_VERTEX = 0x00000040,
+		MATERIAL_SHADER_INSTANCING = 0x00000080, // [hsCX^XƂɓǂݍ ( {[̖sȃbṼJ[pCvĈ )
 
 		MATERIAL_SHADER_TEXTURE_MASK = MATERIAL_SHADER_DIFFUSE_TEXTURE | MATERIAL_SHADER_SPECULAR_TEXTURE | MATERIAL_SHADER_BUMP_TEXTURE,
-		MATERIAL_SHADER_PIPELINE_MASK = MATERIAL_SHADER_DIFFUSE_TEXTURE | MATERIAL_SHADER_SPECULAR_TEXTURE | MATERIAL_SHADER_BUMP_TEXTURE | MATERIAL_SHADER_TRANSPARENCY,
+		MATERIAL_SHADER_PIPELINE_MASK = MATERIAL_SHADER_DIFFUSE_TEXTURE | MATERIAL_SHADER_SPECULAR_TEXTURE | MATERIAL_SHADER_BUMP_TEXTURE | MATERIAL_SHADER_TRANSPARENCY | MATERIAL_SHADER_INSTANCING,
 		MATERIAL_SHADER_SHADOW_PIPELINE_MASK = MATERIAL_SHADER_DIFFUSE_TEXTURE | MATERIAL_SHADER_SHADOW,
 	};
 
@@ -603,6 +616,8 @@ namespace ve {
 		bool optimizeEnable;
 		bool smoosingEnable;
 		float smoosingCos;
+		bool packedVertexEnable;
+		uint32_t memoryBudget; // 쐬̃bVɎgp郁̏ ( MB ) 0 ̏ꍇ͐Ȃ ( \[X̒_A|S͊܂܂Ȃ )
 	};
 
 	struct Transform
@@ -633,6 +648,15 @@ namespace ve {
 		uint32_t indexCount;
 		uint32_t firstIndex;
 
+		// CX^VO ( pInstancingPipeline ̓CX^VOŕ`łȂꍇ nullptr )
+		IV3DPipeline* pInstancingPipeline;
+		const glm::mat4* pWorldMatrix;
+		uint32_t key;
+
+		// V[܂Ƃ߂ ( 0 ̏ꍇ͐擪̕`Zbgɂ܂Ƃ߂Ă )
+		uint32_t instanceCount;
+		uint32_t instanceOffset;
+
 		VE_DECLARE_ALLOCATOR
 	};
 
@@ -0,0 +1,694 @@
+#include "AabbTree.h"
+
+namespace ve {
+
+	/*********************/
+	/* public - AabbTree */
+	/*********************/
+
+	AabbTree* AabbTree::Create()
+	{
+		return VE_NEW_T(AabbTree);
+	}
+
+	AabbTree::AabbTree() :
+		m_Root(AabbTree::NULL_PROXY),
+		m_FreeList(AabbTree::NULL_PROXY)
+	{
+	}
+
+	AabbTree::~AabbTree()
+	{
+	}
+
+	void AabbTree::Destroy()
+	{
+		VE_DELETE_THIS_T(this, AabbTree);
+	}
+
+	int32_t AabbTree::Add(const glm::vec3& aabbMin, const glm::vec3& aabbMax, void* pUserData)
+	{
+		int32_t proxy = AllocateNode();
+
+		AabbTree::Node& node = m_Nodes[proxy];
+
+		glm::vec3 margin = (aabbMax - aabbMin) * AabbTree::FAT_RATE;
+
+		node.aabbMin = aabbMin - margin;
+		node.aabbMax = aabbMax + margin;
+		node.height = 0;
+		node.center = (aabbMin + aabbMax) * 0.5f;
+		node.extent = (aabbMax - aabbMin) * 0.5f;
+		node.planeCache = 0;
+		node.pUserData = pUserData;
+
+		InsertLeaf(proxy);
+
+		return proxy;
+	}
+
+	void AabbTree::Remove(int32_t proxy)
+	{
+		VE_ASSERT((0 <= proxy) && (proxy < static_cast<int32_t>(m_Nodes.size())));
+		VE_ASSERT(m_Nodes[proxy].child1 == AabbTree::NULL_PROXY);
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+	}
+
+	bool AabbTree::Move(int32_t proxy, const glm::vec3& aabbMin, const glm::vec3& aabbMax)
+	{
+		VE_ASSERT((0 <= proxy) && (proxy < static_cast<int32_t>(m_Nodes.size())));
+		VE_ASSERT(m_Nodes[proxy].child1 == AabbTree::NULL_PROXY);
+
+		AabbTree::Node& node = m_Nodes[proxy];
+
+		node.center = (aabbMin + aabbMax) * 0.5f;
+		node.extent = (aabbMax - aabbMin) * 0.5f;
+
+		glm::vec3 margin = (aabbMax - aabbMin) * AabbTree::FAT_RATE;
+
+		// L AABB Ɏ܂ĂāAk AABB ɑ΂čLȂꍇ͂̂܂܂ɂ
+		if ((glm::all(glm::lessThanEqual(node.aabbMin, aabbMin)) == true) &&
+			(glm::all(glm::lessThanEqual(aabbMax, node.aabbMax)) == true))
+		{
+			glm::vec3 largeMin = aabbMin - margin * 4.0f;
+			glm::vec3 largeMax = aabbMax + margin * 4.0f;
+
+			if ((glm::all(glm::lessThanEqual(largeMin, node.aabbMin)) == true) &&
+				(glm::all(glm::lessThanEqual(node.aabbMax, largeMax)) == true))
+			{
+				return false;
+			}
+		}
+
+		RemoveLeaf(proxy);
+
+		node.aabbMin = aabbMin - margin;
+		node.aabbMax = aabbMax + margin;
+
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	void AabbTree::Query(const Frustum& frustum, collection::Vector<void*>& results)
+	{
+		if (m_Root == AabbTree::NULL_PROXY)
+		{
+			return;
+		}
+
+		m_Batch.leaves.clear();
+
+		m_Stack.clear();
+		m_Stack.push_back(m_Root);
+
+		while (m_Stack.empty() == false)
+		{
+			int32_t index = m_Stack.back();
+			m_Stack.pop_back();
+
+			const AabbTree::Node& node = m_Nodes[index];
+
+			AabbTree::TEST_RESULT result = AabbTree::Test(frustum, node.aabbMin, node.aabbMax);
+			if (result == AabbTree::TEST_RESULT_OUTSIDE)
+			{
+				continue;
+			}
+
+			if (result == AabbTree::TEST_RESULT_INSIDE)
+			{
+				// SɊ܂܂Ăꍇ́Aq̔ȗ
+				CollectLeaves(index, results);
+			}
+			else if (node.child1 == AabbTree::NULL_PROXY)
+			{
+				m_Batch.leaves.push_back(index);
+			}
+			else
+			{
+				m_Stack.push_back(node.child1);
+				m_Stack.push_back(node.child2);
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// [to^EŔ肵Ȃ
+		// ----------------------------------------------------------------------------------------------------
+
+		if (m_Batch.leaves.empty() == true)
+		{
+			return;
+		}
+
+		uint32_t leafCount = static_cast<uint32_t>(m_Batch.leaves.size());
+
+		AABBArray aabbs = GatherBatch();
+
+		// Õt[Ŋpʂ́Ãt[łp邱Ƃ߁Aŏɔ肷
+		for (uint32_t i = 0; i < leafCount; i++)
+		{
+			m_Batch.planeCaches[i] = m_Nodes[m_Batch.leaves[i]].planeCache;
+		}
+
+		frustum.ContainsBatch(aabbs, leafCount, m_Batch.planeCaches.data(), m_Batch.results.data());
+
+		for (uint32_t i = 0; i < leafCount; i++)
+		{
+			AabbTree::Node& node = m_Nodes[m_Batch.leaves[i]];
+
+			node.planeCache = m_Batch.planeCaches[i];
+
+			if (m_Batch.results[i] != 0)
+			{
+				results.push_back(node.pUserData);
+			}
+		}
+	}
+
+	void AabbTree::Query(const Sphere& sphere, collection::Vector<void*>& results)
+	{
+		if (m_Root == AabbTree::NULL_PROXY)
+		{
+			return;
+		}
+
+		m_Batch.leaves.clear();
+
+		m_Stack.clear();
+		m_Stack.push_back(m_Root);
+
+		while (m_Stack.empty() == false)
+		{
+			int32_t index = m_Stack.back();
+			m_Stack.pop_back();
+
+			const AabbTree::Node& node = m_Nodes[index];
+
+			AabbTree::TEST_RESULT result = AabbTree::Test(sphere, node.aabbMin, node.aabbMax);
+			if (result == AabbTree::TEST_RESULT_OUTSIDE)
+			{
+				continue;
+			}
+
+			if (result == AabbTree::TEST_RESULT_INSIDE)
+			{
+				CollectLeaves(index, results);
+			}
+			else if (node.child1 == AabbTree::NULL_PROXY)
+			{
+				m_Batch.leaves.push_back(index);
+			}
+			else
+			{
+				m_Stack.push_back(node.child1);
+				m_Stack.push_back(node.child2);
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// [to^EŔ肵Ȃ
+		// ----------------------------------------------------------------------------------------------------
+
+		if (m_Batch.leaves.empty() == true)
+		{
+			return;
+		}
+
+		uint32_t leafCount = static_cast<uint32_t>(m_Batch.leaves.size());
+
+		AABBArray aabbs = GatherBatch();
+
+		sphere.ContainsBatch(aabbs, leafCount, m_Batch.results.data());
+
+		for (uint32_t i = 0; i < leafCount; i++)
+		{
+			if (m_Batch.results[i] != 0)
+			{
+				results.push_back(m_Nodes[m_Batch.leaves[i]].pUserData);
+			}
+		}
+	}
+
+	/**********************/
+	/* private - AabbTree */
+	/**********************/
+
+	int32_t AabbTree::AllocateNode()
+	{
+		int32_t index;
+
+		if (m_FreeList == AabbTree::NULL_PROXY)
+		{
+			index = static_cast<int32_t>(m_Nodes.size());
+			m_Nodes.push_back(AabbTree::Node{});
+		}
+		else
+		{
+			index = m_FreeList;
+			m_FreeList = m_Nodes[index].parent;
+		}
+
+		AabbTree::Node& node = m_Nodes[index];
+
+		node.parent = AabbTree::NULL_PROXY;
+		node.child1 = AabbTree::NULL_PROXY;
+		node.child2 = AabbTree::NULL_PROXY;
+		node.height = 0;
+		node.pUserData = nullptr;
+
+		return index;
+	}
+
+	void AabbTree::FreeNode(int32_t index)
+	{
+		AabbTree::Node& node = m_Nodes[index];
+
+		node.parent = m_FreeList;
+		node.height = -1;
+		node.pUserData = nullptr;
+
+		m_FreeList = index;
+	}
+
+	void AabbTree::InsertLeaf(int32_t leaf)
+	{
+		if (m_Root == AabbTree::NULL_PROXY)
+		{
+			m_Root = leaf;
+			m_Nodes[m_Root].parent = AabbTree::NULL_PROXY;
+			return;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// \ʐς̑łȂȂZT
+		// ----------------------------------------------------------------------------------------------------
+
+		glm::vec3 leafMin = m_Nodes[leaf].aabbMin;
+		glm::vec3 leafMax = m_Nodes[leaf].aabbMax;
+
+		int32_t index = m_Root;
+
+		while (m_Nodes[index].child1 != AabbTree::NULL_PROXY)
+		{
+			const AabbTree::Node& node = m_Nodes[index];
+			const AabbTree::Node& child1 = m_Nodes[node.child1];
+			const AabbTree::Node& child2 = m_Nodes[node.child2];
+
+			float area = AabbTree::GetArea(node.aabbMin, node.aabbMax);
+			float combinedArea = AabbTree::GetArea(glm::min(node.aabbMin, leafMin), glm::max(node.aabbMax, leafMax));
+
+			// ̃m[hƃ[t̐eV쐬ꍇ̃RXg
+			float cost = 2.0f * combinedArea;
+			// qɍ~ꍇɁÃm[h AABB L镪̃RXg
+			float inheritanceCost = 2.0f * (combinedArea - area);
+
+			float cost1 = AabbTree::GetArea(glm::min(child1.aabbMin, leafMin), glm::max(child1.aabbMax, leafMax)) + inheritanceCost;
+			if (child1.child1 != AabbTree::NULL_PROXY)
+			{
+				cost1 -= AabbTree::GetArea(child1.aabbMin, child1.aabbMax);
+			}
+
+			float cost2 = AabbTree::GetArea(glm::min(child2.aabbMin, leafMin), glm::max(child2.aabbMax, leafMax)) + inheritanceCost;
+			if (child2.child1 != AabbTree::NULL_PROXY)
+			{
+				cost2 -= AabbTree::GetArea(child2.aabbMin, child2.aabbMax);
+			}
+
+			if ((cost < cost1) && (cost < cost2))
+			{
+				break;
+			}
+
+			index = (cost1 < cost2) ? node.child1 : node.child2;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// Zƃ[t̐e쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		int32_t sibling = index;
+
+		// m[hmۂƃXgĊmۂ邱Ƃ邽߁AQƂ͂̌Ɏ擾
+		int32_t newParent = AllocateNode();
+
+		AabbTree::Node& siblingNode = m_Nodes[sibling];
+		AabbTree::Node& newParentNode = m_Nodes[newParent];
+
+		int32_t oldParent = siblingNode.parent;
+
+		newParentNode.parent = oldParent;
+		newParentNode.child1 = sibling;
+		newParentNode.child2 = leaf;
+		newParentNode.aabbMin = glm::min(siblingNode.aabbMin, leafMin);
+		newParentNode.aabbMax = glm::max(siblingNode.aabbMax, leafMax);
+		newParentNode.height = siblingNode.height + 1;
+
+		if (oldParent != AabbTree::NULL_PROXY)
+		{
+			AabbTree::Node& oldParentNode = m_Nodes[oldParent];
+
+			if (oldParentNode.child1 == sibling)
+			{
+				oldParentNode.child1 = newParent;
+			}
+			else
+			{
+				oldParentNode.child2 = newParent;
+			}
+		}
+		else
+		{
+			m_Root = newParent;
+		}
+
+		siblingNode.parent = newParent;
+		m_Nodes[leaf].parent = newParent;
+
+		// ----------------------------------------------------------------------------------------------------
+		// c AABB XV
+		// ----------------------------------------------------------------------------------------------------
+
+		Refit(newParent);
+	}
+
+	void AabbTree::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = AabbTree::NULL_PROXY;
+			return;
+		}
+
+		int32_t parent = m_Nodes[leaf].parent;
+		int32_t grandParent = m_Nodes[parent].parent;
+		int32_t sibling = (m_Nodes[parent].child1 == leaf) ? m_Nodes[parent].child2 : m_Nodes[parent].child1;
+
+		// e菜AZc̎qɂ
+		if (grandParent != AabbTree::NULL_PROXY)
+		{
+			AabbTree::Node& grandParentNode = m_Nodes[grandParent];
+
+			if (grandParentNode.child1 == parent)
+			{
+				grandParentNode.child1 = sibling;
+			}
+			else
+			{
+				grandParentNode.child2 = sibling;
+			}
+
+			m_Nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			m_Root = sibling;
+			m_Nodes[sibling].parent = AabbTree::NULL_PROXY;
+			FreeNode(parent);
+		}
+
+		m_Nodes[leaf].parent = AabbTree::NULL_PROXY;
+	}
+
+	int32_t AabbTree::Balance(int32_t index)
+	{
+		int32_t iA = index;
+		AabbTree::Node& a = m_Nodes[iA];
+
+		if ((a.child1 == AabbTree::NULL_PROXY) || (a.height < 2))
+		{
+			return iA;
+		}
+
+		int32_t iB = a.child1;
+		int32_t iC = a.child2;
+		AabbTree::Node& b = m_Nodes[iB];
+		AabbTree::Node& c = m_Nodes[iC];
+
+		int32_t balance = c.height - b.height;
+
+		if (balance > 1)
+		{
+			// ----------------------------------------------------------------------------------------------------
+			// C  A ̈ʒuɎグ
+			// ----------------------------------------------------------------------------------------------------
+
+			int32_t iF = c.child1;
+			int32_t iG = c.child2;
+			AabbTree::Node& f = m_Nodes[iF];
+			AabbTree::Node& g = m_Nodes[iG];
+
+			c.child1 = iA;
+			c.parent = a.parent;
+			a.parent = iC;
+
+			if (c.parent != AabbTree::NULL_PROXY)
+			{
+				AabbTree::Node& parentNode = m_Nodes[c.parent];
+
+				if (parentNode.child1 == iA)
+				{
+					parentNode.child1 = iC;
+				}
+				else
+				{
+					parentNode.child2 = iC;
+				}
+			}
+			else
+			{
+				m_Root = iC;
+			}
+
+			// ̑ C ɎcAႢ A Ɉڂ
+			if (f.height > g.height)
+			{
+				c.child2 = iF;
+				a.child2 = iG;
+				g.parent = iA;
+
+				a.aabbMin = glm::min(b.aabbMin, g.aabbMin);
+				a.aabbMax = glm::max(b.aabbMax, g.aabbMax);
+				c.aabbMin = glm::min(a.aabbMin, f.aabbMin);
+				c.aabbMax = glm::max(a.aabbMax, f.aabbMax);
+
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			}
+			else
+			{
+				c.child2 = iG;
+				a.child2 = iF;
+				f.parent = iA;
+
+				a.aabbMin = glm::min(b.aabbMin, f.aabbMin);
+				a.aabbMax = glm::max(b.aabbMax, f.aabbMax);
+				c.aabbMin = glm::min(a.aabbMin, g.aabbMin);
+				c.aabbMax = glm::max(a.aabbMax, g.aabbMax);
+
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+
+			return iC;
+		}
+
+		if (balance < -1)
+		{
+			// ----------------------------------------------------------------------------------------------------
+			// B  A ̈ʒuɎグ
+			// ----------------------------------------------------------------------------------------------------
+
+			int32_t iD = b.child1;
+			int32_t iE = b.child2;
+			AabbTree::Node& d = m_Nodes[iD];
+			AabbTree::Node& e = m_Nodes[iE];
+
+			b.child1 = iA;
+			b.parent = a.parent;
+			a.parent = iB;
+
+			if (b.parent != AabbTree::NULL_PROXY)
+			{
+				AabbTree::Node& parentNode = m_Nodes[b.parent];
+
+				if (parentNode.child1 == iA)
+				{
+					parentNode.child1 = iB;
+				}
+				else
+				{
+					parentNode.child2 = iB;
+				}
+			}
+			else
+			{
+				m_Root = iB;
+			}
+
+			if (d.height > e.height)
+			{
+				b.child2 = iD;
+				a.child1 = iE;
+				e.parent = iA;
+
+				a.aabbMin = glm::min(c.aabbMin, e.aabbMin);
+				a.aabbMax = glm::max(c.aabbMax, e.aabbMax);
+				b.aabbMin = glm::min(a.aabbMin, d.aabbMin);
+				b.aabbMax = glm::max(a.aabbMax, d.aabbMax);
+
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			}
+			else
+			{
+				b.child2 = iE;
+				a.child1 = iD;
+				d.parent = iA;
+
+				a.aabbMin = glm::min(c.aabbMin, d.aabbMin);
+				a.aabbMax = glm::max(c.aabbMax, d.aabbMax);
+				b.aabbMin = glm::min(a.aabbMin, e.aabbMin);
+				b.aabbMax = glm::max(a.aabbMax, e.aabbMax);
+
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	void AabbTree::Refit(int32_t index)
+	{
+		while (index != AabbTree::NULL_PROXY)
+		{
+			index = Balance(index);
+
+			AabbTree::Node& node = m_Nodes[index];
+			const AabbTree::Node& child1 = m_Nodes[node.child1];
+			const AabbTree::Node& child2 = m_Nodes[node.child2];
+
+			node.aabbMin = glm::min(child1.aabbMin, child2.aabbMin);
+			node.aabbMax = glm::max(child1.aabbMax, child2.aabbMax);
+			node.height = 1 + std::max(child1.height, child2.height);
+
+			index = node.parent;
+		}
+	}
+
+	void AabbTree::CollectLeaves(int32_t index, collection::Vector<void*>& results)
+	{
+		const AabbTree::Node& node = m_Nodes[index];
+
+		if (node.child1 == AabbTree::NULL_PROXY)
+		{
+			results.push_back(node.pUserData);
+		}
+		else
+		{
+			// tۂĂ邽߁AċA̐[̓[t̐̑ΐɎ܂
+			CollectLeaves(node.child1, results);
+			CollectLeaves(node.child2, results);
+		}
+	}
+
+	AABBArray AabbTree::GatherBatch()
+	{
+		size_t leafCount = m_Batch.leaves.size();
+
+		m_Batch.centerX.resize(leafCount);
+		m_Batch.centerY.resize(leafCount);
+		m_Batch.centerZ.resize(leafCount);
+		m_Batch.extentX.resize(leafCount);
+		m_Batch.extentY.resize(leafCount);
+		m_Batch.extentZ.resize(leafCount);
+		m_Batch.planeCaches.resize(leafCount);
+		m_Batch.results.resize(leafCount);
+
+		for (size_t i = 0; i < leafCount; i++)
+		{
+			const AabbTree::Node& node = m_Nodes[m_Batch.leaves[i]];
+
+			m_Batch.centerX[i] = node.center.x;
+			m_Batch.centerY[i] = node.center.y;
+			m_Batch.centerZ[i] = node.center.z;
+			m_Batch.extentX[i] = node.extent.x;
+			m_Batch.extentY[i] = node.extent.y;
+			m_Batch.extentZ[i] = node.extent.z;
+		}
+
+		AABBArray aabbs;
+		aabbs.pCenterX = m_Batch.centerX.data();
+		aabbs.pCenterY = m_Batch.centerY.data();
+		aabbs.pCenterZ = m_Batch.centerZ.data();
+		aabbs.pExtentX = m_Batch.extentX.data();
+		aabbs.pExtentY = m_Batch.extentY.data();
+		aabbs.pExtentZ = m_Batch.extentZ.data();
+
+		return aabbs;
+	}
+
+	AabbTree::TEST_RESULT AabbTree::Test(const Frustum& frustum, const glm::vec3& aabbMin, const glm::vec3& aabbMax)
+	{
+		AabbTree::TEST_RESULT result = AabbTree::TEST_RESULT_INSIDE;
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			const Plane& plane = frustum.GetPlane(static_cast<Frustum::PLANE_TYPE>(i));
+			const glm::vec3& normal = plane.normal;
+
+			// @̕ɍł_ɂΊOAł߂_ɂΌ
+			glm::vec3 positive;
+			glm::vec3 negative;
+
+			positive.x = (normal.x >= 0.0f) ? aabbMax.x : aabbMin.x;
+			positive.y = (normal.y >= 0.0f) ? aabbMax.y : aabbMin.y;
+			positive.z = (normal.z >= 0.0f) ? aabbMax.z : aabbMin.z;
+
+			negative.x = (normal.x >= 0.0f) ? aabbMin.x : aabbMax.x;
+			negative.y = (normal.y >= 0.0f) ? aabbMin.y : aabbMax.y;
+			negative.z = (normal.z >= 0.0f) ? aabbMin.z : aabbMax.z;
+
+			if ((glm::dot(normal, positive) + plane.d) < 0.0f)
+			{
+				return AabbTree::TEST_RESULT_OUTSIDE;
+			}
+
+			if ((glm::dot(normal, negative) + plane.d) < 0.0f)
+			{
+				result = AabbTree::TEST_RESULT_INTERSECT;
+			}
+		}
+
+		return result;
+	}
+
+	AabbTree::TEST_RESULT AabbTree::Test(const Sphere& sphere, const glm::vec3& aabbMin, const glm::vec3& aabbMax)
+	{
+		float radiusSq = sphere.radius * sphere.radius;
+
+		// ł߂_
+		glm::vec3 nearest = glm::clamp(sphere.center, aabbMin, aabbMax);
+		if (glm::length2(nearest - sphere.center) > radiusSq)
+		{
+			return AabbTree::TEST_RESULT_OUTSIDE;
+		}
+
+		// ł_
+		glm::vec3 farthest = glm::max(glm::abs(sphere.center - aabbMin), glm::abs(aabbMax - sphere.center));
+		if (glm::length2(farthest) <= radiusSq)
+		{
+			return AabbTree::TEST_RESULT_INSIDE;
+		}
+
+		return AabbTree::TEST_RESULT_INTERSECT;
+	}
+
+}
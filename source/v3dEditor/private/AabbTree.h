@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Frustum.h"
+#include "Sphere.h"
+
+namespace ve {
+
+	// I AABB c[ ( BVH )
+	// [tɂ͏L AABB Aړ AABB Ɏ܂ȂȂƂȂ
+	class AabbTree final
+	{
+	public:
+		static constexpr int32_t NULL_PROXY = -1;
+
+		static AabbTree* Create();
+
+		AabbTree();
+		~AabbTree();
+
+		void Destroy();
+
+		// ߂l̓[tʂvLV
+		int32_t Add(const glm::vec3& aabbMin, const glm::vec3& aabbMax, void* pUserData);
+		void Remove(int32_t proxy);
+		// [t AABB Ɏ܂Ăꍇ͉ false Ԃ
+		bool Move(int32_t proxy, const glm::vec3& aabbMin, const glm::vec3& aabbMax);
+
+		// o^E郊[t̃[U[f[^ results ̌ɒǉ
+		// L AABB [t́A܂Ƃ߂ēo^EŔ肵Ȃ
+		void Query(const Frustum& frustum, collection::Vector<void*>& results);
+		void Query(const Sphere& sphere, collection::Vector<void*>& results);
+
+		VE_DECLARE_ALLOCATOR
+
+	private:
+		// [t AABB L銄 ( e̒ɑ΂銄 )
+		static constexpr float FAT_RATE = 0.1f;
+
+		enum TEST_RESULT
+		{
+			TEST_RESULT_OUTSIDE = 0,
+			TEST_RESULT_INTERSECT = 1,
+			TEST_RESULT_INSIDE = 2,
+		};
+
+		struct Node
+		{
+			glm::vec3 aabbMin;
+			glm::vec3 aabbMax;
+
+			int32_t parent; // gp̏ꍇ͎̖gp̃m[h
+			int32_t child1; // [t̏ꍇ NULL_PROXY
+			int32_t child2;
+			int32_t height; // [t 0 Agp -1
+
+			// ȉ̓[t̂
+			glm::vec3 center; // o^E
+			glm::vec3 extent;
+			uint8_t planeCache; // ŌɊptX^̕
+			void* pUserData;
+		};
+
+		// o^EŔ肵Ȃ[t ( E͐Ƃɕׂ )
+		struct Batch
+		{
+			collection::Vector<int32_t> leaves;
+			collection::Vector<float> centerX;
+			collection::Vector<float> centerY;
+			collection::Vector<float> centerZ;
+			collection::Vector<float> extentX;
+			collection::Vector<float> extentY;
+			collection::Vector<float> extentZ;
+			collection::Vector<uint8_t> planeCaches;
+			collection::Vector<uint8_t> results;
+		};
+
+		collection::Vector<AabbTree::Node> m_Nodes;
+		int32_t m_Root;
+		int32_t m_FreeList;
+
+		collection::Vector<int32_t> m_Stack;
+		AabbTree::Batch m_Batch;
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t index);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		int32_t Balance(int32_t index);
+		void Refit(int32_t index);
+
+		void CollectLeaves(int32_t index, collection::Vector<void*>& results);
+		AABBArray GatherBatch();
+
+		static AabbTree::TEST_RESULT Test(const Frustum& frustum, const glm::vec3& aabbMin, const glm::vec3& aabbMax);
+		static AabbTree::TEST_RESULT Test(const Sphere& sphere, const glm::vec3& aabbMin, const glm::vec3& aabbMax);
+
+		// \ʐς̔ ( }IԂƂ̃RXg )
+		static inline float GetArea(const glm::vec3& aabbMin, const glm::vec3& aabbMax)
+		{
+			glm::vec3 size = aabbMax - aabbMin;
+			return size.x * size.y + size.y * size.z + size.z * size.x;
+		}
+	};
+
+}
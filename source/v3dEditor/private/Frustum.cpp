@@ -2,10 +2,13 @@
 
 namespace ve {
 
-	void Frustum::Update(const glm::mat4 &viewProjMatrix)
+	void Frustum::Update(const glm::mat4 &viewProjMatrix, const glm::vec3& eyePos, float pixelScale)
 	{
 		Plane* plane;
 
+		m_EyePos = eyePos;
+		m_PixelScale = pixelScale;
+
 		// NearPlane
 		plane = &m_Planes[Frustum::PLANE_TYPE_NEAR];
 		plane->normal.x = viewProjMatrix[0].w + viewProjMatrix[0].z;
@@ -60,6 +63,16 @@ namespace ve {
 		return m_Planes[type];
 	}
 
+	const glm::vec3& Frustum::GetEyePos() const
+	{
+		return m_EyePos;
+	}
+
+	float Frustum::GetPixelScale() const
+	{
+		return m_PixelScale;
+	}
+
 	bool Frustum::Contains(const Sphere& sphere) const
 	{
 		const glm::vec3& center = sphere.center;
@@ -86,43 +99,149 @@ namespace ve {
 
 	bool Frustum::Contains(const AABB& aabb) const
 	{
+		glm::vec3 center = (aabb.minimum + aabb.maximum) * 0.5f;
+		glm::vec3 extent = (aabb.maximum - aabb.minimum) * 0.5f;
+
 		const Plane* pPlane = &(m_Planes[0]);
 		const Plane* pPlaneEnd = pPlane + 6;
 
-		const glm::vec3* pPointBegin = &(aabb.points[0]);
-		const glm::vec3* pPointEnd = pPointBegin + 8;
-		const glm::vec3* pPoint = NULL;
-
-		float dist;
-		uint32_t count;
-
 		while (pPlane != pPlaneEnd)
 		{
+			// @̕ɍł_ɂ΁AׂĂ̒_ɂ
 			const glm::vec3& norm = pPlane->normal;
+			float dist = glm::dot(norm, center) + pPlane->d;
+			float radius = glm::dot(glm::abs(norm), extent);
 
-			count = 8;
-			pPoint = pPointBegin;
-			while (pPoint != pPointEnd)
+			if ((dist + radius) < 0.0f)
 			{
-				dist = (norm.x * pPoint->x) + (norm.y * pPoint->y) + (norm.z * pPoint->z) + pPlane->d;
-				if (dist < 0.0f)
+				return false;
+			}
+
+			pPlane++;
+		}
+
+		return true;
+	}
+
+	void Frustum::ContainsBatch(const AABBArray& aabbs, uint32_t count, uint8_t* pPlaneCaches, uint8_t* pResults) const
+	{
+		glm::vec3 absNormals[6];
+
+		for (uint32_t i = 0; i < 6; i++)
+		{
+			absNormals[i] = glm::abs(m_Planes[i].normal);
+		}
+
+		uint32_t index = 0;
+
+#ifdef VE_SIMD_SSE
+		/************************/
+		/* 4  AABB  */
+		/************************/
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		uint32_t simdCount = count & ~static_cast<uint32_t>(3);
+
+		for (; index < simdCount; index += 4)
+		{
+			__m128 cx = _mm_loadu_ps(aabbs.pCenterX + index);
+			__m128 cy = _mm_loadu_ps(aabbs.pCenterY + index);
+			__m128 cz = _mm_loadu_ps(aabbs.pCenterZ + index);
+			__m128 ex = _mm_loadu_ps(aabbs.pExtentX + index);
+			__m128 ey = _mm_loadu_ps(aabbs.pExtentY + index);
+			__m128 ez = _mm_loadu_ps(aabbs.pExtentZ + index);
+
+			// ----------------------------------------------------------------------------------------------------
+			// Õt[ŊpʂŔ ( AABB ƂɕʂقȂ邽߁AWׂēǂݍ )
+			// ----------------------------------------------------------------------------------------------------
+
+			const Plane& plane0 = m_Planes[pPlaneCaches[index + 0]];
+			const Plane& plane1 = m_Planes[pPlaneCaches[index + 1]];
+			const Plane& plane2 = m_Planes[pPlaneCaches[index + 2]];
+			const Plane& plane3 = m_Planes[pPlaneCaches[index + 3]];
+
+			__m128 nx = _mm_setr_ps(plane0.normal.x, plane1.normal.x, plane2.normal.x, plane3.normal.x);
+			__m128 ny = _mm_setr_ps(plane0.normal.y, plane1.normal.y, plane2.normal.y, plane3.normal.y);
+			__m128 nz = _mm_setr_ps(plane0.normal.z, plane1.normal.z, plane2.normal.z, plane3.normal.z);
+			__m128 nd = _mm_setr_ps(plane0.d, plane1.d, plane2.d, plane3.d);
+
+			__m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, cx), _mm_mul_ps(ny, cy)), _mm_add_ps(_mm_mul_ps(nz, cz), nd));
+			__m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, nx), ex), _mm_mul_ps(_mm_andnot_ps(signMask, ny), ey)), _mm_mul_ps(_mm_andnot_ps(signMask, nz), ez));
+
+			int outsideMask = _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(dist, radius), zero));
+
+			// ----------------------------------------------------------------------------------------------------
+			// pȂ AABB ׂĂ̕ʂŔ
+			// ----------------------------------------------------------------------------------------------------
+
+			for (uint32_t i = 0; (i < 6) && (outsideMask != 0xF); i++)
+			{
+				const Plane& plane = m_Planes[i];
+				const glm::vec3& absNormal = absNormals[i];
+
+				dist = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.x), cx), _mm_mul_ps(_mm_set1_ps(plane.normal.y), cy)),
+					_mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.z), cz), _mm_set1_ps(plane.d)));
+
+				radius = _mm_add_ps(
+					_mm_add_ps(_mm_mul_ps(_mm_set1_ps(absNormal.x), ex), _mm_mul_ps(_mm_set1_ps(absNormal.y), ey)),
+					_mm_mul_ps(_mm_set1_ps(absNormal.z), ez));
+
+				int planeMask = _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(dist, radius), zero)) & ~outsideMask;
+				if (planeMask != 0)
 				{
-					VE_ASSERT(count > 0);
-					count--;
+					for (uint32_t j = 0; j < 4; j++)
+					{
+						if (planeMask & (1 << j))
+						{
+							pPlaneCaches[index + j] = static_cast<uint8_t>(i);
+						}
+					}
+
+					outsideMask |= planeMask;
 				}
+			}
 
-				pPoint++;
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				pResults[index + j] = (outsideMask & (1 << j)) ? 0 : 1;
 			}
+		}
+#endif //VE_SIMD_SSE
+
+		/**********************/
+		/* c AABB 𔻒 */
+		/**********************/
+
+		for (; index < count; index++)
+		{
+			glm::vec3 center(aabbs.pCenterX[index], aabbs.pCenterY[index], aabbs.pCenterZ[index]);
+			glm::vec3 extent(aabbs.pExtentX[index], aabbs.pExtentY[index], aabbs.pExtentZ[index]);
 
-			if (count == 0)
+			uint32_t cachedPlane = pPlaneCaches[index];
+			uint8_t result = 1;
+
+			for (uint32_t i = 0; i < 6; i++)
 			{
-				return false;
+				// Õt[Ŋpʂ画肷
+				uint32_t planeIndex = (i == 0) ? cachedPlane : ((i == cachedPlane) ? 0 : i);
+				const Plane& plane = m_Planes[planeIndex];
+
+				float dist = glm::dot(plane.normal, center) + plane.d;
+				float radius = glm::dot(absNormals[planeIndex], extent);
+
+				if ((dist + radius) < 0.0f)
+				{
+					pPlaneCaches[index] = static_cast<uint8_t>(planeIndex);
+					result = 0;
+					break;
+				}
 			}
 
-			pPlane++;
+			pResults[index] = result;
 		}
-
-		return true;
 	}
 
 }
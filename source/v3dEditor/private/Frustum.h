@@ -19,15 +19,23 @@ namespace ve {
 			PLANE_TYPE_RIGHT = 5,
 		};
 
-		void Update(const glm::mat4& viewProjMatrix);
+		// pixelScale : _̋ 1 ̈ʒuɂ钷 1 ̐AXN[Ő߂sNZ
+		void Update(const glm::mat4& viewProjMatrix, const glm::vec3& eyePos, float pixelScale);
 
 		const Plane& GetPlane(Frustum::PLANE_TYPE type) const;
+		const glm::vec3& GetEyePos() const;
+		float GetPixelScale() const;
 
 		bool Contains(const Sphere& sphere) const;
 		bool Contains(const AABB& aabb) const;
+		// count  AABB ܂Ƃ߂Ĕ肵A܂܂邩ꍇ pResults  1 AȌꍇ 0 
+		// pPlaneCaches  AABB ƂɍŌɊpʂŁAŏɂ̕ʂŔ肵ĂXV ( l 0 )
+		void ContainsBatch(const AABBArray& aabbs, uint32_t count, uint8_t* pPlaneCaches, uint8_t* pResults) const;
 
 	private:
 		Plane m_Planes[6];
+		glm::vec3 m_EyePos;
+		float m_PixelScale;
 	};
 
 }
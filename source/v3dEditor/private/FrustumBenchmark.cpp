@@ -0,0 +1,163 @@
+#include "FrustumBenchmark.h"
+
+#ifdef VE_BENCHMARK_FRUSTUM
+
+#include <chrono>
+#include "Logger.h"
+#include "Frustum.h"
+
+namespace ve {
+
+	void FrustumBenchmark::Run(LoggerPtr logger)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// AABB 쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		// 񓯂zuɂȂ悤ɁA͌Œ̎킩狁߂
+		uint32_t seed = 0x12345678;
+		auto random = [&seed]()
+		{
+			seed = seed * 1664525 + 1013904223;
+			return static_cast<float>(seed >> 8) / static_cast<float>(1 << 24);
+		};
+
+		collection::Vector<AABB> aabbList;
+		aabbList.reserve(FrustumBenchmark::AABB_COUNT);
+
+		collection::Vector<float> components;
+		components.resize(FrustumBenchmark::AABB_COUNT * 6);
+
+		float* pCenterX = components.data();
+		float* pCenterY = pCenterX + FrustumBenchmark::AABB_COUNT;
+		float* pCenterZ = pCenterY + FrustumBenchmark::AABB_COUNT;
+		float* pExtentX = pCenterZ + FrustumBenchmark::AABB_COUNT;
+		float* pExtentY = pExtentX + FrustumBenchmark::AABB_COUNT;
+		float* pExtentZ = pExtentY + FrustumBenchmark::AABB_COUNT;
+
+		for (uint32_t i = 0; i < FrustumBenchmark::AABB_COUNT; i++)
+		{
+			// ̓AOAEɂ܂̂悤ɁAJ̎͂ɎU΂点
+			glm::vec3 center((random() - 0.5f) * 200.0f, (random() - 0.5f) * 200.0f, (random() - 0.5f) * 200.0f);
+			glm::vec3 extent(random() * 4.0f + 0.1f, random() * 4.0f + 0.1f, random() * 4.0f + 0.1f);
+
+			aabbList.emplace_back(center - extent, center + extent);
+
+			pCenterX[i] = center.x;
+			pCenterY[i] = center.y;
+			pCenterZ[i] = center.z;
+			pExtentX[i] = extent.x;
+			pExtentY[i] = extent.y;
+			pExtentZ[i] = extent.z;
+		}
+
+		AABBArray aabbs;
+		aabbs.pCenterX = pCenterX;
+		aabbs.pCenterY = pCenterY;
+		aabbs.pCenterZ = pCenterZ;
+		aabbs.pExtentX = pExtentX;
+		aabbs.pExtentY = pExtentY;
+		aabbs.pExtentZ = pExtentZ;
+
+		// ----------------------------------------------------------------------------------------------------
+		// 쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		glm::vec3 eyePos(0.0f, 10.0f, -60.0f);
+		glm::mat4 viewMatrix = glm::lookAtRH(eyePos, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 projMatrix = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f);
+
+		Frustum frustum;
+		frustum.Update(projMatrix * viewMatrix, eyePos, 1.0f);
+
+		// ----------------------------------------------------------------------------------------------------
+		// v
+		// ----------------------------------------------------------------------------------------------------
+
+		// 񂠂̍ŒZ̎Ԃʂɂ
+
+		collection::Vector<uint8_t> planeCaches;
+		planeCaches.resize(FrustumBenchmark::AABB_COUNT, 0);
+
+		collection::Vector<uint8_t> results;
+		results.resize(FrustumBenchmark::AABB_COUNT, 0);
+
+		long long scalarTime = LLONG_MAX;
+		long long batchColdTime = LLONG_MAX;
+		long long batchWarmTime = LLONG_MAX;
+
+		uint32_t scalarVisibleCount = 0;
+		uint32_t batchVisibleCount = 0;
+
+		for (uint32_t iteration = 0; iteration < FrustumBenchmark::ITERATION_COUNT; iteration++)
+		{
+			/*******************/
+			/* AABB Ƃɔ */
+			/*******************/
+
+			auto startClock = std::chrono::high_resolution_clock::now();
+
+			uint32_t visibleCount = 0;
+
+			auto it_begin = aabbList.begin();
+			auto it_end = aabbList.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (frustum.Contains(*it) == true)
+				{
+					visibleCount++;
+				}
+			}
+
+			auto endClock = std::chrono::high_resolution_clock::now();
+			scalarTime = std::min(scalarTime, std::chrono::duration_cast<std::chrono::nanoseconds>(endClock - startClock).count());
+			scalarVisibleCount = visibleCount;
+
+			/*********************************************/
+			/* ܂Ƃ߂Ĕ ( ʂ̃LbVl ) */
+			/*********************************************/
+
+			std::fill(planeCaches.begin(), planeCaches.end(), static_cast<uint8_t>(0));
+
+			startClock = std::chrono::high_resolution_clock::now();
+			frustum.ContainsBatch(aabbs, FrustumBenchmark::AABB_COUNT, planeCaches.data(), results.data());
+			endClock = std::chrono::high_resolution_clock::now();
+
+			batchColdTime = std::min(batchColdTime, std::chrono::duration_cast<std::chrono::nanoseconds>(endClock - startClock).count());
+
+			/***********************************************************************/
+			/* ܂Ƃ߂Ĕ ( O̕ʂ̃LbVgpAʏ̕`Ɠ ) */
+			/***********************************************************************/
+
+			startClock = std::chrono::high_resolution_clock::now();
+			frustum.ContainsBatch(aabbs, FrustumBenchmark::AABB_COUNT, planeCaches.data(), results.data());
+			endClock = std::chrono::high_resolution_clock::now();
+
+			batchWarmTime = std::min(batchWarmTime, std::chrono::duration_cast<std::chrono::nanoseconds>(endClock - startClock).count());
+
+			batchVisibleCount = static_cast<uint32_t>(std::count(results.begin(), results.end(), static_cast<uint8_t>(1)));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ʂo
+		// ----------------------------------------------------------------------------------------------------
+
+		logger->PrintA(Logger::TYPE_INFO, "Frustum benchmark : AABB[%u] Iteration[%u]", FrustumBenchmark::AABB_COUNT, FrustumBenchmark::ITERATION_COUNT);
+		logger->PrintA(Logger::TYPE_INFO, "  Contains : %.3f us", static_cast<double>(scalarTime) / 1000.0);
+		logger->PrintA(Logger::TYPE_INFO, "  ContainsBatch ( Cold plane cache ) : %.3f us", static_cast<double>(batchColdTime) / 1000.0);
+		logger->PrintA(Logger::TYPE_INFO, "  ContainsBatch ( Warm plane cache ) : %.3f us", static_cast<double>(batchWarmTime) / 1000.0);
+
+		if (scalarVisibleCount == batchVisibleCount)
+		{
+			logger->PrintA(Logger::TYPE_INFO, "  Visible : %u", scalarVisibleCount);
+		}
+		else
+		{
+			logger->PrintA(Logger::TYPE_WARNING, "  The results do not match : Contains[%u] ContainsBatch[%u]", scalarVisibleCount, batchVisibleCount);
+		}
+	}
+
+}
+
+#endif //VE_BENCHMARK_FRUSTUM
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#ifdef VE_BENCHMARK_FRUSTUM
+
+namespace ve {
+
+	// Frustum::Contains ( AABB  )  Frustum::ContainsBatch ̏ԂrāAOɏo͂
+	// v̓[Xrhōs
+	class FrustumBenchmark final
+	{
+	public:
+		static void Run(LoggerPtr logger);
+
+	private:
+		static constexpr uint32_t AABB_COUNT = 4096;
+		static constexpr uint32_t ITERATION_COUNT = 1000;
+	};
+
+}
+
+#endif //VE_BENCHMARK_FRUSTUM
\ No newline at end of file
@@ -316,6 +316,29 @@ namespace ve {
 		return pMaterialSet->pipelines[type].handle;
 	}
 
+	size_t GraphicsFactory::GetBonePaletteSize(size_t boneCount)
+	{
+		if (boneCount == 0)
+		{
+			return 0;
+		}
+
+		if (boneCount > GraphicsFactory::BONE_PALETTE_MAX_SIZE)
+		{
+			// ؂グƂɑ傫ȂĂ܂߁Â܂܂ɂ
+			return boneCount;
+		}
+
+		size_t paletteSize = GraphicsFactory::BONE_PALETTE_MIN_SIZE;
+
+		while (paletteSize < boneCount)
+		{
+			paletteSize <<= 1;
+		}
+
+		return (paletteSize < GraphicsFactory::BONE_PALETTE_MAX_SIZE) ? paletteSize : GraphicsFactory::BONE_PALETTE_MAX_SIZE;
+	}
+
 	/*****************************/
 	/* private - GraphicsFactory */
 	/*****************************/
@@ -382,7 +405,11 @@ namespace ve {
 				{
 					GraphicsFactory::MaterialPipeline& pipeline = it->second.pipelines[i];
 
-					DeleteDeviceChild(pDeletingQueue, &pipeline.handle->m_pPipeline);
+					if (pipeline.handle != nullptr)
+					{
+						DeleteDeviceChild(pDeletingQueue, &pipeline.handle->m_pPipeline);
+					}
+
 					DeleteDeviceChild(pDeletingQueue, &pipeline.desc.vertexShader.pModule);
 					DeleteDeviceChild(pDeletingQueue, &pipeline.desc.tessellationControlShader.pModule);
 					DeleteDeviceChild(pDeletingQueue, &pipeline.desc.tessellationEvaluationShader.pModule);
@@ -602,6 +629,28 @@ namespace ve {
 			}
 		}
 
+		/*******************************/
+		/* bV - CX^VO */
+		/*******************************/
+
+		{
+			V3DDescriptorDesc descriptors[1];
+			descriptors[0].binding = 0;
+			descriptors[0].type = V3D_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+			descriptors[0].stageFlags = V3D_SHADER_STAGE_VERTEX;
+
+			GraphicsFactory::DescriptorSet& descriptorSet = m_DescriptorSets[GraphicsFactory::DST_MESH_INSTANCE];
+			VE_DEBUG_CODE(descriptorSet.debugName = L"Scene_MeshInstance");
+
+			if (pNativeDevice->CreateDescriptorSetLayout(
+				_countof(descriptors), descriptors, 1, 1,
+				&descriptorSet.pNativeLayout,
+				VE_INTERFACE_DEBUG_NAME(descriptorSet.debugName.c_str())) != V3D_OK)
+			{
+				return false;
+			}
+		}
+
 		/************************************************/
 		/* XN[Xy[XArGgIN[W */
 		/************************************************/
@@ -3282,6 +3331,9 @@ namespace ve {
 			shaderFlags ^= MATERIAL_SHADER_SKELETAL;
 		}
 
+		// {[̐߂bV͓pCvCL
+		boneCount = GraphicsFactory::GetBonePaletteSize(boneCount);
+
 		GraphicsFactory::MaterialSetKey materialSetKey = GraphicsFactory::MaterialSetKey(shaderFlags, boneCount, polygonMode, cullMode, blendMode);
 
 		auto it_material_set = m_MaterialSetMap.find(materialSetKey);
@@ -3297,6 +3349,13 @@ namespace ve {
 			return false;
 		}
 
+		// CX^VO̓J[̃pCvCgp ( VhEAZNg̓CX^VOȂpCvCƓ̂ɂȂ )
+		if (shaderFlags & MATERIAL_SHADER_INSTANCING)
+		{
+			*ppMaterialSet = &it_material_set->second;
+			return true;
+		}
+
 		if (CreateMaterialSet_Shadow(it_material_set->second.pipelines[GraphicsFactory::MPT_SHADOW], shaderFlags, createPipeline, boneCount, vertexStride) == false)
 		{
 			return false;
@@ -3422,15 +3481,19 @@ namespace ve {
 				constants[0].size = sizeof(glm::mat4);
 			}
 
-			IV3DDescriptorSetLayout* descriptorSetLayouts[2] =
+			// CX^VO̓Zbg 2 ŃCX^X̔zQƂ
+			IV3DDescriptorSetLayout* descriptorSetLayouts[3] =
 			{
 				m_DescriptorSets[GraphicsFactory::DST_MESH].pNativeLayout,
 				pNativeDescriptorSetLayout,
+				m_DescriptorSets[GraphicsFactory::DST_MESH_INSTANCE].pNativeLayout,
 			};
 
+			uint32_t descriptorSetLayoutCount = (shaderFlags & MATERIAL_SHADER_INSTANCING) ? 3 : 2;
+
 			if (m_pDeviceContext->GetNativeDevicePtr()->CreatePipelineLayout(
 				static_cast<uint32_t>(constants.size()), constants.data(),
-				_countof(descriptorSetLayouts), descriptorSetLayouts,
+				descriptorSetLayoutCount, descriptorSetLayouts,
 				&it_material_pipeline->second.pNativeLayout, VE_INTERFACE_DEBUG_NAME(it_material_pipeline->second.debugName.c_str())) != V3D_OK)
 			{
 				pNativeDescriptorSetLayout->Release();
@@ -3486,6 +3549,19 @@ namespace ve {
 				options.AddMacroDefinition("TRANSPARENCY_ENABLE");
 			}
 
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
+			{
+				options.AddMacroDefinition("PACKED_VERTEX_ENABLE");
+			}
+
+			if (shaderFlags & MATERIAL_SHADER_INSTANCING)
+			{
+				StringA instanceCountValue = std::to_string(GraphicsFactory::INSTANCE_BATCH_MAX_COUNT);
+
+				options.AddMacroDefinition("INSTANCING_ENABLE");
+				options.AddMacroDefinition("INSTANCE_COUNT", instanceCountValue.c_str());
+			}
+
 			options.SetOptimize(true);
 
 			vsc::Compiler vertCompiler;
@@ -3562,55 +3638,96 @@ namespace ve {
 			pipelineDesc.fragmentShader.pModule = pFragShaderModule;
 			pipelineDesc.fragmentShader.pEntryPointName = SHADER_ENTRY_POINT_NAME;
 
-			// pos
-			pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-			pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
-			pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
-			pipelineDesc.vertexInput.elementCount = ++elementIndex;
-
-			if (shaderFlags & MATERIAL_SHADER_TEXTURE_MASK)
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
 			{
-				// uv
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 12;
+				// pos
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16B16A16_UNORM;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
-			}
 
-			// normal
-			pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-			pipelineDesc.vertexInput.pElements[elementIndex].location = 2;
-			pipelineDesc.vertexInput.pElements[elementIndex].offset = 20;
-			pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				if (shaderFlags & MATERIAL_SHADER_TEXTURE_MASK)
+				{
+					// uv
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 8;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
 
-			if (shaderFlags & MATERIAL_SHADER_BUMP_TEXTURE)
+				// tangent frame ( normal + tangent )
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16B16A16_SNORM;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 2;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 12;
+				pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 20;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UNORM;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 24;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+			}
+			else
 			{
-				// tangent
+				// pos
 				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 3;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 32;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
 
-				// binormal
+				if (shaderFlags & MATERIAL_SHADER_TEXTURE_MASK)
+				{
+					// uv
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 12;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+
+				// normal
 				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 4;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 44;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 2;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 20;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
-			}
 
-			if (shaderFlags & MATERIAL_SHADER_SKELETAL)
-			{
-				// indices
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
-				pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				if (shaderFlags & MATERIAL_SHADER_BUMP_TEXTURE)
+				{
+					// tangent
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 3;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 32;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// binormal
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 4;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 44;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
 
-				// weights
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
-				pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
 			}
 
 			pipelineDesc.vertexInput.pLayouts->binding = 0;
@@ -3794,6 +3911,11 @@ namespace ve {
 				options.AddMacroDefinition("DIFFUSE_TEXTURE_ENABLE");
 			}
 
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
+			{
+				options.AddMacroDefinition("PACKED_VERTEX_ENABLE");
+			}
+
 			options.SetOptimize(true);
 
 			vsc::Compiler vertCompiler;
@@ -3863,34 +3985,69 @@ namespace ve {
 			pipelineDesc.fragmentShader.pModule = pFragShaderModule;
 			pipelineDesc.fragmentShader.pEntryPointName = SHADER_ENTRY_POINT_NAME;
 
-			// pos
-			pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-			pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
-			pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
-			pipelineDesc.vertexInput.elementCount = ++elementIndex;
-
-			if (shaderFlags & MATERIAL_SHADER_DIFFUSE_TEXTURE)
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
 			{
-				// uv
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 12;
+				// pos
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16B16A16_UNORM;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
-			}
 
-			if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				if (shaderFlags & MATERIAL_SHADER_DIFFUSE_TEXTURE)
+				{
+					// uv
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 8;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 20;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UNORM;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 24;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+			}
+			else
 			{
-				// indices
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
+				// pos
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
 
-				// weights
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
-				pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				if (shaderFlags & MATERIAL_SHADER_DIFFUSE_TEXTURE)
+				{
+					// uv
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 1;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 12;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
 			}
 
 			pipelineDesc.vertexInput.pLayouts->binding = 0;
@@ -3959,6 +4116,11 @@ namespace ve {
 				options.AddMacroDefinition("BONE_COUNT", boneCountValue.c_str());
 			}
 
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
+			{
+				options.AddMacroDefinition("PACKED_VERTEX_ENABLE");
+			}
+
 			options.SetOptimize(true);
 
 			vsc::Compiler vertCompiler;
@@ -4026,25 +4188,51 @@ namespace ve {
 			pipelineDesc.fragmentShader.pModule = pFragShaderModule;
 			pipelineDesc.fragmentShader.pEntryPointName = SHADER_ENTRY_POINT_NAME;
 
-			// pos
-			pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
-			pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
-			pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
-			pipelineDesc.vertexInput.elementCount = ++elementIndex;
-
-			if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+			if (shaderFlags & MATERIAL_SHADER_PACKED_VERTEX)
 			{
-				// indices
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
+				// pos
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R16G16B16A16_UNORM;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
 
-				// weights
-				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
-				pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
-				pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 20;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R8G8B8A8_UNORM;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 24;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
+			}
+			else
+			{
+				// pos
+				pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32_SFLOAT;
+				pipelineDesc.vertexInput.pElements[elementIndex].location = 0;
+				pipelineDesc.vertexInput.pElements[elementIndex].offset = 0;
 				pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+				if (shaderFlags & MATERIAL_SHADER_SKELETAL)
+				{
+					// indices
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SINT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 5;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 56;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+
+					// weights
+					pipelineDesc.vertexInput.pElements[elementIndex].format = V3D_FORMAT_R32G32B32A32_SFLOAT;
+					pipelineDesc.vertexInput.pElements[elementIndex].location = 6;
+					pipelineDesc.vertexInput.pElements[elementIndex].offset = 72;
+					pipelineDesc.vertexInput.elementCount = ++elementIndex;
+				}
 			}
 
 			pipelineDesc.vertexInput.pLayouts->binding = 0;
@@ -4101,7 +4289,11 @@ namespace ve {
 					GraphicsFactory::MaterialPipeline& pipeline = it->second.pipelines[i];
 
 					pipeline.desc.pRenderPass = nullptr;
-					DeleteDeviceChild(pDeletingQueue, &pipeline.handle->m_pPipeline);
+
+					if (pipeline.handle != nullptr)
+					{
+						DeleteDeviceChild(pDeletingQueue, &pipeline.handle->m_pPipeline);
+					}
 				}
 			}
 		}
@@ -88,6 +88,21 @@ namespace ve {
 		uint32_t key;
 	};
 
+	// ʎqo[ebNẌʒu𕜌 ( position = positionOffset + packedPosition * positionScale )
+	struct MeshDequantizeUniform
+	{
+		glm::vec4 positionScale;
+		glm::vec4 positionOffset;
+	};
+
+	// CX^VOŕ`悷郁bṼCX^XƂ̃f[^ ( VF[_[̔z̗vf )
+	struct MeshInstanceUniform
+	{
+		glm::mat4 worldMat;
+		uint32_t key;
+		uint32_t reserved[3];
+	};
+
 	struct DirectionalLightingConstant
 	{
 		glm::vec4 eyePos;
@@ -264,8 +279,9 @@ namespace ve {
 			DST_SSAO = 3,
 			DST_DIRECTIONAL_LIGHTING_O = 4,
 			DST_FINISH_LIGHTING = 5,
+			DST_MESH_INSTANCE = 6,
 
-			DST_MAX = 6,
+			DST_MAX = 7,
 		};
 
 		enum PIPELINE_TYPE
@@ -360,7 +376,21 @@ namespace ve {
 		PipelineHandlePtr GetPipelineHandle(GraphicsFactory::STAGE_TYPE type, GraphicsFactory::STAGE_SUBPASS_TYPE subpassType);
 		PipelineHandlePtr GetPipelineHandle(MATERIAL_PIPELINE_TYPE type, uint32_t shaderFlags, size_t boneCount, uint32_t vertexStride, V3D_POLYGON_MODE polygonMode, V3D_CULL_MODE cullMode, BLEND_MODE blendMode);
 
+		// x̃CX^VOŕ`łCX^X̍ő吔 ( VF[_[̃CX^X̔z̗vf )
+		static constexpr uint32_t INSTANCE_BATCH_MAX_COUNT = 128;
+
+		// VF[_[̃{[pbg ( [hs̔z ) ̗vfԂ
+		// pCvC̑gݍ킹炷߁A{[̐ 16 32 64 128 BONE_PALETTE_MAX_SIZE ɐ؂グ ( {[ꍇ 0 )
+		// BONE_PALETTE_MAX_SIZE 𒴂ꍇ͐؂グɃ{[̐Ԃ
+		static size_t GetBonePaletteSize(size_t boneCount);
+
 	private:
+		// {[pbg̍ŏ̗vf
+		static constexpr size_t BONE_PALETTE_MIN_SIZE = 16;
+		// {[pbg̍ő̗vf
+		// jtH[obt@[ ( worldMatrices key positionScale positionOffset )  maxUniformBufferRange ̕ۏ؂Ăŏl 16384 oCgɎ܂鐔
+		static constexpr size_t BONE_PALETTE_MAX_SIZE = (16384 - sizeof(glm::vec4) - sizeof(MeshDequantizeUniform)) / sizeof(glm::mat4);
+
 		// ----------------------------------------------------------------------------------------------------
 		// 񋓌^
 		// ----------------------------------------------------------------------------------------------------
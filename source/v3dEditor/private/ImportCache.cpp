@@ -0,0 +1,188 @@
+#include "ImportCache.h"
+
+namespace ve {
+
+	/************************/
+	/* public - ImportCache */
+	/************************/
+
+	bool ImportCache::GetFilePath(
+		const wchar_t* pSourceFilePath,
+		const collection::Vector<StringW>& dependentFilePathes,
+		const ModelSourceConfig& sourceConfig,
+		const ModelRendererConfig& rendererConfig,
+		StringW& filePath)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// \[Xt@C̓ẽnbV
+		// ----------------------------------------------------------------------------------------------------
+
+		uint64_t hash = ImportCache::FNV_OFFSET_BASIS;
+
+		if (ImportCache::HashFile(pSourceFilePath, hash) == false)
+		{
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// \[Xt@CQƂt@C̃nbV
+		// ----------------------------------------------------------------------------------------------------
+
+		// QƂt@C̍ւAǉA폜łnbVς悤ɃpXƗL
+
+		auto it_begin = dependentFilePathes.begin();
+		auto it_end = dependentFilePathes.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			hash = ImportCache::Hash(hash, it->c_str(), sizeof(wchar_t) * it->size());
+
+			uint8_t exists = (ImportCache::HashFile(it->c_str(), hash) == true) ? 1 : 0;
+			hash = ImportCache::Hash(hash, &exists, sizeof(exists));
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ݒ̃nbV
+		// ----------------------------------------------------------------------------------------------------
+
+		// \̂̃pfBO܂߂Ȃ悤Ƀo[Ƃɉ
+
+		uint32_t version = ImportCache::VERSION;
+		hash = ImportCache::Hash(hash, &version, sizeof(version));
+
+		hash = ImportCache::Hash(hash, &sourceConfig.flags, sizeof(sourceConfig.flags));
+		hash = ImportCache::Hash(hash, &sourceConfig.rotation, sizeof(sourceConfig.rotation));
+		hash = ImportCache::Hash(hash, &sourceConfig.scale, sizeof(sourceConfig.scale));
+		hash = ImportCache::Hash(hash, &sourceConfig.pathType, sizeof(sourceConfig.pathType));
+
+		uint8_t flags[3] =
+		{
+			(rendererConfig.optimizeEnable == true) ? 1 : 0,
+			(rendererConfig.smoosingEnable == true) ? 1 : 0,
+			(rendererConfig.packedVertexEnable == true) ? 1 : 0,
+		};
+
+		hash = ImportCache::Hash(hash, flags, sizeof(flags));
+		hash = ImportCache::Hash(hash, &rendererConfig.smoosingCos, sizeof(rendererConfig.smoosingCos));
+
+		// ----------------------------------------------------------------------------------------------------
+		// t@CpX
+		// ----------------------------------------------------------------------------------------------------
+
+		if (ImportCache::GetDirectoryPath(filePath) == false)
+		{
+			return false;
+		}
+
+		wchar_t fileName[32];
+		wsprintf(fileName, L"%08x%08x.skm", static_cast<uint32_t>(hash >> 32), static_cast<uint32_t>(hash));
+
+		filePath += fileName;
+
+		return true;
+	}
+
+	void ImportCache::GetTemporaryFilePath(const wchar_t* pFilePath, StringW& temporaryFilePath)
+	{
+		temporaryFilePath = pFilePath;
+		temporaryFilePath += L".tmp";
+	}
+
+	bool ImportCache::Commit(const wchar_t* pTemporaryFilePath, const wchar_t* pFilePath)
+	{
+		if (MoveFileExW(pTemporaryFilePath, pFilePath, MOVEFILE_REPLACE_EXISTING) == FALSE)
+		{
+			DeleteFileW(pTemporaryFilePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	/*************************/
+	/* private - ImportCache */
+	/*************************/
+
+	bool ImportCache::GetDirectoryPath(StringW& dirPath)
+	{
+		wchar_t tempPath[MAX_PATH + 1];
+
+		DWORD tempPathLength = GetTempPathW(_countof(tempPath), tempPath);
+		if ((tempPathLength == 0) || (tempPathLength > MAX_PATH))
+		{
+			return false;
+		}
+
+		dirPath = tempPath;
+
+		// fBNgɑ݂ꍇ͍쐬Ɏs邪Â܂܎gp
+
+		dirPath += VE_NAME_W;
+		dirPath += L"\\";
+		CreateDirectoryW(dirPath.c_str(), nullptr);
+
+		dirPath += L"ImportCache\\";
+		CreateDirectoryW(dirPath.c_str(), nullptr);
+
+		if (PathIsDirectoryW(dirPath.c_str()) == FALSE)
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ImportCache::HashFile(const wchar_t* pFilePath, uint64_t& hash)
+	{
+		HANDLE fileHandle = CreateFileW(pFilePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		collection::Vector<uint8_t> buffer;
+		buffer.resize(ImportCache::READ_BUFFER_SIZE);
+
+		uint64_t fileSize = 0;
+		DWORD readSize = 0;
+
+		do
+		{
+			if (ReadFile(fileHandle, buffer.data(), ImportCache::READ_BUFFER_SIZE, &readSize, nullptr) == FALSE)
+			{
+				CloseHandle(fileHandle);
+				return false;
+			}
+
+			hash = ImportCache::Hash(hash, buffer.data(), readSize);
+			fileSize += readSize;
+
+		} while (readSize > 0);
+
+		CloseHandle(fileHandle);
+
+		// Փ˂ɂ邽߁At@C̃TCY
+		hash = ImportCache::Hash(hash, &fileSize, sizeof(fileSize));
+
+		return true;
+	}
+
+	uint64_t ImportCache::Hash(uint64_t hash, const void* pData, size_t size)
+	{
+		// FNV-1a
+
+		const uint8_t* pByte = static_cast<const uint8_t*>(pData);
+		const uint8_t* pByteEnd = pByte + size;
+
+		while (pByte != pByteEnd)
+		{
+			hash ^= *pByte;
+			hash *= ImportCache::FNV_PRIME;
+
+			pByte++;
+		}
+
+		return hash;
+	}
+
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+namespace ve {
+
+	class ImportCache final
+	{
+	public:
+		// LbVt@C̃pX擾
+		// t@C̓\[Xt@CA\[Xt@CQƂt@C ( dependentFilePathes ) ̓eƃC|[g̐ݒ肩狁߂nbVɂȂ
+		static bool GetFilePath(
+			const wchar_t* pSourceFilePath,
+			const collection::Vector<StringW>& dependentFilePathes,
+			const ModelSourceConfig& sourceConfig,
+			const ModelRendererConfig& rendererConfig,
+			StringW& filePath);
+
+		// ݒ̃LbVt@C̃pX擾
+		static void GetTemporaryFilePath(const wchar_t* pFilePath, StringW& temporaryFilePath);
+
+		// ݏILbVt@Cu
+		static bool Commit(const wchar_t* pTemporaryFilePath, const wchar_t* pFilePath);
+
+	private:
+		// LbV̌`A܂͍쐬郁bV̓eύXꍇ̓CNg
+		static constexpr uint32_t VERSION = 3;
+
+		static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+		static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+		static constexpr uint32_t READ_BUFFER_SIZE = 1024 * 1024;
+
+		static bool GetDirectoryPath(StringW& dirPath);
+		static bool HashFile(const wchar_t* pFilePath, uint64_t& hash);
+		static uint64_t Hash(uint64_t hash, const void* pData, size_t size);
+	};
+
+}
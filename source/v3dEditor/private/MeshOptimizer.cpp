@@ -0,0 +1,893 @@
+#include "MeshOptimizer.h"
+
+namespace ve {
+
+	/**************************/
+	/* public - MeshOptimizer */
+	/**************************/
+
+	void MeshOptimizer::OptimizeVertexCache(uint32_t* pIndices, uint32_t indexCount, uint32_t vertexCount)
+	{
+		uint32_t faceCount = indexCount / 3;
+		if (faceCount <= 1)
+		{
+			return;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _ɗאڂgCAÕXg쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<uint32_t> valences;
+		collection::Vector<uint32_t> adjacencyOffsets;
+		collection::Vector<uint32_t> adjacencyFaces;
+
+		valences.resize(vertexCount, 0);
+		adjacencyOffsets.resize(vertexCount + 1, 0);
+		adjacencyFaces.resize(faceCount * 3);
+
+		for (uint32_t i = 0; i < faceCount * 3; i++)
+		{
+			VE_ASSERT(pIndices[i] < vertexCount);
+			valences[pIndices[i]]++;
+		}
+
+		for (uint32_t i = 0; i < vertexCount; i++)
+		{
+			adjacencyOffsets[i + 1] = adjacencyOffsets[i] + valences[i];
+			valences[i] = 0;
+		}
+
+		for (uint32_t i = 0; i < faceCount * 3; i++)
+		{
+			uint32_t vertexIndex = pIndices[i];
+			adjacencyFaces[adjacencyOffsets[vertexIndex] + valences[vertexIndex]++] = i / 3;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// XRA߂
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<int32_t> cachePositions;
+		collection::Vector<float> vertexScores;
+		collection::Vector<uint8_t> faceAdded;
+
+		cachePositions.resize(vertexCount, -1);
+		vertexScores.resize(vertexCount);
+		faceAdded.resize(faceCount, 0);
+
+		for (uint32_t i = 0; i < vertexCount; i++)
+		{
+			vertexScores[i] = MeshOptimizer::GetVertexScore(-1, valences[i]);
+		}
+
+		uint32_t bestFace = 0;
+		float bestScore = -1.0f;
+
+		for (uint32_t i = 0; i < faceCount; i++)
+		{
+			const uint32_t* pFace = &pIndices[i * 3];
+			float score = vertexScores[pFace[0]] + vertexScores[pFace[1]] + vertexScores[pFace[2]];
+
+			if (bestScore < score)
+			{
+				bestFace = i;
+				bestScore = score;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// XRA̍gCAO珇ɕׂ
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<uint32_t> newIndices;
+		newIndices.reserve(faceCount * 3);
+
+		uint32_t cache[MeshOptimizer::CACHE_SIZE + 3];
+		uint32_t newCache[MeshOptimizer::CACHE_SIZE + 3];
+		uint32_t cacheCount = 0;
+
+		uint32_t searchFace = 0;
+
+		for (uint32_t i = 0; i < faceCount; i++)
+		{
+			if (bestFace == ~0U)
+			{
+				// LbV̒_gpgCAOȂ̂ŁAo͂̃gCAO玟I
+				while (faceAdded[searchFace] != 0)
+				{
+					searchFace++;
+				}
+
+				bestFace = searchFace;
+			}
+
+			const uint32_t* pFace = &pIndices[bestFace * 3];
+
+			newIndices.push_back(pFace[0]);
+			newIndices.push_back(pFace[1]);
+			newIndices.push_back(pFace[2]);
+
+			faceAdded[bestFace] = 1;
+
+			/**********************************************/
+			/* o͂gCAOאڃXgO */
+			/**********************************************/
+
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				uint32_t vertexIndex = pFace[j];
+
+				uint32_t* pAdjacency = &adjacencyFaces[adjacencyOffsets[vertexIndex]];
+				uint32_t* pAdjacencyEnd = pAdjacency + valences[vertexIndex];
+
+				while (pAdjacency != pAdjacencyEnd)
+				{
+					if (*pAdjacency == bestFace)
+					{
+						*pAdjacency = *(pAdjacencyEnd - 1);
+						valences[vertexIndex]--;
+						break;
+					}
+
+					pAdjacency++;
+				}
+			}
+
+			/********************/
+			/* LbVXV */
+			/********************/
+
+			uint32_t newCacheCount = 0;
+
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				if ((j > 0) && ((pFace[j] == pFace[0]) || ((j > 1) && (pFace[j] == pFace[1]))))
+				{
+					// kނĂgCAO
+					continue;
+				}
+
+				newCache[newCacheCount++] = pFace[j];
+			}
+
+			for (uint32_t j = 0; j < cacheCount; j++)
+			{
+				uint32_t vertexIndex = cache[j];
+
+				if ((vertexIndex != pFace[0]) && (vertexIndex != pFace[1]) && (vertexIndex != pFace[2]))
+				{
+					newCache[newCacheCount++] = vertexIndex;
+				}
+			}
+
+			for (uint32_t j = 0; j < newCacheCount; j++)
+			{
+				uint32_t vertexIndex = newCache[j];
+
+				cachePositions[vertexIndex] = (j < MeshOptimizer::CACHE_SIZE) ? static_cast<int32_t>(j) : -1;
+				vertexScores[vertexIndex] = MeshOptimizer::GetVertexScore(cachePositions[vertexIndex], valences[vertexIndex]);
+			}
+
+			/****************************************************************/
+			/* LbV̒_ɗאڂgCAO玟̌T */
+			/****************************************************************/
+
+			bestFace = ~0U;
+			bestScore = -1.0f;
+
+			for (uint32_t j = 0; j < newCacheCount; j++)
+			{
+				uint32_t vertexIndex = newCache[j];
+
+				const uint32_t* pAdjacency = &adjacencyFaces[adjacencyOffsets[vertexIndex]];
+				const uint32_t* pAdjacencyEnd = pAdjacency + valences[vertexIndex];
+
+				while (pAdjacency != pAdjacencyEnd)
+				{
+					uint32_t faceIndex = *pAdjacency;
+					const uint32_t* pAdjacencyFace = &pIndices[faceIndex * 3];
+
+					float score = vertexScores[pAdjacencyFace[0]] + vertexScores[pAdjacencyFace[1]] + vertexScores[pAdjacencyFace[2]];
+
+					if (bestScore < score)
+					{
+						bestFace = faceIndex;
+						bestScore = score;
+					}
+
+					pAdjacency++;
+				}
+			}
+
+			cacheCount = std::min(newCacheCount, MeshOptimizer::CACHE_SIZE);
+			memcpy_s(cache, sizeof(cache), newCache, sizeof(uint32_t) * cacheCount);
+		}
+
+		memcpy_s(pIndices, sizeof(uint32_t) * indexCount, newIndices.data(), sizeof(uint32_t) * newIndices.size());
+	}
+
+	void MeshOptimizer::AnalyzeVertexCache(const uint32_t* pIndices, uint32_t indexCount, uint32_t vertexCount, float& acmr, float& atvr)
+	{
+		acmr = 0.0f;
+		atvr = 0.0f;
+
+		uint32_t faceCount = indexCount / 3;
+		if (faceCount == 0)
+		{
+			return;
+		}
+
+		// FIFO LbVV~[g
+		// ŌɃLbV֓ꂽ ANALYZE_CACHE_SIZE ȏ̒_Ă΁AɒǂoĂ
+
+		collection::Vector<uint32_t> timestamps;
+		timestamps.resize(vertexCount, 0);
+
+		uint32_t timestamp = MeshOptimizer::ANALYZE_CACHE_SIZE + 1;
+		uint32_t missCount = 0;
+		uint32_t usedVertexCount = 0;
+
+		const uint32_t* pIndex = pIndices;
+		const uint32_t* pIndexEnd = pIndex + faceCount * 3;
+
+		while (pIndex != pIndexEnd)
+		{
+			VE_ASSERT(*pIndex < vertexCount);
+
+			uint32_t& vertexTimestamp = timestamps[*pIndex];
+
+			if (vertexTimestamp == 0)
+			{
+				usedVertexCount++;
+			}
+
+			if ((timestamp - vertexTimestamp) > MeshOptimizer::ANALYZE_CACHE_SIZE)
+			{
+				vertexTimestamp = timestamp++;
+				missCount++;
+			}
+
+			pIndex++;
+		}
+
+		acmr = static_cast<float>(missCount) / static_cast<float>(faceCount);
+		atvr = static_cast<float>(missCount) / static_cast<float>(usedVertexCount);
+	}
+
+	float MeshOptimizer::GetFrontFaceSign(const glm::vec3* pPositions, const glm::vec3* pNormals, const uint32_t* pIndices, uint32_t indexCount)
+	{
+		// C|[g̐ݒ ( FlipFace ) ɂĊς邽߁A_̖@Ɠʂ\ʂƂ
+
+		float sum = 0.0f;
+
+		const uint32_t* pIndex = pIndices;
+		const uint32_t* pIndexEnd = pIndex + (indexCount / 3) * 3;
+
+		while (pIndex != pIndexEnd)
+		{
+			const glm::vec3& p0 = pPositions[pIndex[0]];
+			const glm::vec3& p1 = pPositions[pIndex[1]];
+			const glm::vec3& p2 = pPositions[pIndex[2]];
+
+			glm::vec3 faceNormal = glm::cross(p1 - p0, p2 - p0);
+			glm::vec3 vertexNormal = pNormals[pIndex[0]] + pNormals[pIndex[1]] + pNormals[pIndex[2]];
+
+			sum += (glm::dot(faceNormal, vertexNormal) >= 0.0f) ? 1.0f : -1.0f;
+
+			pIndex += 3;
+		}
+
+		return (sum >= 0.0f) ? 1.0f : -1.0f;
+	}
+
+	void MeshOptimizer::BuildClusters(
+		const glm::vec3* pPositions, uint32_t vertexCount,
+		const uint32_t* pIndices, uint32_t firstIndex, uint32_t indexCount,
+		float frontFaceSign,
+		collection::Vector<MeshOptimizer::Cluster>& clusters)
+	{
+		uint32_t faceCount = indexCount / 3;
+		if (faceCount == 0)
+		{
+			return;
+		}
+
+		// _LbV̍œK̕т͋ԓIɂ܂Ƃ܂Ă邽߁A擪珇ɋ؂
+		// NX^[Ɋ܂܂Ă钸_́ANX^[̔ԍ + 1 L^Ĕ肷
+
+		collection::Vector<uint32_t> vertexClusters;
+		vertexClusters.resize(vertexCount, 0);
+
+		uint32_t clusterStamp = 1;
+
+		MeshOptimizer::Cluster cluster{};
+		cluster.firstIndex = 0;
+
+		uint32_t clusterFaceCount = 0;
+		uint32_t clusterVertexCount = 0;
+
+		for (uint32_t i = 0; i < faceCount; i++)
+		{
+			const uint32_t* pFace = &pIndices[i * 3];
+
+			uint32_t newVertexCount = 0;
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				VE_ASSERT(pFace[j] < vertexCount);
+
+				if ((vertexClusters[pFace[j]] != clusterStamp) &&
+					((j == 0) || (pFace[j] != pFace[0])) &&
+					((j < 2) || (pFace[j] != pFace[1])))
+				{
+					newVertexCount++;
+				}
+			}
+
+			if ((clusterFaceCount == MeshOptimizer::CLUSTER_MAX_TRIANGLE_COUNT) ||
+				(clusterVertexCount + newVertexCount > MeshOptimizer::CLUSTER_MAX_VERTEX_COUNT))
+			{
+				cluster.indexCount = clusterFaceCount * 3;
+				MeshOptimizer::ComputeClusterBounds(pPositions, &pIndices[cluster.firstIndex], frontFaceSign, cluster);
+
+				cluster.firstIndex += firstIndex;
+				clusters.push_back(cluster);
+
+				cluster.firstIndex = i * 3;
+				clusterFaceCount = 0;
+				clusterVertexCount = 0;
+				clusterStamp++;
+
+				newVertexCount = 3;
+			}
+
+			vertexClusters[pFace[0]] = clusterStamp;
+			vertexClusters[pFace[1]] = clusterStamp;
+			vertexClusters[pFace[2]] = clusterStamp;
+
+			clusterFaceCount++;
+			clusterVertexCount += newVertexCount;
+		}
+
+		cluster.indexCount = clusterFaceCount * 3;
+		MeshOptimizer::ComputeClusterBounds(pPositions, &pIndices[cluster.firstIndex], frontFaceSign, cluster);
+
+		cluster.firstIndex += firstIndex;
+		clusters.push_back(cluster);
+	}
+
+	uint32_t MeshOptimizer::Simplify(
+		const glm::vec3* pPositions, const uint32_t* pVertexKeys, uint32_t vertexCount,
+		const uint32_t* pSrcIndices, uint32_t srcIndexCount,
+		uint32_t targetIndexCount,
+		uint32_t* pDstIndices, float& error)
+	{
+		error = 0.0f;
+
+		collection::Vector<uint32_t> indices;
+		indices.assign(pSrcIndices, pSrcIndices + srcIndexCount);
+
+		uint32_t indexCount = srcIndexCount;
+		if ((indexCount / 3) <= 1)
+		{
+			memcpy_s(pDstIndices, sizeof(uint32_t) * srcIndexCount, indices.data(), sizeof(uint32_t) * indexCount);
+			return indexCount;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ʒuɂ钸_܂Ƃ߂
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<uint32_t> positionRemap;
+		collection::Vector<uint8_t> vertexLocks;
+
+		positionRemap.resize(vertexCount);
+		vertexLocks.resize(vertexCount, 0);
+
+		{
+			collection::Vector<uint32_t> sortedVertices = indices;
+
+			std::sort(sortedVertices.begin(), sortedVertices.end());
+			sortedVertices.erase(std::unique(sortedVertices.begin(), sortedVertices.end()), sortedVertices.end());
+
+			std::sort(sortedVertices.begin(), sortedVertices.end(), [pPositions](uint32_t lh, uint32_t rh)
+			{
+				const glm::vec3& lhPos = pPositions[lh];
+				const glm::vec3& rhPos = pPositions[rh];
+
+				if (lhPos.x != rhPos.x) { return lhPos.x < rhPos.x; }
+				if (lhPos.y != rhPos.y) { return lhPos.y < rhPos.y; }
+				if (lhPos.z != rhPos.z) { return lhPos.z < rhPos.z; }
+
+				return lh < rh;
+			});
+
+			uint32_t sortedVertexCount = static_cast<uint32_t>(sortedVertices.size());
+			uint32_t first = 0;
+
+			while (first < sortedVertexCount)
+			{
+				const glm::vec3& pos = pPositions[sortedVertices[first]];
+
+				uint32_t last = first + 1;
+				while ((last < sortedVertexCount) && (pPositions[sortedVertices[last]] == pos))
+				{
+					last++;
+				}
+
+				// ʒuɕ̒_ꍇ͌p ( UVA@Ȃ ) Ȃ̂ŃbN
+				uint8_t lock = ((last - first) > 1) ? 1 : 0;
+
+				for (uint32_t i = first; i < last; i++)
+				{
+					positionRemap[sortedVertices[i]] = sortedVertices[first];
+					vertexLocks[sortedVertices[i]] = lock;
+				}
+
+				first = last;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// JĂGbWA񑽗l̂̃GbW̒_bN
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			collection::Vector<uint64_t> edges;
+			edges.reserve(indexCount);
+
+			for (uint32_t i = 0; i < indexCount; i += 3)
+			{
+				for (uint32_t j = 0; j < 3; j++)
+				{
+					uint32_t v0 = positionRemap[indices[i + j]];
+					uint32_t v1 = positionRemap[indices[i + ((j + 1) % 3)]];
+
+					if (v0 != v1)
+					{
+						edges.push_back((static_cast<uint64_t>(std::min(v0, v1)) << 32) | static_cast<uint64_t>(std::max(v0, v1)));
+					}
+				}
+			}
+
+			std::sort(edges.begin(), edges.end());
+
+			size_t edgeCount = edges.size();
+			size_t first = 0;
+
+			while (first < edgeCount)
+			{
+				size_t last = first + 1;
+				while ((last < edgeCount) && (edges[last] == edges[first]))
+				{
+					last++;
+				}
+
+				// 2 ̃gCAOŋLĂȂGbW
+				if ((last - first) != 2)
+				{
+					vertexLocks[static_cast<uint32_t>(edges[first] >> 32)] = 1;
+					vertexLocks[static_cast<uint32_t>(edges[first] & 0xFFFFFFFF)] = 1;
+				}
+
+				first = last;
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// _̓񎟌덷߂
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<MeshOptimizer::Quadric> quadrics;
+		quadrics.resize(vertexCount, MeshOptimizer::Quadric{});
+
+		for (uint32_t i = 0; i < indexCount; i += 3)
+		{
+			const glm::vec3& p0 = pPositions[indices[i + 0]];
+			const glm::vec3& p1 = pPositions[indices[i + 1]];
+			const glm::vec3& p2 = pPositions[indices[i + 2]];
+
+			MeshOptimizer::AddPlaneQuadric(quadrics[positionRemap[indices[i + 0]]], p0, p1, p2);
+			MeshOptimizer::AddPlaneQuadric(quadrics[positionRemap[indices[i + 1]]], p0, p1, p2);
+			MeshOptimizer::AddPlaneQuadric(quadrics[positionRemap[indices[i + 2]]], p0, p1, p2);
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// 덷̏GbWkނ
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<uint32_t> adjacencyOffsets;
+		collection::Vector<uint32_t> adjacencyCursors;
+		collection::Vector<uint32_t> adjacencyFaces;
+		collection::Vector<MeshOptimizer::Collapse> collapses;
+		collection::Vector<uint32_t> collapseRemap;
+		collection::Vector<uint8_t> collapseLocks;
+
+		float maxCost = 0.0f;
+
+		while (indexCount > targetIndexCount)
+		{
+			/****************************************/
+			/* _ɗאڂgCAÕXg */
+			/****************************************/
+
+			adjacencyOffsets.assign(vertexCount + 1, 0);
+			adjacencyFaces.resize(indexCount);
+
+			for (uint32_t i = 0; i < indexCount; i++)
+			{
+				adjacencyOffsets[indices[i] + 1]++;
+			}
+
+			for (uint32_t i = 0; i < vertexCount; i++)
+			{
+				adjacencyOffsets[i + 1] += adjacencyOffsets[i];
+			}
+
+			adjacencyCursors.assign(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+
+			for (uint32_t i = 0; i < indexCount; i++)
+			{
+				adjacencyFaces[adjacencyCursors[indices[i]]++] = i / 3;
+			}
+
+			/**************************/
+			/* kނGbW̌ */
+			/**************************/
+
+			collapses.clear();
+
+			for (uint32_t i = 0; i < indexCount; i += 3)
+			{
+				for (uint32_t j = 0; j < 3; j++)
+				{
+					uint32_t edge[2] = { indices[i + j], indices[i + ((j + 1) % 3)] };
+
+					for (uint32_t k = 0; k < 2; k++)
+					{
+						uint32_t from = edge[k];
+						uint32_t to = edge[k ^ 1];
+
+						if ((vertexLocks[from] != 0) || (positionRemap[from] == positionRemap[to]))
+						{
+							continue;
+						}
+
+						if ((pVertexKeys != nullptr) && (pVertexKeys[from] != pVertexKeys[to]))
+						{
+							continue;
+						}
+
+						// bNĂȂ_́Aʒuɑ̒_Ȃ ( positionRemap[from] == from )
+						const MeshOptimizer::Quadric& quadric = quadrics[from];
+
+						MeshOptimizer::Collapse collapse;
+						collapse.from = from;
+						collapse.to = to;
+						collapse.cost = (quadric.weight > 0.0) ? MeshOptimizer::EvaluateQuadric(quadric, pPositions[to]) / static_cast<float>(quadric.weight) : 0.0f;
+
+						collapses.push_back(collapse);
+					}
+				}
+			}
+
+			if (collapses.empty() == true)
+			{
+				break;
+			}
+
+			std::sort(collapses.begin(), collapses.end(), [](const MeshOptimizer::Collapse& lh, const MeshOptimizer::Collapse& rh) { return lh.cost < rh.cost; });
+
+			/********/
+			/* k */
+			/********/
+
+			// 1 ̏kނł悻 2 ̃gCAOȂ
+			uint32_t collapseLimit = std::max(1U, (indexCount - targetIndexCount) / 6);
+			uint32_t collapseCount = 0;
+
+			collapseRemap.resize(vertexCount);
+			for (uint32_t i = 0; i < vertexCount; i++)
+			{
+				collapseRemap[i] = i;
+			}
+
+			collapseLocks.assign(vertexCount, 0);
+
+			auto it_begin = collapses.begin();
+			auto it_end = collapses.end();
+
+			for (auto it = it_begin; (it != it_end) && (collapseCount < collapseLimit); ++it)
+			{
+				const MeshOptimizer::Collapse& collapse = (*it);
+
+				if ((collapseLocks[collapse.from] != 0) || (collapseLocks[collapse.to] != 0))
+				{
+					continue;
+				}
+
+				// ]gCAOꍇ͏kނȂ
+				const uint32_t* pFace = adjacencyFaces.data() + adjacencyOffsets[collapse.from];
+				const uint32_t* pFaceEnd = adjacencyFaces.data() + adjacencyOffsets[collapse.from + 1];
+
+				bool flipped = false;
+
+				while ((pFace != pFaceEnd) && (flipped == false))
+				{
+					const uint32_t* pFaceIndices = &indices[*pFace * 3];
+
+					if ((pFaceIndices[0] != collapse.to) && (pFaceIndices[1] != collapse.to) && (pFaceIndices[2] != collapse.to))
+					{
+						glm::vec3 p[3] = { pPositions[pFaceIndices[0]], pPositions[pFaceIndices[1]], pPositions[pFaceIndices[2]] };
+						glm::vec3 oldNormal = glm::cross(p[1] - p[0], p[2] - p[0]);
+
+						for (uint32_t i = 0; i < 3; i++)
+						{
+							if (pFaceIndices[i] == collapse.from)
+							{
+								p[i] = pPositions[collapse.to];
+							}
+						}
+
+						glm::vec3 newNormal = glm::cross(p[1] - p[0], p[2] - p[0]);
+
+						flipped = (glm::dot(oldNormal, newNormal) <= 0.0f);
+					}
+
+					pFace++;
+				}
+
+				if (flipped == true)
+				{
+					continue;
+				}
+
+				// kނgCAO̒_́ÃpXł͂Ȃ
+				pFace = adjacencyFaces.data() + adjacencyOffsets[collapse.from];
+
+				while (pFace != pFaceEnd)
+				{
+					const uint32_t* pFaceIndices = &indices[*pFace * 3];
+
+					collapseLocks[pFaceIndices[0]] = 1;
+					collapseLocks[pFaceIndices[1]] = 1;
+					collapseLocks[pFaceIndices[2]] = 1;
+
+					pFace++;
+				}
+
+				collapseRemap[collapse.from] = collapse.to;
+
+				MeshOptimizer::AddQuadric(quadrics[positionRemap[collapse.to]], quadrics[collapse.from]);
+
+				maxCost = std::max(maxCost, collapse.cost);
+				collapseCount++;
+			}
+
+			if (collapseCount == 0)
+			{
+				break;
+			}
+
+			/**********************************************/
+			/* CfbNXuāAkނʂ폜 */
+			/**********************************************/
+
+			uint32_t newIndexCount = 0;
+
+			for (uint32_t i = 0; i < indexCount; i += 3)
+			{
+				uint32_t v0 = collapseRemap[indices[i + 0]];
+				uint32_t v1 = collapseRemap[indices[i + 1]];
+				uint32_t v2 = collapseRemap[indices[i + 2]];
+
+				if ((v0 != v1) && (v1 != v2) && (v2 != v0))
+				{
+					indices[newIndexCount + 0] = v0;
+					indices[newIndexCount + 1] = v1;
+					indices[newIndexCount + 2] = v2;
+					newIndexCount += 3;
+				}
+			}
+
+			indexCount = newIndexCount;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+
+		error = sqrtf(maxCost);
+
+		memcpy_s(pDstIndices, sizeof(uint32_t) * srcIndexCount, indices.data(), sizeof(uint32_t) * indexCount);
+
+		return indexCount;
+	}
+
+	/***************************/
+	/* private - MeshOptimizer */
+	/***************************/
+
+	float MeshOptimizer::GetVertexScore(int32_t cachePosition, uint32_t valence)
+	{
+		if (valence == 0)
+		{
+			// gpgCAOcĂȂ
+			return -1.0f;
+		}
+
+		float score = 0.0f;
+
+		if (cachePosition >= 0)
+		{
+			if (cachePosition < 3)
+			{
+				// ÕgCAOŎgp_́Aǂ̏ԂŎgĂςȂߌŒ̃XRAɂ
+				score = MeshOptimizer::LAST_TRI_SCORE;
+			}
+			else
+			{
+				const float scaler = 1.0f / static_cast<float>(MeshOptimizer::CACHE_SIZE - 3);
+				score = 1.0f - static_cast<float>(cachePosition - 3) * scaler;
+				score = powf(score, MeshOptimizer::CACHE_DECAY_POWER);
+			}
+		}
+
+		// c̃gCAOȂ_D悵Ďg؂
+		score += MeshOptimizer::VALENCE_BOOST_SCALE * powf(static_cast<float>(valence), -MeshOptimizer::VALENCE_BOOST_POWER);
+
+		return score;
+	}
+
+
+	void MeshOptimizer::ComputeClusterBounds(const glm::vec3* pPositions, const uint32_t* pIndices, float frontFaceSign, MeshOptimizer::Cluster& cluster)
+	{
+		const uint32_t* pIndexBegin = pIndices;
+		const uint32_t* pIndexEnd = pIndexBegin + cluster.indexCount;
+		const uint32_t* pIndex;
+
+		// ----------------------------------------------------------------------------------------------------
+		// E
+		// ----------------------------------------------------------------------------------------------------
+
+		glm::vec3 minimum(+VE_FLOAT_MAX);
+		glm::vec3 maximum(-VE_FLOAT_MAX);
+
+		pIndex = pIndexBegin;
+		while (pIndex != pIndexEnd)
+		{
+			minimum = glm::min(minimum, pPositions[*pIndex]);
+			maximum = glm::max(maximum, pPositions[*pIndex]);
+			pIndex++;
+		}
+
+		cluster.center = (minimum + maximum) * 0.5f;
+		cluster.radius = 0.0f;
+
+		pIndex = pIndexBegin;
+		while (pIndex != pIndexEnd)
+		{
+			cluster.radius = std::max(cluster.radius, glm::distance(cluster.center, pPositions[*pIndex]));
+			pIndex++;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// @R[
+		// ----------------------------------------------------------------------------------------------------
+
+		collection::Vector<glm::vec3> faceNormals;
+		faceNormals.reserve(cluster.indexCount / 3);
+
+		glm::vec3 axis(0.0f);
+
+		pIndex = pIndexBegin;
+		while (pIndex != pIndexEnd)
+		{
+			const glm::vec3& p0 = pPositions[pIndex[0]];
+			const glm::vec3& p1 = pPositions[pIndex[1]];
+			const glm::vec3& p2 = pPositions[pIndex[2]];
+
+			glm::vec3 faceNormal = glm::cross(p1 - p0, p2 - p0) * frontFaceSign;
+			float faceNormalLength = glm::length(faceNormal);
+
+			if (faceNormalLength > VE_FLOAT_EPSILON)
+			{
+				// kނĂgCAO͕`悳Ȃ̂Ŗ
+				faceNormal /= faceNormalLength;
+				faceNormals.push_back(faceNormal);
+				axis += faceNormal;
+			}
+
+			pIndex += 3;
+		}
+
+		cluster.coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+		cluster.coneCutoff = 1.0f;
+
+		float axisLength = glm::length(axis);
+		if ((faceNormals.empty() == true) || (axisLength <= VE_FLOAT_EPSILON))
+		{
+			return;
+		}
+
+		axis /= axisLength;
+
+		float minDot = 1.0f;
+
+		auto it_begin = faceNormals.begin();
+		auto it_end = faceNormals.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			minDot = std::min(minDot, glm::dot(axis, *it));
+		}
+
+		// @̂΂傫 ( 90 xɋ߂ ) NX^[͂قƂǃJOłȂ̂ŁAwʃJO͂Ȃ
+		if (minDot <= 0.1f)
+		{
+			return;
+		}
+
+		cluster.coneAxis = axis;
+		cluster.coneCutoff = sqrtf(1.0f - minDot * minDot);
+	}
+
+	void MeshOptimizer::AddPlaneQuadric(MeshOptimizer::Quadric& quadric, const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2)
+	{
+		glm::dvec3 normal = glm::cross(glm::dvec3(p1 - p0), glm::dvec3(p2 - p0));
+
+		double normalLength = glm::length(normal);
+		if (normalLength <= static_cast<double>(VE_FLOAT_EPSILON))
+		{
+			return;
+		}
+
+		normal /= normalLength;
+
+		// ʐςŏdݕt
+		double area = normalLength * 0.5;
+		double d = -glm::dot(normal, glm::dvec3(p0));
+
+		quadric.a00 += area * normal.x * normal.x;
+		quadric.a11 += area * normal.y * normal.y;
+		quadric.a22 += area * normal.z * normal.z;
+		quadric.a10 += area * normal.y * normal.x;
+		quadric.a20 += area * normal.z * normal.x;
+		quadric.a21 += area * normal.z * normal.y;
+		quadric.b0 += area * normal.x * d;
+		quadric.b1 += area * normal.y * d;
+		quadric.b2 += area * normal.z * d;
+		quadric.c += area * d * d;
+		quadric.weight += area;
+	}
+
+	void MeshOptimizer::AddQuadric(MeshOptimizer::Quadric& dst, const MeshOptimizer::Quadric& src)
+	{
+		dst.a00 += src.a00;
+		dst.a11 += src.a11;
+		dst.a22 += src.a22;
+		dst.a10 += src.a10;
+		dst.a20 += src.a20;
+		dst.a21 += src.a21;
+		dst.b0 += src.b0;
+		dst.b1 += src.b1;
+		dst.b2 += src.b2;
+		dst.c += src.c;
+		dst.weight += src.weight;
+	}
+
+	float MeshOptimizer::EvaluateQuadric(const MeshOptimizer::Quadric& quadric, const glm::vec3& pos)
+	{
+		double x = pos.x;
+		double y = pos.y;
+		double z = pos.z;
+
+		// v^T A v + 2 b^T v + c
+		double result =
+			quadric.a00 * x * x + quadric.a11 * y * y + quadric.a22 * z * z +
+			2.0 * (quadric.a10 * x * y + quadric.a20 * x * z + quadric.a21 * y * z) +
+			2.0 * (quadric.b0 * x + quadric.b1 * y + quadric.b2 * z) +
+			quadric.c;
+
+		return static_cast<float>(std::max(result, 0.0));
+	}
+
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+namespace ve {
+
+	class MeshOptimizer final
+	{
+	public:
+		// NX^[
+		struct Cluster
+		{
+			glm::vec3 center; // E̒S
+			float radius; // E̔a
+			glm::vec3 coneAxis; // @R[̎
+			float coneCutoff; // @R[̃JbgIt ( 1.0f ̏ꍇ͔wʃJOȂ )
+
+			uint32_t indexCount;
+			uint32_t firstIndex;
+		};
+
+		// ڍדx ( LOD )
+		struct Lod
+		{
+			uint32_t indexCount;
+			uint32_t firstIndex;
+			float error; // ̃bV̌덷 (  )
+		};
+
+		// œKőz肷钸_LbṼTCY
+		static constexpr uint32_t CACHE_SIZE = 32;
+		// vőz肷钸_LbV ( FIFO ) ̃TCY
+		static constexpr uint32_t ANALYZE_CACHE_SIZE = 16;
+
+		// _LbṼqbgȂ悤ɃgCAOёւ ( Forsyth )
+		static void OptimizeVertexCache(uint32_t* pIndices, uint32_t indexCount, uint32_t vertexCount);
+
+		// ACMR ( gCAO̒_VF[_[̎s )  ATVR ( _̒_VF[_[̎s ) ߂
+		static void AnalyzeVertexCache(const uint32_t* pIndices, uint32_t indexCount, uint32_t vertexCount, float& acmr, float& atvr);
+
+		// NX^[Ɋ܂߂gCAOA_̍ő吔
+		static constexpr uint32_t CLUSTER_MAX_TRIANGLE_COUNT = 128;
+		static constexpr uint32_t CLUSTER_MAX_VERTEX_COUNT = 96;
+
+		// _̖@ƔrāA\ʂƂȂgCAO̊̕߂ ( 1.0f or -1.0f )
+		static float GetFrontFaceSign(const glm::vec3* pPositions, const glm::vec3* pNormals, const uint32_t* pIndices, uint32_t indexCount);
+
+		// CfbNX̕т擪؂ăNX^[쐬
+		// 쐬NX^[ clusters ̌ɒǉAfirstIndex ɂ firstIndex Ẑi[
+		static void BuildClusters(
+			const glm::vec3* pPositions, uint32_t vertexCount,
+			const uint32_t* pIndices, uint32_t firstIndex, uint32_t indexCount,
+			float frontFaceSign,
+			collection::Vector<MeshOptimizer::Cluster>& clusters);
+
+		// GbWkނăgCAO炷 ( Quadric Error Metrics )
+		// _͊̒_ɏkނ邽߁AUV XLjÕEFCg͂̂܂܎c
+		// ʒuɕ̒_ ( UV Ȃǂ̌p ) _AJĂGbW̒_͏kނȂ
+		// pVertexKeys  nullptr ł͂Ȃꍇ́AL[_mł̂ݏkނ
+		// ߂l pDstIndices ɏ񂾃CfbNX̐ŁAerror ɂ͏kނƂ̌덷 (  ) ̍őli[
+		static uint32_t Simplify(
+			const glm::vec3* pPositions, const uint32_t* pVertexKeys, uint32_t vertexCount,
+			const uint32_t* pSrcIndices, uint32_t srcIndexCount,
+			uint32_t targetIndexCount,
+			uint32_t* pDstIndices, float& error);
+
+	private:
+		static constexpr float CACHE_DECAY_POWER = 1.5f;
+		static constexpr float LAST_TRI_SCORE = 0.75f;
+		static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+		static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+		// Ώ̍s A ( 3x3 )AxNg bA萔 c ŕ\񎟌덷
+		struct Quadric
+		{
+			double a00, a11, a22;
+			double a10, a20, a21;
+			double b0, b1, b2;
+			double c;
+			double weight;
+		};
+
+		struct Collapse
+		{
+			uint32_t from;
+			uint32_t to;
+			float cost; // 덷 ( ̓ )
+		};
+
+		static float GetVertexScore(int32_t cachePosition, uint32_t valence);
+		static void ComputeClusterBounds(const glm::vec3* pPositions, const uint32_t* pIndices, float frontFaceSign, MeshOptimizer::Cluster& cluster);
+
+		static void AddPlaneQuadric(MeshOptimizer::Quadric& quadric, const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2);
+		static void AddQuadric(MeshOptimizer::Quadric& dst, const MeshOptimizer::Quadric& src);
+		static float EvaluateQuadric(const MeshOptimizer::Quadric& quadric, const glm::vec3& pos);
+	};
+
+}
@@ -0,0 +1,175 @@
+#include "ParallelTask.h"
+#include <thread>
+
+namespace ve {
+
+	/************************/
+	/* private - class Pool */
+	/************************/
+
+	class ParallelTask::Pool final
+	{
+	public:
+		static ParallelTask::Pool& Get()
+		{
+			// ŏɎgpƂɍ쐬āAIɔj
+			static ParallelTask::Pool pool;
+			return pool;
+		}
+
+		Pool() :
+			m_Terminate(false)
+		{
+			// ĂяõXbhɉ邽߁A_RA̐Ȃ
+			uint32_t workerCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+
+			m_Workers.reserve(workerCount);
+
+			for (uint32_t i = 0; i < workerCount; i++)
+			{
+				m_Workers.emplace_back(&ParallelTask::Pool::Process, this);
+			}
+		}
+
+		~Pool()
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_Terminate = true;
+			}
+
+			m_WorkCondition.notify_all();
+
+			auto it_begin = m_Workers.begin();
+			auto it_end = m_Workers.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				it->join();
+			}
+		}
+
+		size_t GetWorkerCount() const
+		{
+			return m_Workers.size();
+		}
+
+		void Push(ParallelTask* pTask, size_t count, std::function<void()> function)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+
+				VE_ASSERT((pTask->m_PendingCount == 0) && (pTask->m_RunningCount == 0));
+
+				pTask->m_Function = std::move(function);
+				pTask->m_PendingCount = count;
+
+				m_Tasks.push_back(pTask);
+			}
+
+			m_WorkCondition.notify_all();
+		}
+
+		void Wait(ParallelTask* pTask)
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+
+			if (pTask->m_PendingCount > 0)
+			{
+				m_Tasks.remove(pTask);
+				pTask->m_PendingCount = 0;
+			}
+
+			m_FinishCondition.wait(lock, [pTask]() { return (pTask->m_RunningCount == 0); });
+
+			pTask->m_Function = nullptr;
+		}
+
+	private:
+		collection::Vector<std::thread> m_Workers;
+
+		std::mutex m_Mutex;
+		std::condition_variable m_WorkCondition;
+		std::condition_variable m_FinishCondition;
+		collection::List<ParallelTask*> m_Tasks;
+		bool m_Terminate;
+
+		void Process()
+		{
+			for (;;)
+			{
+				ParallelTask* pTask;
+
+				{
+					std::unique_lock<std::mutex> lock(m_Mutex);
+
+					m_WorkCondition.wait(lock, [this]() { return (m_Terminate == true) || (m_Tasks.empty() == false); });
+
+					if (m_Terminate == true)
+					{
+						return;
+					}
+
+					// ɒǉꂽ^XN珇Ɏs
+					pTask = m_Tasks.front();
+
+					pTask->m_PendingCount--;
+					if (pTask->m_PendingCount == 0)
+					{
+						m_Tasks.pop_front();
+					}
+
+					pTask->m_RunningCount++;
+				}
+
+				pTask->m_Function();
+
+				{
+					std::unique_lock<std::mutex> lock(m_Mutex);
+					pTask->m_RunningCount--;
+				}
+
+				m_FinishCondition.notify_all();
+			}
+		}
+	};
+
+	/*************************/
+	/* public - ParallelTask */
+	/*************************/
+
+	size_t ParallelTask::GetMaxConcurrency()
+	{
+		return ParallelTask::Pool::Get().GetWorkerCount() + 1;
+	}
+
+	ParallelTask::ParallelTask() :
+		m_PendingCount(0),
+		m_RunningCount(0)
+	{
+	}
+
+	ParallelTask::~ParallelTask()
+	{
+		Wait();
+	}
+
+	void ParallelTask::Start(size_t itemCount, std::function<void()> function)
+	{
+		ParallelTask::Pool& pool = ParallelTask::Pool::Get();
+
+		size_t count = std::min((itemCount > 0) ? (itemCount - 1) : 0, pool.GetWorkerCount());
+		if (count == 0)
+		{
+			return;
+		}
+
+		pool.Push(this, count, std::move(function));
+	}
+
+	void ParallelTask::Wait()
+	{
+		ParallelTask::Pool::Get().Wait(this);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+
+namespace ve {
+
+	// ǂݍ݁AbV̍쐬ȂǂŋL郏[J[XbhŁA֐Ɏs
+	// [J[Xbhׂ͂Ẵ^XNŋLĂ邽߁A󂢂ĂȂΎsȂƂ
+	// ̂ߊ֐͏̂ȂȂ܂ŎŎoďAĂяõXbh Wait ܂łɓɉ邱
+	class ParallelTask final
+	{
+	public:
+		// ĂяõXbh܂߂AɎsłő吔
+		static size_t GetMaxConcurrency();
+
+		ParallelTask();
+		~ParallelTask();
+
+		// ĂяõXbhɉ邽߁Afunction ͍őŏ̂̐ itemCount - 1 ̃[J[XbhŎs
+		void Start(size_t itemCount, std::function<void()> function);
+		// ܂JnĂȂ̂āAŝ̂I܂őҋ@
+		void Wait();
+
+	private:
+		class Pool;
+
+		std::function<void()> m_Function;
+		size_t m_PendingCount;
+		size_t m_RunningCount;
+
+		ParallelTask(const ParallelTask&) = delete;
+		ParallelTask& operator = (const ParallelTask&) = delete;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,451 @@
+#include "TextureLoader.h"
+#include "Logger.h"
+#include "DeviceContext.h"
+#include "ResourceMemoryManager.h"
+#include "ImmediateContext.h"
+#include "TextureManager.h"
+#include "Texture.h"
+#include "TextureImpl.h"
+#include "BackgroundQueue.h"
+#include "ParallelTask.h"
+
+namespace ve {
+
+	/**************************/
+	/* public - TextureLoader */
+	/**************************/
+
+	TextureLoaderPtr TextureLoader::Create(DeviceContextPtr deviceContext)
+	{
+		TextureLoaderPtr textureLoader = std::make_shared<TextureLoader>();
+
+		textureLoader->m_DeviceContext = deviceContext;
+
+		return std::move(textureLoader);
+	}
+
+	TextureLoader::TextureLoader() :
+		m_Finished(false)
+	{
+	}
+
+	TextureLoader::~TextureLoader()
+	{
+		// ǂݍ܂ɔjꂽꍇ́ÃfeNX`쐬悤ɂ
+		if (m_Finished == false)
+		{
+			Abort();
+		}
+	}
+
+	TexturePtr TextureLoader::Add(const wchar_t* pFilePath, V3DFlags stageMask, V3DFlags accessMask)
+	{
+		VE_ASSERT(m_Finished == false);
+
+		TextureManager* pManager = m_DeviceContext->GetTextureManagerPtr();
+
+		TexturePtr texture = pManager->Find(pFilePath, stageMask, accessMask);
+		if (texture != nullptr)
+		{
+			if (texture->IsPending() == true)
+			{
+				m_Waits.push_back(texture);
+			}
+
+			return texture;
+		}
+
+		TexturePtr placeholder = GetPlaceholder(stageMask, accessMask);
+		if (placeholder == nullptr)
+		{
+			return nullptr;
+		}
+
+		texture = std::make_shared<Texture>();
+
+		Texture::Impl* pImpl = texture->impl;
+		pImpl->deviceContext = m_DeviceContext;
+		pImpl->filePath = pFilePath;
+		pImpl->stageMask = stageMask;
+		pImpl->accessMask = accessMask;
+		pImpl->placeholder = placeholder;
+		pImpl->pending = true;
+
+		// ̃XbhɓeNX`o^Ăꍇ͂Ԃ ( 쐬eNX`͓o^ĂȂ߁Â܂ܔj )
+		TexturePtr addedTexture = pManager->FindOrAdd(pFilePath, stageMask, accessMask, texture);
+		if (addedTexture != texture)
+		{
+			if (addedTexture->IsPending() == true)
+			{
+				m_Waits.push_back(addedTexture);
+			}
+
+			return addedTexture;
+		}
+
+		TextureLoader::Request request;
+		request.texture = texture;
+		request.pNativeImage = nullptr;
+		request.nativeImageViewDesc = V3DImageViewDesc{};
+		request.srcOffset = 0;
+		request.result = false;
+
+		m_Requests.push_back(request);
+
+		return texture;
+	}
+
+	bool TextureLoader::Load(LoggerPtr logger, BackgroundJobHandlePtr handle)
+	{
+		VE_ASSERT(m_Finished == false);
+
+		if (m_Requests.empty() == true)
+		{
+			m_Finished = true;
+			return true;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// fR[h
+		// ----------------------------------------------------------------------------------------------------
+
+		if (handle != nullptr)
+		{
+			handle->BeginStage(BACKGROUND_JOB_STAGE_LOAD_TEXTURE, m_Requests.size());
+		}
+
+		{
+			std::atomic<size_t> nextRequest(0);
+
+			auto decodeFunc = [&]()
+			{
+				size_t requestIndex;
+
+				while ((requestIndex = nextRequest.fetch_add(1)) < m_Requests.size())
+				{
+					if ((handle != nullptr) && (handle->IsCancelRequested() == true))
+					{
+						break;
+					}
+
+					TextureLoader::Request& request = m_Requests[requestIndex];
+
+					StringA filePathA;
+					ToMultibyteString(request.texture->impl->filePath.c_str(), filePathA);
+
+					request.image = gli::load(filePathA.c_str());
+					request.result = (request.image.empty() == false);
+
+					if (handle != nullptr)
+					{
+						handle->AddProgress(1);
+					}
+				}
+			};
+
+			ParallelTask task;
+			task.Start(1U)), m_Requests.size(), decodeFunc);
+
+			// ĂяõXbhfR[hɉ
+			decodeFunc();
+
+			task.Wait();
+		}
+
+		// LZꂽꍇ͓]ɏI
+		if ((handle != nullptr) && (handle->IsCancelRequested() == true))
+		{
+			Abort();
+			return false;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ]̃C[W쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		{
+			auto it_begin = m_Requests.begin();
+			auto it_end = m_Requests.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (it->result == true)
+				{
+					Texture::Impl* pImpl = it->texture->impl;
+					it->result = pImpl->Prepare(m_DeviceContext, pImpl->filePath.c_str(), it->image, pImpl->stageMask, pImpl->accessMask, &it->pNativeImage, it->nativeImageViewDesc);
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// ]
+		// ----------------------------------------------------------------------------------------------------
+
+		if ((handle != nullptr) && (handle->IsCancelRequested() == true))
+		{
+			Abort();
+			return false;
+		}
+
+		if (Upload(logger) == false)
+		{
+			auto it_begin = m_Requests.begin();
+			auto it_end = m_Requests.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (it->result == true)
+				{
+					it->texture->impl->Discard(it->pNativeImage);
+					it->pNativeImage = nullptr;
+					it->result = false;
+				}
+			}
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// C[Wr[쐬āAv[Xz_[Ɠւ
+		// ----------------------------------------------------------------------------------------------------
+
+		Finish(logger);
+
+		return true;
+	}
+
+	bool TextureLoader::IsFinished() const
+	{
+		if (m_Finished == false)
+		{
+			return false;
+		}
+
+		auto it_begin = m_Waits.begin();
+		auto it_end = m_Waits.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			if ((*it)->IsPending() == true)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/***************************/
+	/* private - TextureLoader */
+	/***************************/
+
+	bool TextureLoader::Upload(LoggerPtr logger)
+	{
+		// ----------------------------------------------------------------------------------------------------
+		// ]̃obt@[̃TCY߂
+		// ----------------------------------------------------------------------------------------------------
+
+		uint64_t totalSize = 0;
+		uint64_t maxSize = 0;
+
+		{
+			auto it_begin = m_Requests.begin();
+			auto it_end = m_Requests.end();
+
+			for (auto it = it_begin; it != it_end; ++it)
+			{
+				if (it->result == true)
+				{
+					uint64_t size = static_cast<uint64_t>(it->image.size());
+					totalSize += (size + TextureLoader::STAGING_ALIGNMENT - 1) & ~(TextureLoader::STAGING_ALIGNMENT - 1);
+					maxSize = std::max(maxSize, size);
+				}
+			}
+		}
+
+		if (totalSize == 0)
+		{
+			return true;
+		}
+
+		// őTCY𒴂eNX`ꍇ́Aꂪ܂傫ɂ
+		uint64_t bufferSize = std::max(std::min(totalSize, TextureLoader::STAGING_BUFFER_SIZE), maxSize);
+
+		// ----------------------------------------------------------------------------------------------------
+		// ]̃obt@[쐬
+		// ----------------------------------------------------------------------------------------------------
+
+		IV3DDevice* pNativeDevice = m_DeviceContext->GetNativeDevicePtr();
+		ResourceMemoryManager* pResourceMemoryManager = m_DeviceContext->GetResourceMemoryManagerPtr();
+		ImmediateContext* pImmediateContext = m_DeviceContext->GetImmediateContextPtr();
+
+		V3DBufferDesc srcBufferDesc;
+		srcBufferDesc.usageFlags = V3D_BUFFER_USAGE_TRANSFER_SRC;
+		srcBufferDesc.size = bufferSize;
+
+		IV3DBuffer* pSrcBuffer;
+		if (pNativeDevice->CreateBuffer(srcBufferDesc, &pSrcBuffer, VE_INTERFACE_DEBUG_NAME(L"VE_TextureLoader_SrcBuffer")) != V3D_OK)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "Failed to create the staging buffer for textures : Size[%llu]", bufferSize);
+			return false;
+		}
+
+		ResourceAllocation srcBufferAllocation = pResourceMemoryManager->Allocate(pSrcBuffer, V3D_MEMORY_PROPERTY_HOST_VISIBLE);
+		if (srcBufferAllocation == nullptr)
+		{
+			logger->PrintA(Logger::TYPE_ERROR, "Failed to allocate the staging buffer for textures : Size[%llu]", bufferSize);
+			pSrcBuffer->Release();
+			return false;
+		}
+
+		uint32_t memorySize = VE_U64_TO_U32(pSrcBuffer->GetResourceDesc().memorySize);
+
+		// ----------------------------------------------------------------------------------------------------
+		// obt@[Ɏ܂邾l߂ē] ( ʏ͂ЂƂ̃f̃eNX`x̓]ōς )
+		// ----------------------------------------------------------------------------------------------------
+
+		bool result = true;
+		size_t requestCount = m_Requests.size();
+		size_t firstRequest = 0;
+
+		while ((result == true) && (firstRequest < requestCount))
+		{
+			uint8_t* pMemory;
+			if (pSrcBuffer->Map(0, 0, reinterpret_cast<void**>(&pMemory)) != V3D_OK)
+			{
+				result = false;
+				break;
+			}
+
+			IV3DCommandBuffer* pCommandBuffer = pImmediateContext->Begin();
+			VE_ASSERT(pCommandBuffer != nullptr);
+
+			uint64_t offset = 0;
+			size_t lastRequest = firstRequest;
+
+			while (lastRequest < requestCount)
+			{
+				TextureLoader::Request& request = m_Requests[lastRequest];
+
+				if (request.result == true)
+				{
+					uint64_t size = static_cast<uint64_t>(request.image.size());
+					if (offset + size > bufferSize)
+					{
+						break;
+					}
+
+					memcpy_s(pMemory + offset, memorySize - VE_U64_TO_U32(offset), request.image.data(), request.image.size());
+
+					request.texture->impl->RecordCopy(pCommandBuffer, request.pNativeImage, pSrcBuffer, offset, request.image);
+
+					// fR[hC[W͕svɂȂ
+					request.image = gli::texture();
+
+					offset = (offset + size + TextureLoader::STAGING_ALIGNMENT - 1) & ~(TextureLoader::STAGING_ALIGNMENT - 1);
+				}
+
+				lastRequest++;
+			}
+
+			pSrcBuffer->Unmap();
+
+			pImmediateContext->End();
+
+			firstRequest = lastRequest;
+		}
+
+		// ----------------------------------------------------------------------------------------------------
+		// svȂ̂j
+		// ----------------------------------------------------------------------------------------------------
+
+		pSrcBuffer->Release();
+		pResourceMemoryManager->Free(srcBufferAllocation);
+
+		return result;
+	}
+
+	void TextureLoader::Finish(LoggerPtr logger)
+	{
+		TextureManager* pManager = m_DeviceContext->GetTextureManagerPtr();
+
+		auto it_begin = m_Requests.begin();
+		auto it_end = m_Requests.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			Texture::Impl* pImpl = it->texture->impl;
+
+			if (it->result == true)
+			{
+				it->result = pImpl->CreateView(it->pNativeImage, it->nativeImageViewDesc);
+			}
+
+			if (it->result == false)
+			{
+				logger->PrintW(Logger::TYPE_WARNING, L"Failed to load the texture : %s", pImpl->filePath.c_str());
+
+				// ǂݍ߂ȂeNX`̓v[Xz_[̂܂܂ɂāAɍ쐬Ƃ͓ǂݍݒ
+				pManager->Remove(pImpl->filePath.c_str(), pImpl->stageMask, pImpl->accessMask, it->texture.get());
+			}
+
+			it->image = gli::texture();
+
+			pImpl->pending.store(false, std::memory_order_release);
+		}
+
+		m_Finished = true;
+	}
+
+	void TextureLoader::Abort()
+	{
+		TextureManager* pManager = m_DeviceContext->GetTextureManagerPtr();
+
+		auto it_begin = m_Requests.begin();
+		auto it_end = m_Requests.end();
+
+		for (auto it = it_begin; it != it_end; ++it)
+		{
+			Texture::Impl* pImpl = it->texture->impl;
+
+			// ]̃C[W쐬Ăꍇ͔j
+			if (it->pNativeImage != nullptr)
+			{
+				pImpl->Discard(it->pNativeImage);
+				it->pNativeImage = nullptr;
+			}
+
+			it->image = gli::texture();
+			it->result = false;
+
+			pManager->Remove(pImpl->filePath.c_str(), pImpl->stageMask, pImpl->accessMask, it->texture.get());
+			pImpl->pending.store(false, std::memory_order_release);
+		}
+
+		m_Finished = true;
+	}
+
+	TexturePtr TextureLoader::GetPlaceholder(V3DFlags stageMask, V3DFlags accessMask)
+	{
+		TextureManager* pManager = m_DeviceContext->GetTextureManagerPtr();
+
+		TexturePtr placeholder = pManager->Find(TextureLoader::PLACEHOLDER_NAME, stageMask, accessMask);
+		if (placeholder != nullptr)
+		{
+			return placeholder;
+		}
+
+		//  1x1 ̃C[W
+		gli::texture2d image(gli::FORMAT_RGBA8_UNORM_PACK8, gli::extent2d(1, 1), 1);
+		memset(image.data(), 0xFF, image.size());
+
+		placeholder = std::make_shared<Texture>();
+
+		if (placeholder->impl->Load(m_DeviceContext, TextureLoader::PLACEHOLDER_NAME, image, stageMask, accessMask) == false)
+		{
+			return nullptr;
+		}
+
+		// ̃Xbhɓo^v[Xz_[΂L
+		return pManager->FindOrAdd(TextureLoader::PLACEHOLDER_NAME, stageMask, accessMask, placeholder);
+	}
+
+}
\ No newline at end of file
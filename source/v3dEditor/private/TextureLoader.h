@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+
+namespace ve {
+
+	// eNX`[J[XbhŃfR[hAЂƂ̓]obt@[܂Ƃ߂ē]
+	// ]I܂ŁA쐬eNX` 1x1 ̃v[Xz_[̃C[WԂ
+	class TextureLoader final
+	{
+	public:
+		static TextureLoaderPtr Create(DeviceContextPtr deviceContext);
+
+		TextureLoader();
+		~TextureLoader();
+
+		// ɍ쐬ĂeNX`͂ԂA쐬ĂȂꍇ͓ǂݍݒ̃eNX`쐬ĕԂ
+		TexturePtr Add(const wchar_t* pFilePath, V3DFlags stageMask = V3D_PIPELINE_STAGE_FRAGMENT_SHADER, V3DFlags accessMask = V3D_ACCESS_SHADER_READ);
+		// ǂݍ߂ȂeNX`̓v[Xz_[̂܂܂ɂȂ ( handle  nullptr łǂ )
+		// LZꂽꍇ͓] false ԂA܂ǂݍłȂeNX`͑̃[_[쐬悤ɂȂ
+		bool Load(LoggerPtr logger, BackgroundJobHandlePtr handle);
+		// Add ŕԂeNX`ׂēǂݍݒł͂ȂȂǂ ( ̃[_[ǂݍł̂܂ )
+		bool IsFinished() const;
+
+		VE_DECLARE_ALLOCATOR
+
+	private:
+		// ]obt@[̍őTCY ( 傫ꍇ́Aobt@[g܂킵ĕē] )
+		static constexpr uint64_t STAGING_BUFFER_SIZE = 64 * 1024 * 1024;
+		static constexpr uint64_t STAGING_ALIGNMENT = 16;
+		// v[Xz_[͓Xe[WAANZX̃eNX`ŋL
+		static constexpr const wchar_t* PLACEHOLDER_NAME = L"VE_TexturePlaceholder";
+
+		struct Request
+		{
+			TexturePtr texture;
+			gli::texture image;
+			IV3DImage* pNativeImage;
+			V3DImageViewDesc nativeImageViewDesc;
+			uint64_t srcOffset;
+			bool result;
+		};
+
+		DeviceContextPtr m_DeviceContext;
+		collection::Vector<TextureLoader::Request> m_Requests;
+		collection::Vector<TexturePtr> m_Waits;
+		std::atomic<bool> m_Finished;
+
+		bool Upload(LoggerPtr logger);
+		void Finish(LoggerPtr logger);
+		void Abort();
+
+		TexturePtr GetPlaceholder(V3DFlags stageMask, V3DFlags accessMask);
+	};
+
+}
@@ -59,10 +59,10 @@ namespace ve {
 			return nullptr;
 		}
 
-		return it->second.lock();
+		return it->second.texture.lock();
 	}
 
-	void TextureManager::Add(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, TexturePtr texture)
+	TexturePtr TextureManager::FindOrAdd(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, TexturePtr texture)
 	{
 		LockGuard<Mutex> lock(m_Mutex);
 
@@ -71,10 +71,21 @@ namespace ve {
 		key.stageMask = stageMask;
 		key.accessMask = accessMask;
 
-		m_Map[key] = texture;
+		TextureManager::Entry& entry = m_Map[key];
+
+		TexturePtr existTexture = entry.texture.lock();
+		if (existTexture != nullptr)
+		{
+			return existTexture;
+		}
+
+		entry.texture = texture;
+		entry.pTexture = texture.get();
+
+		return texture;
 	}
 
-	void TextureManager::Remove(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask)
+	void TextureManager::Remove(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, const Texture* pTexture)
 	{
 		LockGuard<Mutex> lock(m_Mutex);
 
@@ -84,7 +95,7 @@ namespace ve {
 		key.accessMask = accessMask;
 
 		auto it = m_Map.find(key);
-		if (it != m_Map.end())
+		if ((it != m_Map.end()) && (it->second.pTexture == pTexture))
 		{
 			m_Map.erase(it);
 		}
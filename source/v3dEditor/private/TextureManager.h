@@ -8,8 +8,10 @@ namespace ve {
 	{
 	public:
 		TexturePtr Find(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask);
-		void Add(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, TexturePtr texture);
-		void Remove(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask);
+		// ɓo^ĂeNX`΂ԂAȂ texture o^ĕԂ
+		TexturePtr FindOrAdd(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, TexturePtr texture);
+		// o^Ă̂ pTexture ̏ꍇ菜
+		void Remove(const wchar_t* pName, V3DFlags stageMask, V3DFlags accessMask, const Texture* pTexture);
 
 	private:
 		struct Key
@@ -21,9 +23,15 @@ namespace ve {
 			bool operator < (const TextureManager::Key& rhs) const;
 		};
 
+		struct Entry
+		{
+			WeakPtr<Texture> texture;
+			const Texture* pTexture; // j texture ؂ɂȂĂĂo^eNX`ʂł悤ɂ
+		};
+
 		Mutex m_Mutex;
 
-		collection::Map<TextureManager::Key, WeakPtr<Texture>> m_Map;
+		collection::Map<TextureManager::Key, TextureManager::Entry> m_Map;
 
 		static TextureManager* Create();
 